@@ -46,6 +46,10 @@ const ReactNativeStyleAttributes: {[string]: AnyAttributeType, ...} = {
   flexShrink: true,
   flexWrap: true,
   gap: true,
+  gridColumn: true,
+  gridRow: true,
+  gridTemplateColumns: true,
+  gridTemplateRows: true,
   height: true,
   inset: true,
   insetBlock: true,
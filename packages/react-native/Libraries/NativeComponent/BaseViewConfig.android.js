@@ -210,6 +210,10 @@ const validAttributesForNonEventProps = {
   aspectRatio: true,
   flexDirection: true,
   flexWrap: true,
+  gridTemplateColumns: true,
+  gridTemplateRows: true,
+  gridColumn: true,
+  gridRow: true,
   alignSelf: true,
   alignItems: true,
   alignContent: true,
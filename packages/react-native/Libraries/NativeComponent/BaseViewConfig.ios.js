@@ -323,6 +323,10 @@ const validAttributesForNonEventProps = {
   flexBasis: true,
   flexDirection: true,
   flexWrap: true,
+  gridTemplateColumns: true,
+  gridTemplateRows: true,
+  gridColumn: true,
+  gridRow: true,
   justifyContent: true,
   alignItems: true,
   alignSelf: true,
@@ -24,6 +24,20 @@ import defineLazyObjectProperty from '../Utilities/defineLazyObjectProperty';
 
 export type NodeSet = Array<Node>;
 export type NodeProps = {...};
+
+// Opcodes of the instruction list passed to `createNodes`.
+// Must be kept in sync with `UIManagerBinding.cpp`.
+export const NodeInstruction: $ReadOnly<{
+  CreateNode: 0,
+  AppendChild: 1,
+}> = {
+  // Followed by `reactTag, viewName, props, instanceHandle`.
+  CreateNode: 0,
+  // Followed by `parent, child`. Each of them is either the index of a node
+  // created by the same call or a node.
+  AppendChild: 1,
+};
+export type NodeInstructionList = $ReadOnlyArray<mixed>;
 export interface Spec {
   +createNode: (
     reactTag: number,
@@ -38,6 +52,10 @@ export interface Spec {
   +cloneNodeWithNewChildrenAndProps: (node: Node, newProps: NodeProps) => Node;
   +createChildSet: (rootTag: RootTag) => NodeSet;
   +appendChild: (parentNode: Node, child: Node) => Node;
+  +createNodes: (
+    rootTag: RootTag,
+    instructions: NodeInstructionList,
+  ) => $ReadOnlyArray<Node>;
   +appendChildToSet: (childSet: NodeSet, child: Node) => void;
   +completeRoot: (rootTag: RootTag, childSet: NodeSet) => void;
   +measure: (node: Node, callback: MeasureOnSuccessCallback) => void;
@@ -95,6 +113,7 @@ const CACHED_PROPERTIES = [
   'cloneNodeWithNewChildrenAndProps',
   'createChildSet',
   'appendChild',
+  'createNodes',
   'appendChildToSet',
   'completeRoot',
   'measure',
@@ -19,6 +19,7 @@ import type {
 } from '../../Renderer/shims/ReactNativeTypes';
 import type {RootTag} from '../../Types/RootTagTypes';
 import type {
+  NodeInstructionList,
   NodeProps,
   NodeSet,
   Spec as FabricUIManager,
@@ -225,6 +226,50 @@ const FabricUIManagerMock: IFabricUIManagerMock = {
     return parentNode;
   }),
 
+  createNodes: jest.fn(
+    (
+      rootTag: RootTag,
+      instructions: NodeInstructionList,
+    ): $ReadOnlyArray<Node> => {
+      const nodes: Array<Node> = [];
+      const nodeFromOperand = (operand: mixed): Node =>
+        // $FlowExpectedError[incompatible-return]
+        typeof operand === 'number' ? nodes[operand] : operand;
+
+      let index = 0;
+      while (index < instructions.length) {
+        switch (instructions[index]) {
+          case 0: // NodeInstruction.CreateNode
+            nodes.push(
+              FabricUIManagerMock.createNode(
+                // $FlowExpectedError[incompatible-call]
+                instructions[index + 1],
+                // $FlowExpectedError[incompatible-call]
+                instructions[index + 2],
+                rootTag,
+                // $FlowExpectedError[incompatible-call]
+                instructions[index + 3],
+                // $FlowExpectedError[incompatible-call]
+                instructions[index + 4],
+              ),
+            );
+            index += 5;
+            break;
+          case 1: // NodeInstruction.AppendChild
+            FabricUIManagerMock.appendChild(
+              nodeFromOperand(instructions[index + 1]),
+              nodeFromOperand(instructions[index + 2]),
+            );
+            index += 3;
+            break;
+          default:
+            throw new Error(`Unknown instruction at index ${index}`);
+        }
+      }
+      return nodes;
+    },
+  ),
+
   appendChildToSet: jest.fn((childSet: NodeSet, child: Node): void => {
     childSet.push(child);
   }),
@@ -55,7 +55,7 @@ export interface FlexStyle {
   borderTopWidth?: number | undefined;
   borderWidth?: number | undefined;
   bottom?: DimensionValue | undefined;
-  display?: 'none' | 'flex' | undefined;
+  display?: 'none' | 'flex' | 'grid' | undefined;
   end?: DimensionValue | undefined;
   flex?: number | undefined;
   flexBasis?: DimensionValue | undefined;
@@ -71,6 +71,10 @@ export interface FlexStyle {
   flexGrow?: number | undefined;
   flexShrink?: number | undefined;
   flexWrap?: 'wrap' | 'nowrap' | 'wrap-reverse' | undefined;
+  gridColumn?: number | string | undefined;
+  gridRow?: number | string | undefined;
+  gridTemplateColumns?: string | ReadonlyArray<number | string> | undefined;
+  gridTemplateRows?: string | ReadonlyArray<number | string> | undefined;
   height?: DimensionValue | undefined;
   justifyContent?:
     | 'flex-start'
@@ -55,10 +55,10 @@ export type CursorValue = 'auto' | 'pointer';
 type ____LayoutStyle_Internal = $ReadOnly<{
   /** `display` sets the display type of this component.
    *
-   *  It works similarly to `display` in CSS, but only support 'flex' and 'none'.
-   *  'flex' is the default.
+   *  It works similarly to `display` in CSS, but only support 'flex', 'grid'
+   *  and 'none'. 'flex' is the default.
    */
-  display?: 'none' | 'flex',
+  display?: 'none' | 'flex' | 'grid',
 
   /** `width` sets the width of this component.
    *
@@ -647,6 +647,25 @@ type ____LayoutStyle_Internal = $ReadOnly<{
   rowGap?: number | string,
   columnGap?: number | string,
   gap?: number | string,
+
+  /** `gridTemplateColumns` and `gridTemplateRows` set the explicit columns
+   *  and rows of a `display: 'grid'` container, as a string of space separated
+   *  tracks (e.g. `'1fr 100 auto 50%'`) or as an array of tracks, where
+   *  numbers are lengths. Tracks are lengths, percentages, `auto` or
+   *  fractions (`fr`) of the space left.
+   *  See https://developer.mozilla.org/en-US/docs/Web/CSS/grid-template-columns
+   *  for more details.
+   */
+  gridTemplateColumns?: string | $ReadOnlyArray<number | string>,
+  gridTemplateRows?: string | $ReadOnlyArray<number | string>,
+
+  /** `gridColumn` and `gridRow` place an item of a grid container between
+   *  lines, e.g. `2`, `'span 2'`, `'1 / span 2'` or `'1 / -1'`.
+   *  See https://developer.mozilla.org/en-US/docs/Web/CSS/grid-column
+   *  for more details.
+   */
+  gridColumn?: number | string,
+  gridRow?: number | string,
 }>;
 
 /**
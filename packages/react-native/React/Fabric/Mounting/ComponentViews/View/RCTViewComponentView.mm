@@ -324,12 +324,12 @@ using namespace facebook::react;
   // `accessibilityLanguage`
   if (oldViewProps.accessibilityLanguage != newViewProps.accessibilityLanguage) {
     self.accessibilityElement.accessibilityLanguage =
-        RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityLanguage);
+        RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityLanguage.get());
   }
 
   // `accessibilityHint`
   if (oldViewProps.accessibilityHint != newViewProps.accessibilityHint) {
-    self.accessibilityElement.accessibilityHint = RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityHint);
+    self.accessibilityElement.accessibilityHint = RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityHint.get());
   }
 
   // `accessibilityViewIsModal`
@@ -367,14 +367,13 @@ using namespace facebook::react;
 
   // `accessibilityValue`
   if (oldViewProps.accessibilityValue != newViewProps.accessibilityValue) {
-    if (newViewProps.accessibilityValue.text.has_value()) {
-      self.accessibilityElement.accessibilityValue =
-          RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityValue.text.value());
+    const auto &accessibilityValue = newViewProps.accessibilityValue.get();
+    if (accessibilityValue.text.has_value()) {
+      self.accessibilityElement.accessibilityValue = RCTNSStringFromStringNilIfEmpty(accessibilityValue.text.value());
     } else if (
-        newViewProps.accessibilityValue.now.has_value() && newViewProps.accessibilityValue.min.has_value() &&
-        newViewProps.accessibilityValue.max.has_value()) {
-      CGFloat val = (CGFloat)(newViewProps.accessibilityValue.now.value()) /
-          (newViewProps.accessibilityValue.max.value() - newViewProps.accessibilityValue.min.value());
+        accessibilityValue.now.has_value() && accessibilityValue.min.has_value() && accessibilityValue.max.has_value()) {
+      CGFloat val =
+          (CGFloat)(accessibilityValue.now.value()) / (accessibilityValue.max.value() - accessibilityValue.min.value());
       self.accessibilityElement.accessibilityValue =
           [NSNumberFormatter localizedStringFromNumber:@(val) numberStyle:NSNumberFormatterPercentStyle];
       ;
@@ -852,7 +851,7 @@ static NSString *RCTRecursiveAccessibilityLabel(UIView *view)
 
 - (NSArray<UIAccessibilityCustomAction *> *)accessibilityCustomActions
 {
-  const auto &accessibilityActions = _props->accessibilityActions;
+  const auto &accessibilityActions = _props->accessibilityActions.get();
 
   if (accessibilityActions.empty()) {
     return nil;
@@ -63,6 +63,7 @@ val boostPathOverride = dependenciesPath ?: System.getenv("REACT_NATIVE_BOOST_PA
 val prefabHeadersDir = project.file("$buildDir/prefab-headers")
 
 // Native versions which are defined inside the version catalog (libs.versions.toml)
+val BENCHMARK_VERSION = libs.versions.benchmark.get()
 val BOOST_VERSION = libs.versions.boost.get()
 val DOUBLE_CONVERSION_VERSION = libs.versions.doubleconversion.get()
 val FMT_VERSION = libs.versions.fmt.get()
@@ -387,6 +388,24 @@ val prepareGtest by
       into(File(thirdPartyNdkDir, "googletest"))
     }
 
+val downloadBenchmark by
+    tasks.creating(Download::class) {
+      dependsOn(createNativeDepsDirectories)
+      src("https://github.com/google/benchmark/archive/refs/tags/v${BENCHMARK_VERSION}.tar.gz")
+      onlyIfModified(true)
+      overwrite(false)
+      retries(5)
+      dest(File(downloadsDir, "benchmark.tar.gz"))
+    }
+
+val prepareBenchmark by
+    tasks.registering(Copy::class) {
+      dependsOn(if (dependenciesPath != null) emptyList() else listOf(downloadBenchmark))
+      from(dependenciesPath ?: tarTree(downloadBenchmark.dest))
+      eachFile { this.path = (this.path.removePrefix("benchmark-${BENCHMARK_VERSION}/")) }
+      into(File(thirdPartyNdkDir, "benchmark"))
+    }
+
 // Prepare glog sources to be compiled, this task will perform steps that normally should've been
 // executed by automake. This way we can avoid dependencies on make/automake
 val prepareGlog by
@@ -466,6 +485,11 @@ fun enableWarningsAsErrors(): Boolean {
   return value?.toString()?.toBoolean() ?: false
 }
 
+fun enableYogaCompactNodes(): Boolean {
+  val value = project.properties["yogaCompactNodes"]
+  return value?.toString()?.toBoolean() ?: false
+}
+
 val packageReactNdkLibsForBuck by
     tasks.registering(Copy::class) {
       dependsOn("mergeDebugNativeLibs")
@@ -534,6 +558,7 @@ android {
             "-DREACT_BUILD_DIR=$buildDir",
             "-DANDROID_STL=c++_shared",
             "-DANDROID_TOOLCHAIN=clang",
+            "-DYOGA_COMPACT_NODES=${if (enableYogaCompactNodes()) "ON" else "OFF"}",
             // Due to https://github.com/android/ndk/issues/1693 we're losing Android
             // specific compilation flags. This can be removed once we moved to NDK 25/26
             "-DANDROID_USE_LEGACY_TOOLCHAIN_FILE=ON")
@@ -604,8 +629,9 @@ android {
     debug {
       externalNativeBuild {
         cmake {
-          // We want to build Gtest suite only for the debug variant.
-          targets("reactnative_unittest")
+          // We want to build Gtest and Google Benchmark suites only for the
+          // debug variant.
+          targets("reactnative_unittest", "reactnative_fabric_benchmark")
         }
       }
     }
@@ -616,6 +642,7 @@ android {
       .dependsOn(
           buildCodegenCLI,
           "generateCodegenArtifactsFromSchema",
+          prepareBenchmark,
           prepareBoost,
           prepareDoubleConversion,
           prepareFmt,
@@ -15,7 +15,9 @@ public enum LayoutPassReason {
   FLEX_LAYOUT(4),
   MEASURE(5),
   ABS_MEASURE(6),
-  FLEX_MEASURE(7);
+  FLEX_MEASURE(7),
+  GRID_MEASURE(8),
+  GRID_LAYOUT(9);
 
   private final int mIntValue;
 
@@ -37,6 +39,8 @@ public enum LayoutPassReason {
       case 5: return MEASURE;
       case 6: return ABS_MEASURE;
       case 7: return FLEX_MEASURE;
+      case 8: return GRID_MEASURE;
+      case 9: return GRID_LAYOUT;
       default: throw new IllegalArgumentException("Unknown enum value: " + value);
     }
   }
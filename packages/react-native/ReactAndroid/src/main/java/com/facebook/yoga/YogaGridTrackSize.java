@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.yoga;
+
+/** Size of a row or column track of a grid container. */
+public class YogaGridTrackSize {
+  static final YogaGridTrackSize AUTO = new YogaGridTrackSize(0, YogaGridTrackUnit.AUTO);
+
+  public final float value;
+  public final YogaGridTrackUnit unit;
+
+  public YogaGridTrackSize(float value, YogaGridTrackUnit unit) {
+    this.value = value;
+    this.unit = unit;
+  }
+
+  YogaGridTrackSize(float value, int unit) {
+    this(value, YogaGridTrackUnit.fromInt(unit));
+  }
+
+  @Override
+  public boolean equals(Object other) {
+    if (other instanceof YogaGridTrackSize) {
+      final YogaGridTrackSize otherSize = (YogaGridTrackSize) other;
+      if (unit == otherSize.unit) {
+        return unit == YogaGridTrackUnit.AUTO || Float.compare(value, otherSize.value) == 0;
+      }
+    }
+    return false;
+  }
+
+  @Override
+  public int hashCode() {
+    return Float.floatToIntBits(value) + unit.intValue();
+  }
+
+  @Override
+  public String toString() {
+    switch (unit) {
+      case AUTO:
+        return "auto";
+      case POINT:
+        return Float.toString(value);
+      case PERCENT:
+        return value + "%";
+      case FRACTION:
+        return value + "fr";
+      default:
+        throw new IllegalStateException();
+    }
+  }
+}
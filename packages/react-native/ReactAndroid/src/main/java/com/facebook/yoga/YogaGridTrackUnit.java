@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// @generated by enums.py
+
+package com.facebook.yoga;
+
+public enum YogaGridTrackUnit {
+  AUTO(0),
+  POINT(1),
+  PERCENT(2),
+  FRACTION(3);
+
+  private final int mIntValue;
+
+  YogaGridTrackUnit(int intValue) {
+    mIntValue = intValue;
+  }
+
+  public int intValue() {
+    return mIntValue;
+  }
+
+  public static YogaGridTrackUnit fromInt(int value) {
+    switch (value) {
+      case 0: return AUTO;
+      case 1: return POINT;
+      case 2: return PERCENT;
+      case 3: return FRACTION;
+      default: throw new IllegalArgumentException("Unknown enum value: " + value);
+    }
+  }
+}
@@ -109,6 +109,24 @@ public class YogaNative {
   static native float jni_YGNodeStyleGetGapJNI(long nativePointer, int gutter);
   static native void jni_YGNodeStyleSetGapJNI(long nativePointer, int gutter, float gapLength);
   static native void jni_YGNodeStyleSetGapPercentJNI(long nativePointer, int gutter, float gapLength);
+  static native void jni_YGNodeStyleSetGridTemplateColumnsJNI(long nativePointer, float[] values, int[] units);
+  static native int jni_YGNodeStyleGetGridTemplateColumnCountJNI(long nativePointer);
+  static native void jni_YGNodeStyleGetGridTemplateColumnsJNI(long nativePointer, float[] values, int[] units);
+  static native void jni_YGNodeStyleSetGridTemplateRowsJNI(long nativePointer, float[] values, int[] units);
+  static native int jni_YGNodeStyleGetGridTemplateRowCountJNI(long nativePointer);
+  static native void jni_YGNodeStyleGetGridTemplateRowsJNI(long nativePointer, float[] values, int[] units);
+  static native int jni_YGNodeStyleGetGridColumnStartJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridColumnStartJNI(long nativePointer, int line);
+  static native int jni_YGNodeStyleGetGridColumnEndJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridColumnEndJNI(long nativePointer, int line);
+  static native int jni_YGNodeStyleGetGridColumnSpanJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridColumnSpanJNI(long nativePointer, int span);
+  static native int jni_YGNodeStyleGetGridRowStartJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridRowStartJNI(long nativePointer, int line);
+  static native int jni_YGNodeStyleGetGridRowEndJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridRowEndJNI(long nativePointer, int line);
+  static native int jni_YGNodeStyleGetGridRowSpanJNI(long nativePointer);
+  static native void jni_YGNodeStyleSetGridRowSpanJNI(long nativePointer, int span);
   static native void jni_YGNodeSetHasMeasureFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetHasBaselineFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetStyleInputsJNI(long nativePointer, float[] styleInputsArray, int size);
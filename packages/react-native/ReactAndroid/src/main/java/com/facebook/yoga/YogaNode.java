@@ -194,6 +194,38 @@ public abstract class YogaNode implements YogaProps {
 
   public abstract void setGapPercent(YogaGutter gutter, float gapLength);
 
+  public abstract YogaGridTrackSize[] getGridTemplateColumns();
+
+  public abstract void setGridTemplateColumns(YogaGridTrackSize... tracks);
+
+  public abstract YogaGridTrackSize[] getGridTemplateRows();
+
+  public abstract void setGridTemplateRows(YogaGridTrackSize... tracks);
+
+  public abstract int getGridColumnStart();
+
+  public abstract void setGridColumnStart(int line);
+
+  public abstract int getGridColumnEnd();
+
+  public abstract void setGridColumnEnd(int line);
+
+  public abstract int getGridColumnSpan();
+
+  public abstract void setGridColumnSpan(int span);
+
+  public abstract int getGridRowStart();
+
+  public abstract void setGridRowStart(int line);
+
+  public abstract int getGridRowEnd();
+
+  public abstract void setGridRowEnd(int line);
+
+  public abstract int getGridRowSpan();
+
+  public abstract void setGridRowSpan(int span);
+
   public abstract float getLayoutX();
 
   public abstract float getLayoutY();
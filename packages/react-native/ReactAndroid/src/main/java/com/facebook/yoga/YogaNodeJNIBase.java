@@ -726,4 +726,113 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
   public void setGapPercent(YogaGutter gutter, float gapLength) {
     YogaNative.jni_YGNodeStyleSetGapPercentJNI(mNativePointer, gutter.intValue(), gapLength);
   }
+
+  @Override
+  public YogaGridTrackSize[] getGridTemplateColumns() {
+    int count = YogaNative.jni_YGNodeStyleGetGridTemplateColumnCountJNI(mNativePointer);
+    float[] values = new float[count];
+    int[] units = new int[count];
+    YogaNative.jni_YGNodeStyleGetGridTemplateColumnsJNI(mNativePointer, values, units);
+    return gridTracks(values, units);
+  }
+
+  @Override
+  public void setGridTemplateColumns(YogaGridTrackSize... tracks) {
+    float[] values = new float[tracks.length];
+    int[] units = new int[tracks.length];
+    fillGridTracks(tracks, values, units);
+    YogaNative.jni_YGNodeStyleSetGridTemplateColumnsJNI(mNativePointer, values, units);
+  }
+
+  @Override
+  public YogaGridTrackSize[] getGridTemplateRows() {
+    int count = YogaNative.jni_YGNodeStyleGetGridTemplateRowCountJNI(mNativePointer);
+    float[] values = new float[count];
+    int[] units = new int[count];
+    YogaNative.jni_YGNodeStyleGetGridTemplateRowsJNI(mNativePointer, values, units);
+    return gridTracks(values, units);
+  }
+
+  @Override
+  public void setGridTemplateRows(YogaGridTrackSize... tracks) {
+    float[] values = new float[tracks.length];
+    int[] units = new int[tracks.length];
+    fillGridTracks(tracks, values, units);
+    YogaNative.jni_YGNodeStyleSetGridTemplateRowsJNI(mNativePointer, values, units);
+  }
+
+  @Override
+  public int getGridColumnStart() {
+    return YogaNative.jni_YGNodeStyleGetGridColumnStartJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridColumnStart(int line) {
+    YogaNative.jni_YGNodeStyleSetGridColumnStartJNI(mNativePointer, line);
+  }
+
+  @Override
+  public int getGridColumnEnd() {
+    return YogaNative.jni_YGNodeStyleGetGridColumnEndJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridColumnEnd(int line) {
+    YogaNative.jni_YGNodeStyleSetGridColumnEndJNI(mNativePointer, line);
+  }
+
+  @Override
+  public int getGridColumnSpan() {
+    return YogaNative.jni_YGNodeStyleGetGridColumnSpanJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridColumnSpan(int span) {
+    YogaNative.jni_YGNodeStyleSetGridColumnSpanJNI(mNativePointer, span);
+  }
+
+  @Override
+  public int getGridRowStart() {
+    return YogaNative.jni_YGNodeStyleGetGridRowStartJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridRowStart(int line) {
+    YogaNative.jni_YGNodeStyleSetGridRowStartJNI(mNativePointer, line);
+  }
+
+  @Override
+  public int getGridRowEnd() {
+    return YogaNative.jni_YGNodeStyleGetGridRowEndJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridRowEnd(int line) {
+    YogaNative.jni_YGNodeStyleSetGridRowEndJNI(mNativePointer, line);
+  }
+
+  @Override
+  public int getGridRowSpan() {
+    return YogaNative.jni_YGNodeStyleGetGridRowSpanJNI(mNativePointer);
+  }
+
+  @Override
+  public void setGridRowSpan(int span) {
+    YogaNative.jni_YGNodeStyleSetGridRowSpanJNI(mNativePointer, span);
+  }
+
+  private static YogaGridTrackSize[] gridTracks(float[] values, int[] units) {
+    YogaGridTrackSize[] tracks = new YogaGridTrackSize[values.length];
+    for (int i = 0; i < values.length; i++) {
+      tracks[i] = new YogaGridTrackSize(values[i], units[i]);
+    }
+    return tracks;
+  }
+
+  private static void fillGridTracks(YogaGridTrackSize[] tracks, float[] values, int[] units) {
+    for (int i = 0; i < tracks.length; i++) {
+      values[i] = tracks[i].value;
+      units[i] = tracks[i].unit.intValue();
+    }
+  }
 }
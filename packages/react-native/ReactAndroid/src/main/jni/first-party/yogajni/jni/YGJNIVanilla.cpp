@@ -10,6 +10,7 @@
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <vector>
 #include "LayoutContext.h"
 #include "YGJNI.h"
 #include "YGJTypesVanilla.h"
@@ -727,6 +728,63 @@ static void jni_YGNodeStyleSetGapPercentJNI(
       static_cast<float>(gapLength));
 }
 
+#define YG_NODE_JNI_STYLE_GRID_TEMPLATE_PROP(name)                             \
+  static void jni_YGNodeStyleSetGridTemplate##name##sJNI(                      \
+      JNIEnv* env,                                                             \
+      jobject /*obj*/,                                                         \
+      jlong nativePointer,                                                     \
+      jfloatArray values,                                                      \
+      jintArray units) {                                                       \
+    const jsize count = env->GetArrayLength(values);                           \
+    std::vector<jfloat> trackValues(static_cast<size_t>(count));               \
+    std::vector<jint> trackUnits(static_cast<size_t>(count));                  \
+    env->GetFloatArrayRegion(values, 0, count, trackValues.data());            \
+    env->GetIntArrayRegion(units, 0, count, trackUnits.data());                \
+    std::vector<YGGridTrackSize> tracks;                                       \
+    tracks.reserve(trackValues.size());                                        \
+    for (size_t i = 0; i < trackValues.size(); i++) {                          \
+      tracks.push_back(                                                        \
+          {static_cast<float>(trackValues[i]),                                 \
+           static_cast<YGGridTrackUnit>(trackUnits[i])});                      \
+    }                                                                          \
+    YGNodeStyleSetGridTemplate##name##s(                                       \
+        _jlong2YGNodeRef(nativePointer), tracks.data(), tracks.size());        \
+  }                                                                            \
+                                                                               \
+  static jint jni_YGNodeStyleGetGridTemplate##name##CountJNI(                  \
+      JNIEnv* /*env*/, jobject /*obj*/, jlong nativePointer) {                 \
+    return (jint)YGNodeStyleGetGridTemplate##name##Count(                      \
+        _jlong2YGNodeRef(nativePointer));                                      \
+  }                                                                            \
+                                                                               \
+  static void jni_YGNodeStyleGetGridTemplate##name##sJNI(                      \
+      JNIEnv* env,                                                             \
+      jobject /*obj*/,                                                         \
+      jlong nativePointer,                                                     \
+      jfloatArray values,                                                      \
+      jintArray units) {                                                       \
+    const YGNodeConstRef node = _jlong2YGNodeRef(nativePointer);               \
+    const jsize count = env->GetArrayLength(values);                           \
+    std::vector<jfloat> trackValues(static_cast<size_t>(count));               \
+    std::vector<jint> trackUnits(static_cast<size_t>(count));                  \
+    for (size_t i = 0; i < trackValues.size(); i++) {                          \
+      const YGGridTrackSize track = YGNodeStyleGetGridTemplate##name(node, i); \
+      trackValues[i] = track.value;                                            \
+      trackUnits[i] = track.unit;                                              \
+    }                                                                          \
+    env->SetFloatArrayRegion(values, 0, count, trackValues.data());            \
+    env->SetIntArrayRegion(units, 0, count, trackUnits.data());                \
+  }
+
+YG_NODE_JNI_STYLE_GRID_TEMPLATE_PROP(Column);
+YG_NODE_JNI_STYLE_GRID_TEMPLATE_PROP(Row);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridColumnStart);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridColumnEnd);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridColumnSpan);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridRowStart);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridRowEnd);
+YG_NODE_JNI_STYLE_PROP(jint, int, GridRowSpan);
+
 // Yoga specific properties, not compatible with flexbox specification
 YG_NODE_JNI_STYLE_PROP(jfloat, float, AspectRatio);
 
@@ -945,6 +1003,60 @@ static JNINativeMethod methods[] = {
     {"jni_YGNodeStyleSetMaxHeightPercentJNI",
      "(JF)V",
      (void*)jni_YGNodeStyleSetMaxHeightPercentJNI},
+    {"jni_YGNodeStyleSetGridTemplateColumnsJNI",
+     "(J[F[I)V",
+     (void*)jni_YGNodeStyleSetGridTemplateColumnsJNI},
+    {"jni_YGNodeStyleGetGridTemplateColumnCountJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridTemplateColumnCountJNI},
+    {"jni_YGNodeStyleGetGridTemplateColumnsJNI",
+     "(J[F[I)V",
+     (void*)jni_YGNodeStyleGetGridTemplateColumnsJNI},
+    {"jni_YGNodeStyleSetGridTemplateRowsJNI",
+     "(J[F[I)V",
+     (void*)jni_YGNodeStyleSetGridTemplateRowsJNI},
+    {"jni_YGNodeStyleGetGridTemplateRowCountJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridTemplateRowCountJNI},
+    {"jni_YGNodeStyleGetGridTemplateRowsJNI",
+     "(J[F[I)V",
+     (void*)jni_YGNodeStyleGetGridTemplateRowsJNI},
+    {"jni_YGNodeStyleGetGridColumnStartJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridColumnStartJNI},
+    {"jni_YGNodeStyleSetGridColumnStartJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridColumnStartJNI},
+    {"jni_YGNodeStyleGetGridColumnEndJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridColumnEndJNI},
+    {"jni_YGNodeStyleSetGridColumnEndJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridColumnEndJNI},
+    {"jni_YGNodeStyleGetGridColumnSpanJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridColumnSpanJNI},
+    {"jni_YGNodeStyleSetGridColumnSpanJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridColumnSpanJNI},
+    {"jni_YGNodeStyleGetGridRowStartJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridRowStartJNI},
+    {"jni_YGNodeStyleSetGridRowStartJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridRowStartJNI},
+    {"jni_YGNodeStyleGetGridRowEndJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridRowEndJNI},
+    {"jni_YGNodeStyleSetGridRowEndJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridRowEndJNI},
+    {"jni_YGNodeStyleGetGridRowSpanJNI",
+     "(J)I",
+     (void*)jni_YGNodeStyleGetGridRowSpanJNI},
+    {"jni_YGNodeStyleSetGridRowSpanJNI",
+     "(JI)V",
+     (void*)jni_YGNodeStyleSetGridRowSpanJNI},
     {"jni_YGNodeStyleGetAspectRatioJNI",
      "(J)F",
      (void*)jni_YGNodeStyleGetAspectRatioJNI},
@@ -14,6 +14,7 @@ import com.facebook.yoga.YogaDirection
 import com.facebook.yoga.YogaDisplay
 import com.facebook.yoga.YogaEdge
 import com.facebook.yoga.YogaFlexDirection
+import com.facebook.yoga.YogaGridTrackSize
 import com.facebook.yoga.YogaGutter
 import com.facebook.yoga.YogaJustify
 import com.facebook.yoga.YogaMeasureFunction
@@ -221,6 +222,54 @@ class FakeYogaNode : YogaNode() {
     // no-op
   }
 
+  override fun getGridTemplateColumns(): Array<YogaGridTrackSize> = emptyArray()
+
+  override fun setGridTemplateColumns(vararg tracks: YogaGridTrackSize?) {
+    // no-op
+  }
+
+  override fun getGridTemplateRows(): Array<YogaGridTrackSize> = emptyArray()
+
+  override fun setGridTemplateRows(vararg tracks: YogaGridTrackSize?) {
+    // no-op
+  }
+
+  override fun getGridColumnStart(): Int = 0
+
+  override fun setGridColumnStart(line: Int) {
+    // no-op
+  }
+
+  override fun getGridColumnEnd(): Int = 0
+
+  override fun setGridColumnEnd(line: Int) {
+    // no-op
+  }
+
+  override fun getGridColumnSpan(): Int = 1
+
+  override fun setGridColumnSpan(span: Int) {
+    // no-op
+  }
+
+  override fun getGridRowStart(): Int = 0
+
+  override fun setGridRowStart(line: Int) {
+    // no-op
+  }
+
+  override fun getGridRowEnd(): Int = 0
+
+  override fun setGridRowEnd(line: Int) {
+    // no-op
+  }
+
+  override fun getGridRowSpan(): Int = 1
+
+  override fun setGridRowSpan(span: Int) {
+    // no-op
+  }
+
   override fun getLayoutX(): Float = 0f
 
   override fun getLayoutY(): Float = 0f
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/NativeModule.h>
 #include <folly/dynamic.h>
 #include <jsinspector-modern/InspectorInterfaces.h>
@@ -40,6 +41,15 @@ class ExecutorDelegate {
       JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) = 0;
+
+  // Same as above, for calls which the executor has already decoded (see
+  // `parseMethodCalls`). The default implementation encodes the calls back
+  // into the message queue format.
+  virtual void callNativeModules(
+      JSExecutor& executor,
+      std::vector<MethodCall>&& calls,
+      bool isEndOfBatch);
+
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor& executor,
       unsigned int moduleId,
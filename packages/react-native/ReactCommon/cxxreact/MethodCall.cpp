@@ -8,6 +8,9 @@
 #include "MethodCall.h"
 
 #include <folly/json.h>
+#include <jsi/JSIDynamic.h>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
 
 namespace facebook::react {
@@ -84,4 +87,117 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic&& jsonData) {
   return methodCalls;
 }
 
+static bool isArray(jsi::Runtime& runtime, const jsi::Value& value) {
+  return value.isObject() && value.getObject(runtime).isArray(runtime);
+}
+
+static const char* typeName(jsi::Runtime& runtime, const jsi::Value& value) {
+  if (value.isUndefined()) {
+    return "undefined";
+  } else if (value.isNull()) {
+    return "null";
+  } else if (value.isBool()) {
+    return "boolean";
+  } else if (value.isNumber()) {
+    return "number";
+  } else if (value.isString()) {
+    return "string";
+  } else if (isArray(runtime, value)) {
+    return "array";
+  }
+  return "object";
+}
+
+// Converts a number the way folly::dynamic::asInt() does, throwing instead
+// of truncating NaN, infinities, fractions and out-of-range values.
+static int
+toInt(jsi::Runtime& runtime, const jsi::Value& value, const char* name) {
+  // Same message as the folly::dynamic parser's for callId.
+  if (!value.isNumber()) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "invalid ", name, typeName(runtime, value)));
+  }
+  auto number = value.getNumber();
+  if (!std::isfinite(number) || std::trunc(number) != number ||
+      number < std::numeric_limits<int>::min() ||
+      number > std::numeric_limits<int>::max()) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "invalid ", name, " ", number));
+  }
+  return static_cast<int>(number);
+}
+
+std::vector<MethodCall> parseMethodCalls(
+    jsi::Runtime& runtime,
+    const jsi::Value& calls) {
+  if (calls.isNull() || calls.isUndefined()) {
+    return {};
+  }
+
+  if (!isArray(runtime, calls)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "input isn't array but ", typeName(runtime, calls)));
+  }
+
+  auto queue = calls.getObject(runtime).getArray(runtime);
+  auto queueSize = queue.size(runtime);
+  if (queueSize < REQUEST_PARAMS + 1) {
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "size == ", queueSize));
+  }
+
+  auto moduleIdsValue = queue.getValueAtIndex(runtime, REQUEST_MODULE_IDS);
+  auto methodIdsValue = queue.getValueAtIndex(runtime, REQUEST_METHOD_IDS);
+  auto paramsValue = queue.getValueAtIndex(runtime, REQUEST_PARAMS);
+  int callId = -1;
+
+  if (!isArray(runtime, moduleIdsValue) || !isArray(runtime, methodIdsValue) ||
+      !isArray(runtime, paramsValue)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix,
+        "not all fields are arrays.\n\n",
+        folly::toJson(jsi::dynamicFromValue(runtime, calls))));
+  }
+
+  auto moduleIds = moduleIdsValue.getObject(runtime).getArray(runtime);
+  auto methodIds = methodIdsValue.getObject(runtime).getArray(runtime);
+  auto params = paramsValue.getObject(runtime).getArray(runtime);
+  auto size = moduleIds.size(runtime);
+
+  if (size != methodIds.size(runtime) || size != params.size(runtime)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix,
+        "field sizes are different.\n\n",
+        folly::toJson(jsi::dynamicFromValue(runtime, calls))));
+  }
+
+  if (queueSize > REQUEST_CALLID) {
+    callId = toInt(
+        runtime, queue.getValueAtIndex(runtime, REQUEST_CALLID), "callId");
+  }
+
+  std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    auto arguments = params.getValueAtIndex(runtime, i);
+    if (!isArray(runtime, arguments)) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix,
+          "method arguments isn't array but ",
+          typeName(runtime, arguments)));
+    }
+
+    methodCalls.emplace_back(
+        toInt(runtime, moduleIds.getValueAtIndex(runtime, i), "moduleId"),
+        toInt(runtime, methodIds.getValueAtIndex(runtime, i), "methodId"),
+        jsi::dynamicFromValue(runtime, arguments),
+        callId);
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  return methodCalls;
+}
+
 } // namespace facebook::react
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include <folly/dynamic.h>
+#include <jsi/jsi.h>
 
 namespace facebook::react {
 
@@ -31,4 +32,12 @@ struct MethodCall {
 /// \throws std::invalid_argument
 std::vector<MethodCall> parseMethodCalls(folly::dynamic&& calls);
 
+/// Decodes calls straight from the JS message queue (as returned by
+/// `flushedQueue`), without converting the whole batch to `folly::dynamic`
+/// first. Only arguments of every call are converted, once.
+/// \throws std::invalid_argument
+std::vector<MethodCall> parseMethodCalls(
+    jsi::Runtime& runtime,
+    const jsi::Value& calls);
+
 } // namespace facebook::react
@@ -58,7 +58,38 @@ class JsToNativeBridge : public react::ExecutorDelegate {
     m_batchHadNativeModuleOrTurboModuleCalls =
         m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
 
-    std::vector<MethodCall> methodCalls = parseMethodCalls(std::move(calls));
+    callNativeMethods(parseMethodCalls(std::move(calls)), isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor& executor,
+      std::vector<MethodCall>&& calls,
+      bool isEndOfBatch) override {
+    CHECK(m_registry || calls.empty())
+        << "native module calls cannot be completed with no native modules";
+    m_batchHadNativeModuleOrTurboModuleCalls =
+        m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
+
+    callNativeMethods(std::move(calls), isEndOfBatch);
+  }
+
+  MethodCallResult callSerializableNativeHook(
+      [[maybe_unused]] JSExecutor& executor,
+      unsigned int moduleId,
+      unsigned int methodId,
+      folly::dynamic&& args) override {
+    return m_registry->callSerializableNativeHook(
+        moduleId, methodId, std::move(args));
+  }
+
+  void recordTurboModuleAsyncMethodCall() noexcept {
+    m_batchHadNativeModuleOrTurboModuleCalls = true;
+  }
+
+ private:
+  void callNativeMethods(
+      std::vector<MethodCall>&& methodCalls,
+      bool isEndOfBatch) {
     BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
         (int)methodCalls.size());
 
@@ -82,20 +113,6 @@ class JsToNativeBridge : public react::ExecutorDelegate {
     }
   }
 
-  MethodCallResult callSerializableNativeHook(
-      [[maybe_unused]] JSExecutor& executor,
-      unsigned int moduleId,
-      unsigned int methodId,
-      folly::dynamic&& args) override {
-    return m_registry->callSerializableNativeHook(
-        moduleId, methodId, std::move(args));
-  }
-
-  void recordTurboModuleAsyncMethodCall() noexcept {
-    m_batchHadNativeModuleOrTurboModuleCalls = true;
-  }
-
- private:
   // These methods are always invoked from an Executor.  The NativeToJsBridge
   // keeps a reference to the executor, and when destroy() is called, the
   // executor is destroyed synchronously on its queue.
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/MethodCall.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+
+namespace facebook::react {
+
+/*
+ * Builds a message queue, as returned by `flushedQueue`, of `callCount` calls
+ * with a mix of typical arguments.
+ */
+static jsi::Value makeQueue(jsi::Runtime& runtime, int callCount) {
+  auto source = std::string{R"(
+    (function (callCount) {
+      var moduleIds = [], methodIds = [], params = [];
+      for (var i = 0; i < callCount; i++) {
+        moduleIds.push(i % 32);
+        methodIds.push(i % 8);
+        switch (i % 4) {
+          case 0: params.push([]); break;
+          case 1: params.push([i, 'event' + i, true]); break;
+          case 2: params.push([{tag: i, x: 1.5, y: 2.5, name: 'view'}, i]); break;
+          default: params.push([[1, 2, 3, 4], {nested: {value: null}}]);
+        }
+      }
+      return [moduleIds, methodIds, params, 1];
+    })
+  )"};
+  auto function =
+      runtime
+          .evaluateJavaScript(
+              std::make_shared<jsi::StringBuffer>(std::move(source)),
+              "makeQueue.js")
+          .asObject(runtime)
+          .asFunction(runtime);
+  return function.call(runtime, callCount);
+}
+
+static void decodeViaDynamic(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto callCount = static_cast<int>(state.range(0));
+  auto queue = makeQueue(*runtime, callCount);
+
+  for (auto _ : state) {
+    auto calls = parseMethodCalls(jsi::dynamicFromValue(*runtime, queue));
+    benchmark::DoNotOptimize(calls);
+  }
+  state.SetItemsProcessed(state.iterations() * callCount);
+}
+BENCHMARK(decodeViaDynamic)->Arg(16)->Arg(256)->Arg(4096);
+
+static void decodeInPlace(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto callCount = static_cast<int>(state.range(0));
+  auto queue = makeQueue(*runtime, callCount);
+
+  for (auto _ : state) {
+    auto calls = parseMethodCalls(*runtime, queue);
+    benchmark::DoNotOptimize(calls);
+  }
+  state.SetItemsProcessed(state.iterations() * callCount);
+}
+BENCHMARK(decodeInPlace)->Arg(16)->Arg(256)->Arg(4096);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
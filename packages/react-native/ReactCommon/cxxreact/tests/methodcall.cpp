@@ -8,6 +8,8 @@
 #include <cxxreact/MethodCall.h>
 
 #include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsign-compare"
 #include <gtest/gtest.h>
@@ -153,3 +155,48 @@ TEST(parseMethodCalls, ParseTwoCalls) {
   auto returnedCalls = parseMethodCalls(folly::parseJson(jsText));
   EXPECT_EQ(2, returnedCalls.size());
 }
+
+TEST(parseMethodCalls, DecodesJSIValuesLikeDynamic) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto jsText =
+      "[[7, 2],[3, 4],"
+      "[[{\"foo\": \"hello\", \"bar\": [4, null]}], [true]], 12]";
+  auto queue =
+      facebook::jsi::valueFromDynamic(*runtime, folly::parseJson(jsText));
+
+  auto expectedCalls = parseMethodCalls(folly::parseJson(jsText));
+  auto returnedCalls = parseMethodCalls(*runtime, queue);
+  ASSERT_EQ(expectedCalls.size(), returnedCalls.size());
+  for (size_t i = 0; i < returnedCalls.size(); i++) {
+    EXPECT_EQ(expectedCalls[i].moduleId, returnedCalls[i].moduleId);
+    EXPECT_EQ(expectedCalls[i].methodId, returnedCalls[i].methodId);
+    EXPECT_EQ(expectedCalls[i].arguments, returnedCalls[i].arguments);
+    EXPECT_EQ(expectedCalls[i].callId, returnedCalls[i].callId);
+  }
+
+  EXPECT_TRUE(
+      parseMethodCalls(*runtime, facebook::jsi::Value::null()).empty());
+  EXPECT_THROW(
+      parseMethodCalls(
+          *runtime,
+          facebook::jsi::valueFromDynamic(
+              *runtime, folly::parseJson("[[0],[0,1],[[],[]]]"))),
+      std::invalid_argument);
+
+TEST(parseMethodCalls, RejectsJSIValuesThatAreNotInts) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto parse = [&](const char* js) {
+    return parseMethodCalls(
+        *runtime, runtime->evaluateJavaScript(
+                      std::make_shared<facebook::jsi::StringBuffer>(js), ""));
+  };
+
+  EXPECT_EQ(7, parse("[[7],[3],[[]],1e9]")[0].moduleId);
+  EXPECT_THROW(parse("[[NaN],[3],[[]]]"), std::invalid_argument);
+  EXPECT_THROW(parse("[[7],[Infinity],[[]]]"), std::invalid_argument);
+  EXPECT_THROW(parse("[[7.5],[3],[[]]]"), std::invalid_argument);
+  EXPECT_THROW(parse("[[1e10],[3],[[]]]"), std::invalid_argument);
+  EXPECT_THROW(parse("[['7'],[3],[[]]]"), std::invalid_argument);
+  EXPECT_THROW(parse("[[7],[3],[[]],-Infinity]"), std::invalid_argument);
+  EXPECT_THROW(parse("[[7],[3],[[]],'1']"), std::invalid_argument);
+}
@@ -1120,7 +1120,21 @@ jsi::Array JSCRuntime::createArray(size_t length) {
 
 jsi::ArrayBuffer JSCRuntime::createArrayBuffer(
     std::shared_ptr<jsi::MutableBuffer> buffer) {
-  throw std::logic_error("Not implemented");
+  // The ArrayBuffer owns a reference to `buffer` until it is collected.
+  auto* owner = new std::shared_ptr<jsi::MutableBuffer>(std::move(buffer));
+  JSValueRef exc = nullptr;
+  JSObjectRef obj = JSObjectMakeArrayBufferWithBytesNoCopy(
+      ctx_,
+      (*owner)->data(),
+      (*owner)->size(),
+      [](void* /*bytes*/, void* deallocatorContext) {
+        delete static_cast<std::shared_ptr<jsi::MutableBuffer>*>(
+            deallocatorContext);
+      },
+      owner,
+      &exc);
+  checkException(obj, exc);
+  return createObject(obj).getArrayBuffer(*this);
 }
 
 size_t JSCRuntime::size(const jsi::Array& arr) {
@@ -9,6 +9,7 @@
 
 #include <cxxreact/ErrorUtils.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/ModuleRegistry.h>
 #include <cxxreact/ReactMarker.h>
 #include <cxxreact/SystraceSection.h>
@@ -391,7 +392,7 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
   delegate_->callNativeModules(
-      *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
+      *this, parseMethodCalls(*runtime_, queue), isEndOfBatch);
 }
 
 void JSIExecutor::flush() {
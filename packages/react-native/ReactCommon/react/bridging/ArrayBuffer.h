@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+namespace bridging {
+
+// A vector of numbers which is passed to JS as an ArrayBuffer holding the
+// elements instead of as an Array, and can be created from an ArrayBuffer,
+// typed array or DataView. Passing a vector to JS moves its storage into the
+// ArrayBuffer without copying, which needs a runtime implementing
+// jsi::Runtime::createArrayBuffer (Hermes and JSC do). Elements use the native
+// byte order.
+template <typename T>
+struct ArrayBufferVector {
+  static_assert(std::is_arithmetic_v<T>, "Elements must be numbers");
+
+  std::vector<T> values;
+};
+
+// Like ArrayBufferVector, but passed to JS as the typed array matching T
+// (e.g. Float64Array for double) viewing the ArrayBuffer.
+template <typename T>
+struct TypedArrayVector {
+  static_assert(std::is_arithmetic_v<T>, "Elements must be numbers");
+
+  std::vector<T> values;
+};
+
+} // namespace bridging
+
+namespace array_buffer_detail {
+
+template <typename T>
+class VectorBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<T> values) : values_(std::move(values)) {}
+
+  size_t size() const override {
+    return values_.size() * sizeof(T);
+  }
+
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(values_.data());
+  }
+
+ private:
+  std::vector<T> values_;
+};
+
+template <typename T>
+constexpr const char* typedArrayConstructorName() {
+  if constexpr (std::is_same_v<T, double>) {
+    return "Float64Array";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "Float32Array";
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) == 8) {
+    return std::is_signed_v<T> ? "BigInt64Array" : "BigUint64Array";
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) == 4) {
+    return std::is_signed_v<T> ? "Int32Array" : "Uint32Array";
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) == 2) {
+    return std::is_signed_v<T> ? "Int16Array" : "Uint16Array";
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) == 1) {
+    return std::is_signed_v<T> ? "Int8Array" : "Uint8Array";
+  } else {
+    static_assert(!sizeof(T), "No typed array for this element type");
+  }
+}
+
+template <typename T>
+jsi::ArrayBuffer toArrayBuffer(jsi::Runtime& rt, std::vector<T> values) {
+  return jsi::ArrayBuffer(
+      rt, std::make_shared<VectorBuffer<T>>(std::move(values)));
+}
+
+// Reads the `byteOffset` or `byteLength` property of an ArrayBuffer view.
+// These can be redefined from JavaScript, so anything but a non-negative
+// integer that fits a size_t is rejected.
+inline size_t getByteCount(
+    jsi::Runtime& rt,
+    const jsi::Object& view,
+    const char* name) {
+  // Byte counts of real buffers are safe integers (below 2^53).
+  constexpr double kMaxByteCount = std::min(
+      9007199254740992.0,
+      static_cast<double>(std::numeric_limits<size_t>::max()));
+
+  auto value = view.getProperty(rt, name);
+  auto number = value.isNumber() ? value.getNumber() : -1.0;
+  if (!(number >= 0 && number < kMaxByteCount) ||
+      std::trunc(number) != number) {
+    throw jsi::JSError(
+        rt, std::string("Invalid ") + name + " of ArrayBuffer view");
+  }
+  return static_cast<size_t>(number);
+}
+
+inline bool isArrayBufferView(jsi::Runtime& rt, const jsi::Object& object) {
+  return rt.global()
+      .getPropertyAsObject(rt, "ArrayBuffer")
+      .getPropertyAsFunction(rt, "isView")
+      .call(rt, jsi::Value(rt, object))
+      .asBool();
+}
+
+template <typename T>
+std::vector<T> fromArrayBufferOrView(
+    jsi::Runtime& rt,
+    const jsi::Object& object) {
+  const uint8_t* data = nullptr;
+  size_t byteLength = 0;
+
+  if (object.isArrayBuffer(rt)) {
+    auto buffer = object.getArrayBuffer(rt);
+    data = buffer.data(rt);
+    byteLength = buffer.size(rt);
+  } else {
+    // Typed arrays and DataViews expose the viewed range of their buffer.
+    if (!isArrayBufferView(rt, object)) {
+      throw jsi::JSError(rt, "Expected an ArrayBuffer or a typed array");
+    }
+    auto bufferValue = object.getProperty(rt, "buffer");
+    if (!bufferValue.isObject() ||
+        !bufferValue.getObject(rt).isArrayBuffer(rt)) {
+      throw jsi::JSError(rt, "Expected an ArrayBuffer or a typed array");
+    }
+    auto buffer = bufferValue.getObject(rt).getArrayBuffer(rt);
+    auto byteOffset = getByteCount(rt, object, "byteOffset");
+    byteLength = getByteCount(rt, object, "byteLength");
+    // Read after the properties above, which may run JavaScript.
+    auto bufferSize = buffer.size(rt);
+    if (byteOffset > bufferSize || byteLength > bufferSize - byteOffset) {
+      throw jsi::JSError(rt, "Typed array is out of bounds of its buffer");
+    }
+    data = buffer.data(rt) + byteOffset;
+  }
+
+  if (byteLength % sizeof(T) != 0) {
+    throw jsi::JSError(
+        rt, "Byte length is not a multiple of the size of an element");
+  }
+
+  std::vector<T> values(byteLength / sizeof(T));
+  if (byteLength != 0) {
+    std::memcpy(values.data(), data, byteLength);
+  }
+  return values;
+}
+
+} // namespace array_buffer_detail
+
+template <typename T>
+struct Bridging<bridging::ArrayBufferVector<T>> {
+  static bridging::ArrayBufferVector<T> fromJs(
+      jsi::Runtime& rt,
+      const jsi::Object& value) {
+    return {array_buffer_detail::fromArrayBufferOrView<T>(rt, value)};
+  }
+
+  static jsi::ArrayBuffer toJs(
+      jsi::Runtime& rt,
+      bridging::ArrayBufferVector<T> value) {
+    return array_buffer_detail::toArrayBuffer(rt, std::move(value.values));
+  }
+};
+
+template <typename T>
+struct Bridging<bridging::TypedArrayVector<T>> {
+  static bridging::TypedArrayVector<T> fromJs(
+      jsi::Runtime& rt,
+      const jsi::Object& value) {
+    return {array_buffer_detail::fromArrayBufferOrView<T>(rt, value)};
+  }
+
+  static jsi::Object toJs(
+      jsi::Runtime& rt,
+      bridging::TypedArrayVector<T> value) {
+    auto buffer =
+        array_buffer_detail::toArrayBuffer(rt, std::move(value.values));
+    return rt.global()
+        .getPropertyAsFunction(
+            rt, array_buffer_detail::typedArrayConstructorName<T>())
+        .callAsConstructor(rt, std::move(buffer))
+        .asObject(rt);
+  }
+};
+
+} // namespace facebook::react
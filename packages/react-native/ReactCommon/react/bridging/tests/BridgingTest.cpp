@@ -195,6 +195,91 @@ TEST_F(BridgingTest, arrayTest) {
   EXPECT_EQ(headers.size(), jsiHeaders.size(rt));
 }
 
+TEST_F(BridgingTest, arrayBufferTest) {
+  auto vec = std::vector<double>{1.5, -2, 3e10};
+  const auto* data = vec.data();
+
+  auto buffer = bridging::toJs(
+      rt, bridging::ArrayBufferVector<double>{std::move(vec)}, invoker);
+  EXPECT_EQ(3 * sizeof(double), buffer.size(rt));
+  // The storage of the vector is moved into the ArrayBuffer.
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(data), buffer.data(rt));
+  EXPECT_EQ(
+      -2,
+      function("function (buffer) { return new Float64Array(buffer)[1]; }")
+          .call(rt, buffer)
+          .asNumber());
+  EXPECT_EQ(
+      (std::vector<double>{1.5, -2, 3e10}),
+      bridging::fromJs<bridging::ArrayBufferVector<double>>(
+          rt, jsi::Value(rt, buffer), invoker)
+          .values);
+
+  auto typedArray = bridging::toJs(
+      rt, bridging::TypedArrayVector<int32_t>{{1, 2, 3}}, invoker);
+  EXPECT_TRUE(function(
+                  "function (array) {"
+                  "  return array instanceof Int32Array &&"
+                  "    array.length === 3 && array[2] === 3;"
+                  "}")
+                  .call(rt, typedArray)
+                  .asBool());
+
+  // Only the part of the buffer covered by a view is read.
+  EXPECT_EQ(
+      (std::vector<int16_t>{2, 3}),
+      bridging::fromJs<bridging::TypedArrayVector<int16_t>>(
+          rt, eval("new Int16Array([1, 2, 3, 4]).subarray(1, 3)"), invoker)
+          .values);
+  EXPECT_EQ(
+      (std::vector<uint8_t>{2, 3}),
+      bridging::fromJs<bridging::ArrayBufferVector<uint8_t>>(
+          rt,
+          eval("new DataView(new Uint8Array([1, 2, 3]).buffer, 1)"),
+          invoker)
+          .values);
+
+  EXPECT_JSI_THROW(bridging::fromJs<bridging::ArrayBufferVector<double>>(
+      rt, eval("new Uint8Array(3)"), invoker));
+  EXPECT_JSI_THROW(bridging::fromJs<bridging::ArrayBufferVector<double>>(
+      rt, eval("({buffer: 1})"), invoker));
+  // Objects which only look like a view are rejected.
+  EXPECT_JSI_THROW(bridging::fromJs<bridging::ArrayBufferVector<uint8_t>>(
+      rt,
+      eval("({buffer: new ArrayBuffer(8), byteOffset: 0, byteLength: 8})"),
+      invoker));
+
+  // The range of a view is validated against its buffer.
+  auto fromViewWithRange = [&](const std::string& byteOffset,
+                               const std::string& byteLength) {
+    return bridging::fromJs<bridging::ArrayBufferVector<uint8_t>>(
+        rt,
+        eval(
+            "Object.defineProperties(new Uint8Array(8), {"
+            "  byteOffset: {value: " +
+            byteOffset +
+            "},"
+            "  byteLength: {value: " +
+            byteLength +
+            "},"
+            "})"),
+        invoker);
+  };
+  EXPECT_EQ(
+      (std::vector<uint8_t>{0, 0}), fromViewWithRange("6", "2").values);
+  EXPECT_JSI_THROW(fromViewWithRange("-1", "2"));
+  EXPECT_JSI_THROW(fromViewWithRange("0", "-8"));
+  EXPECT_JSI_THROW(fromViewWithRange("NaN", "2"));
+  EXPECT_JSI_THROW(fromViewWithRange("0", "Infinity"));
+  EXPECT_JSI_THROW(fromViewWithRange("0.5", "2"));
+  EXPECT_JSI_THROW(fromViewWithRange("'0'", "2"));
+  EXPECT_JSI_THROW(fromViewWithRange("1e300", "2"));
+  EXPECT_JSI_THROW(fromViewWithRange("0", "2 ** 64"));
+  EXPECT_JSI_THROW(fromViewWithRange("9", "0"));
+  EXPECT_JSI_THROW(fromViewWithRange("6", "3"));
+  EXPECT_JSI_THROW(fromViewWithRange("2", "2 ** 53 - 1"));
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
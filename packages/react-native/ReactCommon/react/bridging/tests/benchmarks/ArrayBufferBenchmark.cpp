@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/bridging/Bridging.h>
+
+#include <numeric>
+
+namespace facebook::react {
+
+static constexpr auto kElementCount = 1'000'000;
+
+static std::vector<double> makeSamples() {
+  auto samples = std::vector<double>(kElementCount);
+  std::iota(samples.begin(), samples.end(), 0.5);
+  return samples;
+}
+
+static void vectorToArray(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto samples = makeSamples();
+
+  for (auto _ : state) {
+    auto array = bridging::toJs(*runtime, samples, nullptr);
+    benchmark::DoNotOptimize(array);
+  }
+  state.SetItemsProcessed(state.iterations() * kElementCount);
+}
+BENCHMARK(vectorToArray)->Unit(benchmark::kMillisecond);
+
+static void vectorToArrayBuffer(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto samples = makeSamples();
+    state.ResumeTiming();
+
+    auto buffer = bridging::toJs(
+        *runtime, bridging::ArrayBufferVector<double>{std::move(samples)});
+    benchmark::DoNotOptimize(buffer);
+  }
+  state.SetItemsProcessed(state.iterations() * kElementCount);
+}
+BENCHMARK(vectorToArrayBuffer)->Unit(benchmark::kMillisecond);
+
+static void vectorToTypedArray(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto samples = makeSamples();
+    state.ResumeTiming();
+
+    auto typedArray = bridging::toJs(
+        *runtime, bridging::TypedArrayVector<double>{std::move(samples)});
+    benchmark::DoNotOptimize(typedArray);
+  }
+  state.SetItemsProcessed(state.iterations() * kElementCount);
+}
+BENCHMARK(vectorToTypedArray)->Unit(benchmark::kMillisecond);
+
+static void arrayToVector(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  jsi::Value array = bridging::toJs(*runtime, makeSamples(), nullptr);
+
+  for (auto _ : state) {
+    auto samples =
+        bridging::fromJs<std::vector<double>>(*runtime, array, nullptr);
+    benchmark::DoNotOptimize(samples);
+  }
+  state.SetItemsProcessed(state.iterations() * kElementCount);
+}
+BENCHMARK(arrayToVector)->Unit(benchmark::kMillisecond);
+
+static void typedArrayToVector(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  jsi::Value typedArray = bridging::toJs(
+      *runtime, bridging::TypedArrayVector<double>{makeSamples()});
+
+  for (auto _ : state) {
+    auto samples = bridging::fromJs<bridging::TypedArrayVector<double>>(
+        *runtime, typedArray, nullptr);
+    benchmark::DoNotOptimize(samples);
+  }
+  state.SetItemsProcessed(state.iterations() * kElementCount);
+}
+BENCHMARK(typedArrayToVector)->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
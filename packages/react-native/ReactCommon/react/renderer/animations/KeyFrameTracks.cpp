@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "KeyFrameTracks.h"
+
+namespace facebook::react {
+
+void KeyFrameTracks::clear() {
+  progress_.clear();
+  for (size_t i = 0; i < FrameComponent::Count; i++) {
+    startFrames_[i].clear();
+    endFrames_[i].clear();
+    frames_[i].clear();
+  }
+}
+
+size_t KeyFrameTracks::append(
+    Float progress,
+    const ShadowView& startingView,
+    const ShadowView& finalView) {
+  const auto& startFrame = startingView.layoutMetrics.frame;
+  const auto& endFrame = finalView.layoutMetrics.frame;
+
+  progress_.push_back(progress);
+  startFrames_[OriginX].push_back(startFrame.origin.x);
+  startFrames_[OriginY].push_back(startFrame.origin.y);
+  startFrames_[Width].push_back(startFrame.size.width);
+  startFrames_[Height].push_back(startFrame.size.height);
+  endFrames_[OriginX].push_back(endFrame.origin.x);
+  endFrames_[OriginY].push_back(endFrame.origin.y);
+  endFrames_[Width].push_back(endFrame.size.width);
+  endFrames_[Height].push_back(endFrame.size.height);
+
+  return progress_.size() - 1;
+}
+
+/*
+ * Must stay in sync with `interpolateFloats` used by
+ * `LayoutAnimationKeyFrameManager` so both produce identical values.
+ */
+static void interpolateTrack(
+    const std::vector<Float>& progress,
+    const std::vector<Float>& start,
+    const std::vector<Float>& end,
+    std::vector<Float>& result) {
+  auto size = progress.size();
+  result.resize(size);
+  const auto* __restrict p = progress.data();
+  const auto* __restrict s = start.data();
+  const auto* __restrict e = end.data();
+  auto* __restrict r = result.data();
+  for (size_t i = 0; i < size; i++) {
+    r[i] = s[i] + (e[i] - s[i]) * p[i];
+  }
+}
+
+void KeyFrameTracks::interpolate() {
+  for (size_t i = 0; i < FrameComponent::Count; i++) {
+    interpolateTrack(progress_, startFrames_[i], endFrames_[i], frames_[i]);
+  }
+}
+
+size_t KeyFrameTracks::size() const {
+  return progress_.size();
+}
+
+Float KeyFrameTracks::getProgress(size_t index) const {
+  return progress_[index];
+}
+
+Rect KeyFrameTracks::getFrame(size_t index) const {
+  return Rect{
+      Point{frames_[OriginX][index], frames_[OriginY][index]},
+      Size{frames_[Width][index], frames_[Height][index]}};
+}
+
+} // namespace facebook::react
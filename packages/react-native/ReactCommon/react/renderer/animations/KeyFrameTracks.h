@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Rect.h>
+#include <react/renderer/mounting/ShadowView.h>
+
+namespace facebook::react {
+
+/*
+ * Structure-of-arrays storage of frames animated by LayoutAnimations.
+ * Keyframes of all in-flight animations are appended on every frame and
+ * then interpolated in bulk, which keeps the hot loop over contiguous
+ * buffers (and lets compilers vectorize it). The buffers are meant to be
+ * reused between frames, so steady-state animation does not allocate.
+ * Animated props (opacity, transform) are interpolated separately, and only
+ * for views which actually animate them.
+ */
+class KeyFrameTracks final {
+ public:
+  /*
+   * Removes all tracks, retaining the allocated memory.
+   */
+  void clear();
+
+  /*
+   * Appends a track interpolating the frame of `startingView` towards
+   * `finalView` by `progress`. Returns the index of the track.
+   */
+  size_t append(
+      Float progress,
+      const ShadowView& startingView,
+      const ShadowView& finalView);
+
+  /*
+   * Interpolates all appended tracks.
+   */
+  void interpolate();
+
+  size_t size() const;
+
+  /*
+   * Accessors for interpolated values; must be called after `interpolate`.
+   */
+  Float getProgress(size_t index) const;
+  Rect getFrame(size_t index) const;
+
+ private:
+  enum FrameComponent { OriginX = 0, OriginY, Width, Height, Count };
+
+  std::vector<Float> progress_{};
+  std::array<std::vector<Float>, FrameComponent::Count> startFrames_{};
+  std::array<std::vector<Float>, FrameComponent::Count> endFrames_{};
+  std::array<std::vector<Float>, FrameComponent::Count> frames_{};
+};
+
+} // namespace facebook::react
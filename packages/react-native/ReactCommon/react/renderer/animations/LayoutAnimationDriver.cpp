@@ -18,6 +18,11 @@ void LayoutAnimationDriver::animationMutationsForFrame(
     SurfaceId surfaceId,
     ShadowViewMutation::List& mutationsList,
     uint64_t now) const {
+  keyFrameTracks_.clear();
+  trackedKeyFrames_.clear();
+
+  // Gather progress and frames of all animated keyframes, so they can be
+  // interpolated in bulk.
   for (auto& animation : inflightAnimations_) {
     if (animation.surfaceId != surfaceId) {
       continue;
@@ -32,12 +37,9 @@ void LayoutAnimationDriver::animationMutationsForFrame(
         continue;
       }
 
-      const auto& baselineShadowView = keyframe.viewStart;
-      const auto& finalShadowView = keyframe.viewEnd;
-
       // The contract with the "keyframes generation" phase is that any animated
       // node will have a valid configuration.
-      const auto layoutAnimationConfig = animation.layoutAnimationConfig;
+      const auto& layoutAnimationConfig = animation.layoutAnimationConfig;
       const auto& mutationConfig =
           (keyframe.type == AnimationConfigurationType::Delete
                ? layoutAnimationConfig.deleteConfig
@@ -45,22 +47,14 @@ void LayoutAnimationDriver::animationMutationsForFrame(
                       ? layoutAnimationConfig.createConfig
                       : layoutAnimationConfig.updateConfig));
 
-      // Interpolate
       auto progress =
           calculateAnimationProgress(now, animation, mutationConfig);
       auto animationTimeProgressLinear = progress.first;
       auto animationInterpolationFactor = progress.second;
 
-      auto mutatedShadowView = createInterpolatedShadowView(
-          animationInterpolationFactor, baselineShadowView, finalShadowView);
-
-      // Create the mutation instruction
-      mutationsList.emplace_back(ShadowViewMutation::UpdateMutation(
-          keyframe.viewPrev, mutatedShadowView, keyframe.parentView));
-
-      PrintMutationInstruction("Animation Progress:", mutationsList.back());
-
-      keyframe.viewPrev = std::move(mutatedShadowView);
+      keyFrameTracks_.append(
+          animationInterpolationFactor, keyframe.viewStart, keyframe.viewEnd);
+      trackedKeyFrames_.push_back(&keyframe);
 
       if (animationTimeProgressLinear < 1) {
         incompleteAnimations++;
@@ -73,6 +67,25 @@ void LayoutAnimationDriver::animationMutationsForFrame(
     }
   }
 
+  // Interpolate
+  keyFrameTracks_.interpolate();
+
+  for (size_t i = 0; i < trackedKeyFrames_.size(); i++) {
+    auto& keyframe = *trackedKeyFrames_[i];
+
+    auto mutatedShadowView = createInterpolatedShadowView(
+        keyFrameTracks_, i, keyframe.viewStart, keyframe.viewEnd);
+
+    // Create the mutation instruction
+    mutationsList.emplace_back(ShadowViewMutation::UpdateMutation(
+        keyframe.viewPrev, mutatedShadowView, keyframe.parentView));
+
+    PrintMutationInstruction("Animation Progress:", mutationsList.back());
+
+    keyframe.viewPrev = std::move(mutatedShadowView);
+  }
+  trackedKeyFrames_.clear();
+
   // Clear out finished animations
   for (auto it = inflightAnimations_.begin();
        it != inflightAnimations_.end();) {
@@ -74,6 +74,26 @@ void PrintMutationInstructionRelative(
 }
 #endif
 
+/*
+ * Flat list of (tag, index of mutation) pairs, sorted by tag and index.
+ * Used instead of hash containers to look up mutations of a transaction.
+ */
+using TagIndexList = std::vector<std::pair<Tag, size_t>>;
+
+/*
+ * Returns the index of the first mutation recorded for `tag`, if any.
+ */
+static std::optional<size_t> findFirstIndex(
+    const TagIndexList& tagIndices,
+    Tag tag) {
+  auto it = std::lower_bound(
+      tagIndices.begin(), tagIndices.end(), std::pair<Tag, size_t>{tag, 0});
+  if (it == tagIndices.end() || it->first != tag) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
 static inline Float
 interpolateFloats(Float coefficient, Float oldValue, Float newValue) {
   return oldValue + (newValue - oldValue) * coefficient;
@@ -259,25 +279,43 @@ LayoutAnimationKeyFrameManager::pullTransaction(
       // TODO: to prevent this step we could tag Remove/Insert mutations as
       // being moves on the Differ level, since we know that there? We could use
       // TinyMap here, but it's not exposed by Differentiator (yet).
-      std::unordered_set<Tag> insertedTags;
-      std::unordered_set<Tag> deletedTags;
-      std::unordered_set<Tag>
-          reparentedTags; // tags that are deleted and recreated
-      std::unordered_map<Tag, ShadowViewMutation> movedTags;
-      for (const auto& mutation : mutations) {
+      auto insertedTags = TagIndexList{};
+      auto deletedTags = TagIndexList{};
+      for (size_t i = 0; i < mutations.size(); i++) {
+        const auto& mutation = mutations[i];
         if (mutation.type == ShadowViewMutation::Type::Insert) {
-          insertedTags.insert(mutation.newChildShadowView.tag);
+          insertedTags.emplace_back(mutation.newChildShadowView.tag, i);
         }
         if (mutation.type == ShadowViewMutation::Type::Delete) {
-          deletedTags.insert(mutation.oldChildShadowView.tag);
+          deletedTags.emplace_back(mutation.oldChildShadowView.tag, i);
         }
+      }
+      std::sort(insertedTags.begin(), insertedTags.end());
+      std::sort(deletedTags.begin(), deletedTags.end());
+
+      // Tags that are deleted and recreated, and removes of tags that are
+      // inserted again (moved).
+      auto reparentedTags = std::vector<Tag>{};
+      auto movedTags = TagIndexList{};
+      for (size_t i = 0; i < mutations.size(); i++) {
+        const auto& mutation = mutations[i];
         if (mutation.type == ShadowViewMutation::Type::Create) {
-          if (deletedTags.find(mutation.newChildShadowView.tag) !=
-              deletedTags.end()) {
-            reparentedTags.insert(mutation.newChildShadowView.tag);
+          auto deleteIndex =
+              findFirstIndex(deletedTags, mutation.newChildShadowView.tag);
+          if (deleteIndex.has_value() && *deleteIndex < i) {
+            reparentedTags.push_back(mutation.newChildShadowView.tag);
           }
         }
+        if (mutation.type == ShadowViewMutation::Type::Remove &&
+            !mutation.oldChildShadowView.traits.check(
+                ShadowNodeTraits::Trait::RootNodeKind) &&
+            findFirstIndex(insertedTags, mutation.oldChildShadowView.tag)
+                .has_value()) {
+          movedTags.emplace_back(mutation.oldChildShadowView.tag, i);
+        }
       }
+      std::sort(reparentedTags.begin(), reparentedTags.end());
+      std::sort(movedTags.begin(), movedTags.end());
 
       // Process mutations list into operations that can be sent to platform
       // immediately, and those that need to be animated Deletions, removals,
@@ -291,7 +329,8 @@ LayoutAnimationKeyFrameManager::pullTransaction(
       // immediately and animated as an update.
       std::vector<AnimationKeyFrame> keyFramesToAnimate;
       const auto layoutAnimationConfig = animation.layoutAnimationConfig;
-      for (const auto& mutation : mutations) {
+      for (size_t i = 0; i < mutations.size(); i++) {
+        const auto& mutation = mutations[i];
         if (mutation.type == ShadowViewMutation::Type::RemoveDeleteTree) {
           continue;
         }
@@ -317,25 +356,22 @@ LayoutAnimationKeyFrameManager::pullTransaction(
 
         bool isRemoveReinserted =
             mutation.type == ShadowViewMutation::Type::Remove &&
-            insertedTags.find(mutation.oldChildShadowView.tag) !=
-                insertedTags.end();
+            findFirstIndex(insertedTags, mutation.oldChildShadowView.tag)
+                .has_value();
 
         // Reparenting can result in a node being removed, inserted (moved) and
         // also deleted and created in the same frame, with the same props etc.
         // This should eventually be optimized out of the diffing algorithm, but
         // for now we detect reparenting and prevent the corresponding
         // Delete/Create instructions from being animated.
-        bool isReparented =
-            reparentedTags.find(baselineShadowView.tag) != reparentedTags.end();
-
-        if (isRemoveReinserted) {
-          movedTags.insert({mutation.oldChildShadowView.tag, mutation});
-        }
+        bool isReparented = std::binary_search(
+            reparentedTags.begin(),
+            reparentedTags.end(),
+            baselineShadowView.tag);
 
         // Inserts that follow a "remove" of the same tag should be treated as
         // an update (move) animation.
         bool wasInsertedTagRemoved = false;
-        auto movedIt = movedTags.end();
         if (mutation.type == ShadowViewMutation::Type::Insert) {
           // If this is a move, we actually don't want to copy this insert
           // instruction to animated instructions - we want to
@@ -343,8 +379,9 @@ LayoutAnimationKeyFrameManager::pullTransaction(
           // the layout.
           // The corresponding Remove and Insert instructions will instead
           // be treated as "immediate" instructions.
-          movedIt = movedTags.find(mutation.newChildShadowView.tag);
-          wasInsertedTagRemoved = movedIt != movedTags.end();
+          auto removeIndex =
+              findFirstIndex(movedTags, mutation.newChildShadowView.tag);
+          wasInsertedTagRemoved = removeIndex.has_value() && *removeIndex < i;
         }
 
         const auto& mutationConfig =
@@ -734,8 +771,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
         // without another corresponding UPDATE, we should re-queue the
         // keyframe so that its position/props don't suddenly "jump".
         if (keyFrame.type == AnimationConfigurationType::Update) {
-          auto movedIt = movedTags.find(keyFrame.tag);
-          if (movedIt != movedTags.end()) {
+          if (findFirstIndex(movedTags, keyFrame.tag).has_value()) {
             auto newKeyFrameForUpdate = std::find_if(
                 keyFramesToAnimate.begin(),
                 keyFramesToAnimate.end(),
@@ -1078,8 +1114,69 @@ LayoutAnimationKeyFrameManager::getComponentDescriptorForShadowView(
   return componentDescriptorRegistry_->at(shadowView.componentHandle);
 }
 
+/*
+ * Returns `true` if props interpolated between `startingView` and `finalView`
+ * may differ from the props of `finalView`. If not, interpolated views can
+ * share the final props and cloning them on every frame can be avoided.
+ */
+static bool animatesProps(
+    const ComponentDescriptor& componentDescriptor,
+    const ShadowView& startingView,
+    const ShadowView& finalView) {
+  if (!componentDescriptor.getTraits().check(
+          ShadowNodeTraits::Trait::ViewKind)) {
+    return false;
+  }
+
+  const auto& startingProps =
+      static_cast<const ViewProps&>(*startingView.props);
+  const auto& finalProps = static_cast<const ViewProps&>(*finalView.props);
+
+  // Interpolated transforms are rebuilt from transform operations, so they
+  // only match the final one when there is nothing to interpolate.
+  return startingProps.opacity != finalProps.opacity ||
+      !startingProps.transform.operations.empty() ||
+      !finalProps.transform.operations.empty();
+}
+
+ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
+    Float progress,
+    const ShadowView& startingView,
+    const ShadowView& finalView) const {
+  // Interpolate LayoutMetrics
+  const auto& baselineFrame = startingView.layoutMetrics.frame;
+  const auto& finalFrame = finalView.layoutMetrics.frame;
+  auto frame = Rect{
+      Point{
+          interpolateFloats(
+              progress, baselineFrame.origin.x, finalFrame.origin.x),
+          interpolateFloats(
+              progress, baselineFrame.origin.y, finalFrame.origin.y)},
+      Size{
+          interpolateFloats(
+              progress, baselineFrame.size.width, finalFrame.size.width),
+          interpolateFloats(
+              progress, baselineFrame.size.height, finalFrame.size.height)}};
+
+  return createInterpolatedShadowView(
+      progress, frame, startingView, finalView);
+}
+
+ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
+    const KeyFrameTracks& tracks,
+    size_t index,
+    const ShadowView& startingView,
+    const ShadowView& finalView) const {
+  return createInterpolatedShadowView(
+      tracks.getProgress(index),
+      tracks.getFrame(index),
+      startingView,
+      finalView);
+}
+
 ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     Float progress,
+    const Rect& frame,
     const ShadowView& startingView,
     const ShadowView& finalView) const {
   react_native_assert(startingView.tag > 0);
@@ -1111,41 +1208,23 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
   }
 
   // Animate opacity or scale/transform
-  PropsParserContext propsParserContext{
-      finalView.surfaceId, *contextContainer_};
-  mutatedShadowView.props = interpolateProps(
-      componentDescriptor,
-      propsParserContext,
-      progress,
-      startingView.props,
-      finalView.props);
+  if (animatesProps(componentDescriptor, startingView, finalView)) {
+    PropsParserContext propsParserContext{
+        finalView.surfaceId, *contextContainer_};
+    mutatedShadowView.props = interpolateProps(
+        componentDescriptor,
+        propsParserContext,
+        progress,
+        startingView.props,
+        finalView.props);
+  }
 
   react_native_assert(mutatedShadowView.props != nullptr);
   if (mutatedShadowView.props == nullptr) {
     return finalView;
   }
 
-  // Interpolate LayoutMetrics
-  const LayoutMetrics& finalLayoutMetrics = finalView.layoutMetrics;
-  const LayoutMetrics& baselineLayoutMetrics = startingView.layoutMetrics;
-  LayoutMetrics interpolatedLayoutMetrics = finalLayoutMetrics;
-  interpolatedLayoutMetrics.frame.origin.x = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.x,
-      finalLayoutMetrics.frame.origin.x);
-  interpolatedLayoutMetrics.frame.origin.y = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.y,
-      finalLayoutMetrics.frame.origin.y);
-  interpolatedLayoutMetrics.frame.size.width = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.width,
-      finalLayoutMetrics.frame.size.width);
-  interpolatedLayoutMetrics.frame.size.height = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.height,
-      finalLayoutMetrics.frame.size.height);
-  mutatedShadowView.layoutMetrics = interpolatedLayoutMetrics;
+  mutatedShadowView.layoutMetrics.frame = frame;
 
   return mutatedShadowView;
 }
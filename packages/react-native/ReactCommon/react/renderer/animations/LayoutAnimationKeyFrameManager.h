@@ -8,6 +8,7 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/renderer/animations/KeyFrameTracks.h>
 #include <react/renderer/animations/LayoutAnimationCallbackWrapper.h>
 #include <react/renderer/animations/primitives.h>
 #include <react/renderer/core/RawValue.h>
@@ -100,6 +101,15 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
    */
   mutable std::vector<LayoutAnimation> inflightAnimations_{};
 
+  /**
+   * Frames of keyframes animated on the current frame, together with the
+   * keyframes themselves. Only used (and reused between frames) by
+   * `animationMutationsForFrame`, so they follow the same contract as
+   * `inflightAnimations_`.
+   */
+  mutable KeyFrameTracks keyFrameTracks_{};
+  mutable std::vector<AnimationKeyFrame*> trackedKeyFrames_{};
+
   bool hasComponentDescriptorForShadowView(const ShadowView& shadowView) const;
   const ComponentDescriptor& getComponentDescriptorForShadowView(
       const ShadowView& shadowView) const;
@@ -118,6 +128,16 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       const ShadowView& startingView,
       const ShadowView& finalView) const;
 
+  /**
+   * Same as above, but uses the progress and the frame interpolated in bulk
+   * for the track at `index`.
+   */
+  ShadowView createInterpolatedShadowView(
+      const KeyFrameTracks& tracks,
+      size_t index,
+      const ShadowView& startingView,
+      const ShadowView& finalView) const;
+
   void callCallback(const LayoutAnimationCallbackWrapper& callback) const;
 
   virtual void animationMutationsForFrame(
@@ -171,6 +191,12 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
   void simulateImagePropsMemoryAccess(
       const ShadowViewMutationList& mutations) const;
 
+  ShadowView createInterpolatedShadowView(
+      Float progress,
+      const Rect& frame,
+      const ShadowView& startingView,
+      const ShadowView& finalView) const;
+
   /**
    * Interpolates the props values.
    */
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <ReactCommon/RuntimeExecutor.h>
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProvider.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+
+namespace facebook::react {
+
+static ShadowView makeShadowView(
+    Tag tag,
+    ComponentHandle componentHandle,
+    const Props::Shared& props,
+    Float offset) {
+  auto shadowView = ShadowView{};
+  shadowView.componentName = ViewShadowNode::Name();
+  shadowView.componentHandle = componentHandle;
+  shadowView.surfaceId = 1;
+  shadowView.tag = tag;
+  shadowView.traits = ViewShadowNode::BaseTraits();
+  shadowView.props = props;
+  shadowView.layoutMetrics.frame = Rect{
+      Point{offset, static_cast<Float>(tag) * 10}, Size{100 + offset, 10}};
+  return shadowView;
+}
+
+/*
+ * Animates `state.range(0)` sibling views moving (and optionally fading, if
+ * `state.range(1)` is set) at the same time. Every iteration produces a
+ * single frame of the animation.
+ */
+static void animateSimultaneousUpdates(benchmark::State& state) {
+  auto viewCount = static_cast<int>(state.range(0));
+  auto animatesOpacity = state.range(1) != 0;
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<const ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+
+  auto providerRegistry =
+      std::make_shared<ComponentDescriptorProviderRegistry>();
+  auto componentDescriptorRegistry =
+      providerRegistry->createComponentDescriptorRegistry(
+          componentDescriptorParameters);
+  providerRegistry->add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  RuntimeExecutor runtimeExecutor =
+      [](const std::function<void(jsi::Runtime&)>& /*unused*/) {};
+  auto animationDriver = std::make_shared<LayoutAnimationDriver>(
+      runtimeExecutor, contextContainer, nullptr);
+  animationDriver->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+  auto now = uint64_t{0};
+  animationDriver->setClockNow([&]() { return now; });
+
+  auto componentHandle = ViewComponentDescriptor::ConcreteShadowNode::Handle();
+  auto oldProps = std::make_shared<ViewProps>();
+  auto newProps = std::make_shared<ViewProps>();
+  if (animatesOpacity) {
+    newProps->opacity = 0.5;
+  }
+
+  auto parentView = makeShadowView(1, componentHandle, oldProps, 0);
+  auto mutations = ShadowViewMutation::List{};
+  for (int i = 0; i < viewCount; i++) {
+    auto tag = Tag(i + 2);
+    mutations.push_back(ShadowViewMutation::UpdateMutation(
+        makeShadowView(tag, componentHandle, oldProps, 0),
+        makeShadowView(tag, componentHandle, newProps, 100),
+        parentView));
+  }
+
+  // Long enough not to finish while measuring.
+  auto duration = 1e9;
+  animationDriver->uiManagerDidConfigureNextLayoutAnimation(
+      {1,
+       0,
+       false,
+       {duration,
+        {/* Create */ AnimationType::Linear,
+         AnimationProperty::Opacity,
+         duration,
+         0,
+         0,
+         0},
+        {/* Update */ AnimationType::Linear,
+         AnimationProperty::ScaleXY,
+         duration,
+         0,
+         0,
+         0},
+        {/* Delete */ AnimationType::Linear,
+         AnimationProperty::Opacity,
+         duration,
+         0,
+         0,
+         0}},
+       {},
+       {},
+       {}});
+
+  auto telemetry = TransactionTelemetry{};
+  animationDriver->pullTransaction(1, 0, telemetry, mutations);
+
+  for (auto _ : state) {
+    now += 16;
+    auto transaction = animationDriver->pullTransaction(1, 0, telemetry, {});
+    benchmark::DoNotOptimize(transaction);
+  }
+
+  state.SetItemsProcessed(state.iterations() * viewCount);
+}
+BENCHMARK(animateSimultaneousUpdates)
+    ->Args({100, 0})
+    ->Args({1000, 0})
+    ->Args({1000, 1});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
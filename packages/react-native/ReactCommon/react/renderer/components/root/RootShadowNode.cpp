@@ -15,7 +15,8 @@ namespace facebook::react {
 const char RootComponentName[] = "RootView";
 
 bool RootShadowNode::layoutIfNeeded(
-    std::vector<const LayoutableShadowNode*>* affectedNodes) {
+    std::vector<const LayoutableShadowNode*>* affectedNodes,
+    int* skippedSubtreesCount) {
   SystraceSection s("RootShadowNode::layout");
 
   if (getIsLayoutClean()) {
@@ -26,6 +27,7 @@ bool RootShadowNode::layoutIfNeeded(
 
   auto layoutContext = getConcreteProps().layoutContext;
   layoutContext.affectedNodes = affectedNodes;
+  layoutContext.skippedSubtreesCount = skippedSubtreesCount;
 
   layoutTree(layoutContext, getConcreteProps().layoutConstraints);
 
@@ -45,7 +45,8 @@ class RootShadowNode final
    * Returns `false` if the three is already laid out.
    */
   bool layoutIfNeeded(
-      std::vector<const LayoutableShadowNode*>* affectedNodes = {});
+      std::vector<const LayoutableShadowNode*>* affectedNodes = {},
+      int* skippedSubtreesCount = {});
 
   /*
    * Clones the node with given `layoutConstraints` and `layoutContext`.
@@ -7,54 +7,48 @@
 
 #include "ScrollViewEventEmitter.h"
 
+#include <react/renderer/core/JSIObjectShape.h>
+
 namespace facebook::react {
 
 static jsi::Value scrollViewMetricsPayload(
     jsi::Runtime& runtime,
     const ScrollViewEventEmitter::Metrics& scrollViewMetrics) {
-  auto payload = jsi::Object(runtime);
-
-  {
-    auto contentOffset = jsi::Object(runtime);
-    contentOffset.setProperty(runtime, "x", scrollViewMetrics.contentOffset.x);
-    contentOffset.setProperty(runtime, "y", scrollViewMetrics.contentOffset.y);
-    payload.setProperty(runtime, "contentOffset", contentOffset);
-  }
-
-  {
-    auto contentInset = jsi::Object(runtime);
-    contentInset.setProperty(
-        runtime, "top", scrollViewMetrics.contentInset.top);
-    contentInset.setProperty(
-        runtime, "left", scrollViewMetrics.contentInset.left);
-    contentInset.setProperty(
-        runtime, "bottom", scrollViewMetrics.contentInset.bottom);
-    contentInset.setProperty(
-        runtime, "right", scrollViewMetrics.contentInset.right);
-    payload.setProperty(runtime, "contentInset", contentInset);
-  }
-
-  {
-    auto contentSize = jsi::Object(runtime);
-    contentSize.setProperty(
-        runtime, "width", scrollViewMetrics.contentSize.width);
-    contentSize.setProperty(
-        runtime, "height", scrollViewMetrics.contentSize.height);
-    payload.setProperty(runtime, "contentSize", contentSize);
-  }
-
-  {
-    auto containerSize = jsi::Object(runtime);
-    containerSize.setProperty(
-        runtime, "width", scrollViewMetrics.containerSize.width);
-    containerSize.setProperty(
-        runtime, "height", scrollViewMetrics.containerSize.height);
-    payload.setProperty(runtime, "layoutMeasurement", containerSize);
-  }
-
-  payload.setProperty(runtime, "zoomScale", scrollViewMetrics.zoomScale);
-
-  return payload;
+  static const auto pointShape = JSIObjectShape{"x", "y"};
+  static const auto insetsShape =
+      JSIObjectShape{"top", "left", "bottom", "right"};
+  static const auto sizeShape = JSIObjectShape{"width", "height"};
+  static const auto payloadShape = JSIObjectShape{
+      "contentOffset",
+      "contentInset",
+      "contentSize",
+      "layoutMeasurement",
+      "zoomScale",
+  };
+
+  return payloadShape.createObject(
+      runtime,
+      {
+          pointShape.createObject(
+              runtime,
+              {scrollViewMetrics.contentOffset.x,
+               scrollViewMetrics.contentOffset.y}),
+          insetsShape.createObject(
+              runtime,
+              {scrollViewMetrics.contentInset.top,
+               scrollViewMetrics.contentInset.left,
+               scrollViewMetrics.contentInset.bottom,
+               scrollViewMetrics.contentInset.right}),
+          sizeShape.createObject(
+              runtime,
+              {scrollViewMetrics.contentSize.width,
+               scrollViewMetrics.contentSize.height}),
+          sizeShape.createObject(
+              runtime,
+              {scrollViewMetrics.containerSize.width,
+               scrollViewMetrics.containerSize.height}),
+          scrollViewMetrics.zoomScale,
+      });
 }
 
 void ScrollViewEventEmitter::onScroll(const Metrics& scrollViewMetrics) const {
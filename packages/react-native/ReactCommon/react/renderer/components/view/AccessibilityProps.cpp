@@ -71,7 +71,7 @@ AccessibilityProps::AccessibilityProps(
                     rawProps,
                     "accessibilityHint",
                     sourceProps.accessibilityHint,
-                    "")),
+                    {})),
       accessibilityLanguage(
           CoreFeatures::enablePropIteratorSetter
               ? sourceProps.accessibilityLanguage
@@ -80,7 +80,7 @@ AccessibilityProps::AccessibilityProps(
                     rawProps,
                     "accessibilityLanguage",
                     sourceProps.accessibilityLanguage,
-                    "")),
+                    {})),
       accessibilityValue(
           CoreFeatures::enablePropIteratorSetter
               ? sourceProps.accessibilityValue
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <react/renderer/components/view/AccessibilityPrimitives.h>
+#include <react/renderer/components/view/accessibilityPropsConversions.h>
+#include <react/renderer/core/LazyProp.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -31,18 +33,20 @@ class AccessibilityProps {
 
 #pragma mark - Props
 
+  // `LazyProp` fields are rarely read outside of mounting and are converted
+  // from raw values on first access.
   bool accessible{false};
   std::optional<AccessibilityState> accessibilityState{std::nullopt};
   std::string accessibilityLabel{""};
-  AccessibilityLabelledBy accessibilityLabelledBy{};
+  LazyProp<AccessibilityLabelledBy> accessibilityLabelledBy{};
   AccessibilityLiveRegion accessibilityLiveRegion{
       AccessibilityLiveRegion::None};
   AccessibilityTraits accessibilityTraits{AccessibilityTraits::None};
   std::string accessibilityRole{""};
-  std::string accessibilityHint{""};
-  std::string accessibilityLanguage{""};
-  AccessibilityValue accessibilityValue;
-  std::vector<AccessibilityAction> accessibilityActions{};
+  LazyProp<std::string> accessibilityHint{};
+  LazyProp<std::string> accessibilityLanguage{};
+  LazyProp<AccessibilityValue> accessibilityValue{};
+  LazyProp<std::vector<AccessibilityAction>> accessibilityActions{};
   bool accessibilityViewIsModal{false};
   bool accessibilityElementsHidden{false};
   bool accessibilityIgnoresInvertColors{false};
@@ -7,6 +7,8 @@
 
 #include "Touch.h"
 
+#include <react/renderer/core/JSIObjectShape.h>
+
 namespace facebook::react {
 
 void setTouchPayloadOnObject(
@@ -25,6 +27,35 @@ void setTouchPayloadOnObject(
   object.setProperty(runtime, "force", touch.force);
 }
 
+jsi::Object touchPayload(jsi::Runtime& runtime, const BaseTouch& touch) {
+  static const auto shape = JSIObjectShape{
+      "locationX",
+      "locationY",
+      "pageX",
+      "pageY",
+      "screenX",
+      "screenY",
+      "identifier",
+      "target",
+      "timestamp",
+      "force",
+  };
+  return shape.createObject(
+      runtime,
+      {
+          touch.offsetPoint.x,
+          touch.offsetPoint.y,
+          touch.pagePoint.x,
+          touch.pagePoint.y,
+          touch.screenPoint.x,
+          touch.screenPoint.y,
+          touch.identifier,
+          touch.target,
+          touch.timestamp * 1000,
+          touch.force,
+      });
+}
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const BaseTouch& /*touch*/) {
@@ -79,6 +79,11 @@ void setTouchPayloadOnObject(
     jsi::Runtime& runtime,
     const BaseTouch& touch);
 
+/*
+ * Creates an object with the same properties `setTouchPayloadOnObject` sets.
+ */
+jsi::Object touchPayload(jsi::Runtime& runtime, const BaseTouch& touch);
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 std::string getDebugName(const BaseTouch& touch);
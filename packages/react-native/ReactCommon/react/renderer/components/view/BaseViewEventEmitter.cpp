@@ -7,6 +7,8 @@
 
 #include "BaseViewEventEmitter.h"
 
+#include <react/renderer/core/JSIObjectShape.h>
+
 namespace facebook::react {
 
 #pragma mark - Accessibility
@@ -101,14 +103,13 @@ void BaseViewEventEmitter::onLayout(const LayoutMetrics& layoutMetrics) const {
       layoutEventState->wasDispatched = true;
     }
 
-    auto layout = jsi::Object(runtime);
-    layout.setProperty(runtime, "x", frame.origin.x);
-    layout.setProperty(runtime, "y", frame.origin.y);
-    layout.setProperty(runtime, "width", frame.size.width);
-    layout.setProperty(runtime, "height", frame.size.height);
-    auto payload = jsi::Object(runtime);
-    payload.setProperty(runtime, "layout", std::move(layout));
-    return jsi::Value(std::move(payload));
+    static const auto layoutShape =
+        JSIObjectShape{"x", "y", "width", "height"};
+    static const auto payloadShape = JSIObjectShape{"layout"};
+    auto layout = layoutShape.createObject(
+        runtime,
+        {frame.origin.x, frame.origin.y, frame.size.width, frame.size.height});
+    return jsi::Value(payloadShape.createObject(runtime, {std::move(layout)}));
   });
 }
 
@@ -7,41 +7,74 @@
 
 #include "PointerEvent.h"
 
+#include <react/renderer/core/JSIObjectShape.h>
+
 namespace facebook::react {
 
 jsi::Value PointerEvent::asJSIValue(jsi::Runtime& runtime) const {
-  auto object = jsi::Object(runtime);
-  object.setProperty(runtime, "pointerId", this->pointerId);
-  object.setProperty(runtime, "pressure", this->pressure);
-  object.setProperty(runtime, "pointerType", this->pointerType);
-  object.setProperty(runtime, "clientX", this->clientPoint.x);
-  object.setProperty(runtime, "clientY", this->clientPoint.y);
-  // x/y are an alias to clientX/Y
-  object.setProperty(runtime, "x", this->clientPoint.x);
-  object.setProperty(runtime, "y", this->clientPoint.y);
-  // since RN doesn't have a scrollable root, pageX/Y will always equal
-  // clientX/Y
-  object.setProperty(runtime, "pageX", this->clientPoint.x);
-  object.setProperty(runtime, "pageY", this->clientPoint.y);
-  object.setProperty(runtime, "screenX", this->screenPoint.x);
-  object.setProperty(runtime, "screenY", this->screenPoint.y);
-  object.setProperty(runtime, "offsetX", this->offsetPoint.x);
-  object.setProperty(runtime, "offsetY", this->offsetPoint.y);
-  object.setProperty(runtime, "width", this->width);
-  object.setProperty(runtime, "height", this->height);
-  object.setProperty(runtime, "tiltX", this->tiltX);
-  object.setProperty(runtime, "tiltY", this->tiltY);
-  object.setProperty(runtime, "detail", this->detail);
-  object.setProperty(runtime, "buttons", this->buttons);
-  object.setProperty(runtime, "tangentialPressure", this->tangentialPressure);
-  object.setProperty(runtime, "twist", this->twist);
-  object.setProperty(runtime, "ctrlKey", this->ctrlKey);
-  object.setProperty(runtime, "shiftKey", this->shiftKey);
-  object.setProperty(runtime, "altKey", this->altKey);
-  object.setProperty(runtime, "metaKey", this->metaKey);
-  object.setProperty(runtime, "isPrimary", this->isPrimary);
-  object.setProperty(runtime, "button", this->button);
-  return object;
+  static const auto shape = JSIObjectShape{
+      "pointerId",
+      "pressure",
+      "pointerType",
+      "clientX",
+      "clientY",
+      "x",
+      "y",
+      "pageX",
+      "pageY",
+      "screenX",
+      "screenY",
+      "offsetX",
+      "offsetY",
+      "width",
+      "height",
+      "tiltX",
+      "tiltY",
+      "detail",
+      "buttons",
+      "tangentialPressure",
+      "twist",
+      "ctrlKey",
+      "shiftKey",
+      "altKey",
+      "metaKey",
+      "isPrimary",
+      "button",
+  };
+  return shape.createObject(
+      runtime,
+      {
+          this->pointerId,
+          this->pressure,
+          jsi::String::createFromUtf8(runtime, this->pointerType),
+          this->clientPoint.x,
+          this->clientPoint.y,
+          // x/y are an alias to clientX/Y
+          this->clientPoint.x,
+          this->clientPoint.y,
+          // since RN doesn't have a scrollable root, pageX/Y will always equal
+          // clientX/Y
+          this->clientPoint.x,
+          this->clientPoint.y,
+          this->screenPoint.x,
+          this->screenPoint.y,
+          this->offsetPoint.x,
+          this->offsetPoint.y,
+          this->width,
+          this->height,
+          this->tiltX,
+          this->tiltY,
+          this->detail,
+          this->buttons,
+          this->tangentialPressure,
+          this->twist,
+          this->ctrlKey,
+          this->shiftKey,
+          this->altKey,
+          this->metaKey,
+          this->isPrimary,
+          this->button,
+      });
 }
 
 EventPayloadType PointerEvent::getType() const {
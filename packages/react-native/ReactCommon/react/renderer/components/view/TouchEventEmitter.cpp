@@ -7,6 +7,8 @@
 
 #include "TouchEventEmitter.h"
 
+#include <react/renderer/core/JSIObjectShape.h>
+
 namespace facebook::react {
 
 #pragma mark - Touches
@@ -17,9 +19,7 @@ static jsi::Value touchesPayload(
   auto array = jsi::Array(runtime, touches.size());
   int i = 0;
   for (const auto& touch : touches) {
-    auto object = jsi::Object(runtime);
-    setTouchPayloadOnObject(object, runtime, touch);
-    array.setValueAtIndex(runtime, i++, object);
+    array.setValueAtIndex(runtime, i++, touchPayload(runtime, touch));
   }
   return array;
 }
@@ -27,19 +27,52 @@ static jsi::Value touchesPayload(
 static jsi::Value touchEventPayload(
     jsi::Runtime& runtime,
     const TouchEvent& event) {
-  auto object = jsi::Object(runtime);
-  object.setProperty(
-      runtime, "touches", touchesPayload(runtime, event.touches));
-  object.setProperty(
-      runtime, "changedTouches", touchesPayload(runtime, event.changedTouches));
-  object.setProperty(
-      runtime, "targetTouches", touchesPayload(runtime, event.targetTouches));
-
-  if (!event.changedTouches.empty()) {
-    const auto& firstChangedTouch = *event.changedTouches.begin();
-    setTouchPayloadOnObject(object, runtime, firstChangedTouch);
+  if (event.changedTouches.empty()) {
+    static const auto shape =
+        JSIObjectShape{"touches", "changedTouches", "targetTouches"};
+    return shape.createObject(
+        runtime,
+        {
+            touchesPayload(runtime, event.touches),
+            touchesPayload(runtime, event.changedTouches),
+            touchesPayload(runtime, event.targetTouches),
+        });
   }
-  return object;
+
+  // Properties of the first changed touch are also set on the event itself.
+  static const auto shape = JSIObjectShape{
+      "touches",
+      "changedTouches",
+      "targetTouches",
+      "locationX",
+      "locationY",
+      "pageX",
+      "pageY",
+      "screenX",
+      "screenY",
+      "identifier",
+      "target",
+      "timestamp",
+      "force",
+  };
+  const auto& firstChangedTouch = *event.changedTouches.begin();
+  return shape.createObject(
+      runtime,
+      {
+          touchesPayload(runtime, event.touches),
+          touchesPayload(runtime, event.changedTouches),
+          touchesPayload(runtime, event.targetTouches),
+          firstChangedTouch.offsetPoint.x,
+          firstChangedTouch.offsetPoint.y,
+          firstChangedTouch.pagePoint.x,
+          firstChangedTouch.pagePoint.y,
+          firstChangedTouch.screenPoint.x,
+          firstChangedTouch.screenPoint.y,
+          firstChangedTouch.identifier,
+          firstChangedTouch.target,
+          firstChangedTouch.timestamp * 1000,
+          firstChangedTouch.force,
+      });
 }
 
 void TouchEventEmitter::dispatchTouchEvent(
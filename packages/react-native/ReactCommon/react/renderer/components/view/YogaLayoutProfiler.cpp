@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaLayoutProfiler.h"
+
+#include <atomic>
+#include <mutex>
+
+#include <react/renderer/components/view/YogaLayoutableShadowNode.h>
+
+namespace facebook::react {
+
+namespace {
+
+std::atomic<bool> enabled{false};
+std::mutex mutex;
+YogaComponentProfiles componentProfiles;
+
+} // namespace
+
+void YogaLayoutProfiler::setEnabled(bool isEnabled) {
+  enabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+bool YogaLayoutProfiler::isEnabled() {
+  return enabled.load(std::memory_order_relaxed);
+}
+
+YogaComponentProfiles YogaLayoutProfiler::takeProfiles() {
+  std::lock_guard lock(mutex);
+  return std::exchange(componentProfiles, {});
+}
+
+void YogaLayoutProfiler::addLayoutPass(
+    const yoga::LayoutProfiler& layoutProfiler) {
+  std::lock_guard lock(mutex);
+  for (const auto& [yogaNode, profile] : layoutProfiler.getNodeProfiles()) {
+    const auto& shadowNode =
+        *static_cast<const YogaLayoutableShadowNode*>(yogaNode->getContext());
+    componentProfiles[shadowNode.getComponentName()] += profile;
+  }
+}
+
+folly::dynamic YogaLayoutProfiler::toDynamic(
+    const YogaComponentProfiles& profiles) {
+  auto result = folly::dynamic::object();
+  for (const auto& [componentName, profile] : profiles) {
+    auto cacheMissesByReason = folly::dynamic::object();
+    for (size_t i = 0; i < profile.cacheMissesByReason.size(); i++) {
+      if (profile.cacheMissesByReason[i] > 0) {
+        cacheMissesByReason[yoga::LayoutPassReasonToString(
+            static_cast<yoga::LayoutPassReason>(i))] =
+            profile.cacheMissesByReason[i];
+      }
+    }
+
+    result[componentName] =
+        folly::dynamic::object("visits", profile.visits())(
+            "layouts", profile.layouts)("measures", profile.measures)(
+            "cachedLayouts", profile.cachedLayouts)(
+            "cachedMeasures", profile.cachedMeasures)(
+            "cacheMissesByReason", std::move(cacheMissesByReason))(
+            "measureCallbacks", profile.measureCallbacks)(
+            "measureCallbackDurationMs",
+            std::chrono::duration<double, std::milli>(
+                profile.measureCallbackDuration)
+                .count());
+  }
+  return result;
+}
+
+} // namespace facebook::react
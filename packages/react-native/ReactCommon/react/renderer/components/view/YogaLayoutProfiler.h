@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <folly/dynamic.h>
+#include <yoga/debug/LayoutProfiler.h>
+
+namespace facebook::react {
+
+using YogaComponentProfiles =
+    std::unordered_map<std::string, yoga::NodeLayoutProfile>;
+
+/*
+ * Breaks down the cost of Yoga layout passes by component, to find which
+ * components miss the layout cache or are measured over and over.
+ * While enabled, every layout pass run by `YogaLayoutableShadowNode` is
+ * profiled, and the profile of every Yoga node is added to the one of the
+ * component name of its shadow node. Disabled by default, in which case
+ * layout passes aren't profiled at all.
+ * Can be used from any thread.
+ */
+class YogaLayoutProfiler final {
+ public:
+  static void setEnabled(bool enabled);
+  static bool isEnabled();
+
+  /*
+   * Returns the profiles collected since profiling was enabled, or since they
+   * were last taken.
+   */
+  static YogaComponentProfiles takeProfiles();
+
+  /*
+   * Adds the node profiles of a layout pass. The context of every node
+   * profiled must be its shadow node.
+   */
+  static void addLayoutPass(const yoga::LayoutProfiler& layoutProfiler);
+
+  /*
+   * Profiles in a form which can be sent to DevTools, e.g.
+   * `{"Paragraph": {"visits": 12, "cacheMissesByReason": {"flex_measure": 3},
+   * "measureCallbackDurationMs": 0.4, ...}}`.
+   */
+  static folly::dynamic toDynamic(const YogaComponentProfiles& profiles);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaLayoutRecorder.h"
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#include <glog/logging.h>
+#include <yoga/debug/LayoutSnapshot.h>
+
+namespace facebook::react {
+
+namespace {
+
+std::atomic<bool> recording{false};
+std::mutex mutex;
+YogaLayoutRecorder::SnapshotCallback snapshotCallback;
+
+} // namespace
+
+void YogaLayoutRecorder::setSnapshotCallback(SnapshotCallback callback) {
+  std::lock_guard lock(mutex);
+  recording.store(static_cast<bool>(callback), std::memory_order_relaxed);
+  snapshotCallback = std::move(callback);
+}
+
+bool YogaLayoutRecorder::isRecording() {
+  return recording.load(std::memory_order_relaxed);
+}
+
+YogaLayoutRecorder::SnapshotCallback YogaLayoutRecorder::writeToDirectory(
+    std::string directory) {
+  auto snapshotCount = std::make_shared<std::atomic<uint32_t>>(0);
+  return [directory = std::move(directory),
+          snapshotCount](std::string&& snapshot) {
+    const auto path = directory + "/layout-" +
+        std::to_string(snapshotCount->fetch_add(1)) + ".ygls";
+    std::ofstream file(path, std::ios::binary);
+    file.write(snapshot.data(), static_cast<std::streamsize>(snapshot.size()));
+    if (!file) {
+      LOG(ERROR) << "Could not write layout snapshot to " << path;
+    }
+  };
+}
+
+void YogaLayoutRecorder::recordLayoutPass(
+    const yoga::Node& root,
+    float ownerWidth,
+    float ownerHeight,
+    yoga::Direction ownerDirection) {
+  SnapshotCallback callback;
+  {
+    std::lock_guard lock(mutex);
+    callback = snapshotCallback;
+  }
+  if (!callback) {
+    return;
+  }
+  callback(yoga::serializeLayoutSnapshot(
+      yoga::recordLayout(&root, ownerWidth, ownerHeight, ownerDirection)));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <yoga/enums/Direction.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::react {
+
+/*
+ * Records the layout passes run by `YogaLayoutableShadowNode`, so that a slow
+ * one can be replayed away from the app, e.g. by YogaLayoutReplayBenchmark.
+ * While a callback is set, the tree of every layout pass is recorded (see
+ * `yoga::recordLayout`) and passed to the callback serialized by
+ * `yoga::serializeLayoutSnapshot`. Recording lays out a copy of the tree and
+ * calls its measure functions again, so it is only meant for debugging. No
+ * callback is set by default, in which case nothing is recorded.
+ * Can be used from any thread. The callback is called on the thread running
+ * the layout pass.
+ */
+class YogaLayoutRecorder final {
+ public:
+  using SnapshotCallback = std::function<void(std::string&& snapshot)>;
+
+  /*
+   * Sets the callback receiving the snapshot of every layout pass, or stops
+   * recording if it is empty.
+   */
+  static void setSnapshotCallback(SnapshotCallback callback);
+  static bool isRecording();
+
+  /*
+   * Returns a callback writing each snapshot to its own file in `directory`,
+   * named `layout-<n>.ygls`.
+   */
+  static SnapshotCallback writeToDirectory(std::string directory);
+
+  /*
+   * Records the layout pass about to be run on `root`, if a callback is set.
+   * The measure functions of the tree must be ready to be called.
+   */
+  static void recordLayoutPass(
+      const yoga::Node& root,
+      float ownerWidth,
+      float ownerHeight,
+      yoga::Direction ownerDirection);
+};
+
+} // namespace facebook::react
@@ -11,6 +11,8 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutProfiler.h>
+#include <react/renderer/components/view/YogaLayoutRecorder.h>
 #include <react/renderer/components/view/conversions.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
@@ -332,7 +334,7 @@ void YogaLayoutableShadowNode::updateYogaChildren() {
       getChildren().size() == yogaNode_.getChildren().size();
 
   auto oldYogaChildren =
-      isClean ? yogaNode_.getChildren() : std::vector<yoga::Node*>{};
+      isClean ? yogaNode_.getChildren() : yoga::Node::Children{};
 
   yogaNode_.setChildren({});
   yogaLayoutableChildren_.clear();
@@ -629,9 +631,24 @@ void YogaLayoutableShadowNode::layoutTree(
 
   threadLocalLayoutContext = layoutContext;
 
+  if (YogaLayoutRecorder::isRecording()) {
+    SystraceSection s3("YogaLayoutableShadowNode::recordLayoutPass");
+    YogaLayoutRecorder::recordLayoutPass(
+        yogaNode_, ownerWidth, ownerHeight, yoga::scopedEnum(direction));
+  }
+
   {
-    SystraceSection s3("YogaLayoutableShadowNode::YGNodeCalculateLayout");
-    YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    SystraceSection s4("YogaLayoutableShadowNode::YGNodeCalculateLayout");
+    if (YogaLayoutProfiler::isEnabled()) {
+      yoga::LayoutProfiler layoutProfiler;
+      {
+        yoga::LayoutProfiler::Scope profilerScope{layoutProfiler};
+        YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+      }
+      YogaLayoutProfiler::addLayoutPass(layoutProfiler);
+    } else {
+      YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    }
   }
 
   // Update layout metrics for root node. Updated for children in
@@ -665,46 +682,56 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
   // Reading data from a dirtied node does not make sense.
   react_native_assert(!yogaNode_.isDirty());
 
-  for (auto childYogaNode : yogaNode_.getChildren()) {
-    auto& childNode = shadowNodeFromContext(childYogaNode);
+  // When the layout of this node came from the Yoga cache, none of the nodes
+  // below it have a new layout, so there is nothing to copy from them.
+  if (yogaNode_.getHasNewLayoutInDescendants()) {
+    yogaNode_.setHasNewLayoutInDescendants(false);
 
-    // Verifying that the Yoga node belongs to the ShadowNode.
-    react_native_assert(&childNode.yogaNode_ == childYogaNode);
+    for (auto childYogaNode : yogaNode_.getChildren()) {
+      auto& childNode = shadowNodeFromContext(childYogaNode);
 
-    if (childYogaNode->getHasNewLayout()) {
-      childYogaNode->setHasNewLayout(false);
+      // Verifying that the Yoga node belongs to the ShadowNode.
+      react_native_assert(&childNode.yogaNode_ == childYogaNode);
 
-      // Reading data from a dirtied node does not make sense.
-      react_native_assert(!childYogaNode->isDirty());
+      if (childYogaNode->getHasNewLayout()) {
+        childYogaNode->setHasNewLayout(false);
 
-      // We must copy layout metrics from Yoga node only once (when the parent
-      // node exclusively ownes the child node).
-      react_native_assert(childYogaNode->getOwner() == &yogaNode_);
+        // Reading data from a dirtied node does not make sense.
+        react_native_assert(!childYogaNode->isDirty());
 
-      // We are about to mutate layout metrics of the node.
-      childNode.ensureUnsealed();
+        // We must copy layout metrics from Yoga node only once (when the parent
+        // node exclusively ownes the child node).
+        react_native_assert(childYogaNode->getOwner() == &yogaNode_);
 
-      auto newLayoutMetrics = layoutMetricsFromYogaNode(*childYogaNode);
-      newLayoutMetrics.pointScaleFactor = layoutContext.pointScaleFactor;
-      newLayoutMetrics.wasLeftAndRightSwapped =
-          layoutContext.swapLeftAndRightInRTL &&
-          newLayoutMetrics.layoutDirection == LayoutDirection::RightToLeft;
+        // We are about to mutate layout metrics of the node.
+        childNode.ensureUnsealed();
 
-      // Child node's layout has changed. When a node is added to
-      // `affectedNodes`, onLayout event is called on the component. Comparing
-      // `newLayoutMetrics.frame` with `childNode.getLayoutMetrics().frame` to
-      // detect if layout has not changed is not advised, please refer to
-      // D22999891 for details.
-      if (layoutContext.affectedNodes != nullptr) {
-        layoutContext.affectedNodes->push_back(&childNode);
-      }
+        auto newLayoutMetrics = layoutMetricsFromYogaNode(*childYogaNode);
+        newLayoutMetrics.pointScaleFactor = layoutContext.pointScaleFactor;
+        newLayoutMetrics.wasLeftAndRightSwapped =
+            layoutContext.swapLeftAndRightInRTL &&
+            newLayoutMetrics.layoutDirection == LayoutDirection::RightToLeft;
+
+        // Child node's layout has changed. When a node is added to
+        // `affectedNodes`, onLayout event is called on the component. Comparing
+        // `newLayoutMetrics.frame` with `childNode.getLayoutMetrics().frame` to
+        // detect if layout has not changed is not advised, please refer to
+        // D22999891 for details.
+        if (layoutContext.affectedNodes != nullptr) {
+          layoutContext.affectedNodes->push_back(&childNode);
+        }
 
-      childNode.setLayoutMetrics(newLayoutMetrics);
+        childNode.setLayoutMetrics(newLayoutMetrics);
 
-      if (newLayoutMetrics.displayType != DisplayType::None) {
-        childNode.layout(layoutContext);
+        if (newLayoutMetrics.displayType != DisplayType::None) {
+          childNode.layout(layoutContext);
+        }
       }
     }
+  } else if (layoutContext.skippedSubtreesCount != nullptr) {
+    // Each child roots a subtree whose nodes are not visited by `layout()`.
+    *layoutContext.skippedSubtreesCount +=
+        static_cast<int>(yogaNode_.getChildren().size());
   }
 
   if (yogaNode_.style().overflow() == yoga::Overflow::Visible) {
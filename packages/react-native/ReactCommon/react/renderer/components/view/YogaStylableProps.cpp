@@ -93,6 +93,34 @@ YogaStylableProps::YogaStylableProps(
       sourceProps.yogaStyle.display(),
       yogaStyle.display()));
 
+  yogaStyle.setGridTemplateColumns(convertRawProp(
+      context,
+      rawProps,
+      "gridTemplateColumns",
+      sourceProps.yogaStyle.gridTemplateColumns(),
+      yogaStyle.gridTemplateColumns()));
+
+  yogaStyle.setGridTemplateRows(convertRawProp(
+      context,
+      rawProps,
+      "gridTemplateRows",
+      sourceProps.yogaStyle.gridTemplateRows(),
+      yogaStyle.gridTemplateRows()));
+
+  yogaStyle.setGridColumn(convertRawProp(
+      context,
+      rawProps,
+      "gridColumn",
+      sourceProps.yogaStyle.gridColumn(),
+      yogaStyle.gridColumn()));
+
+  yogaStyle.setGridRow(convertRawProp(
+      context,
+      rawProps,
+      "gridRow",
+      sourceProps.yogaStyle.gridRow(),
+      yogaStyle.gridRow()));
+
   yogaStyle.setFlex(convertRawProp(
       context,
       rawProps,
@@ -578,6 +606,18 @@ SharedDebugStringConvertibleList YogaStylableProps::getDebugProps() const {
           "overflow", yogaStyle.overflow(), defaultYogaStyle.overflow()),
       debugStringConvertibleItem(
           "display", yogaStyle.display(), defaultYogaStyle.display()),
+      debugStringConvertibleItem(
+          "gridTemplateColumns",
+          yogaStyle.gridTemplateColumns(),
+          defaultYogaStyle.gridTemplateColumns()),
+      debugStringConvertibleItem(
+          "gridTemplateRows",
+          yogaStyle.gridTemplateRows(),
+          defaultYogaStyle.gridTemplateRows()),
+      debugStringConvertibleItem(
+          "gridColumn", yogaStyle.gridColumn(), defaultYogaStyle.gridColumn()),
+      debugStringConvertibleItem(
+          "gridRow", yogaStyle.gridRow(), defaultYogaStyle.gridRow()),
       debugStringConvertibleItem(
           "flex", yogaStyle.flex(), defaultYogaStyle.flex()),
       debugStringConvertibleItem(
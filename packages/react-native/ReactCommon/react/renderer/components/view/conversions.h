@@ -405,6 +405,10 @@ inline void fromRawValue(
     result = yoga::Display::None;
     return;
   }
+  if (stringValue == "grid") {
+    result = yoga::Display::Grid;
+    return;
+  }
   LOG(ERROR) << "Could not parse yoga::Display:" << stringValue;
   react_native_expect(false);
 }
@@ -441,6 +445,154 @@ inline void fromRawValue(
   result = yoga::value::undefined();
 }
 
+inline std::optional<yoga::GridTrackSize> gridTrackSizeFromString(
+    std::string_view token) {
+  if (token == "auto") {
+    return yoga::GridTrackSize::ofAuto();
+  }
+  if (token.ends_with("fr")) {
+    auto tryValue = folly::tryTo<float>(token.substr(0, token.length() - 2));
+    if (tryValue.hasValue()) {
+      return yoga::GridTrackSize::fraction(tryValue.value());
+    }
+  } else if (token.ends_with('%')) {
+    auto tryValue = folly::tryTo<float>(token.substr(0, token.length() - 1));
+    if (tryValue.hasValue()) {
+      return yoga::GridTrackSize::percent(tryValue.value());
+    }
+  } else {
+    if (token.ends_with("px")) {
+      token.remove_suffix(2);
+    }
+    auto tryValue = folly::tryTo<float>(token);
+    if (tryValue.hasValue()) {
+      return yoga::GridTrackSize::points(tryValue.value());
+    }
+  }
+  return std::nullopt;
+}
+
+/*
+ * Parses `gridTemplateColumns` and `gridTemplateRows`, either as a string of
+ * space separated tracks (e.g. "1fr 100 auto 50%"), or as an array of numbers
+ * (points) and track strings.
+ */
+inline void fromRawValue(
+    const PropsParserContext& context,
+    const RawValue& value,
+    yoga::GridTrackList& result) {
+  result.clear();
+  if (value.hasType<std::vector<RawValue>>()) {
+    for (const auto& item : static_cast<std::vector<RawValue>>(value)) {
+      if (item.hasType<Float>()) {
+        result.push_back(yoga::GridTrackSize::points((float)item));
+        continue;
+      }
+      auto trackSize = item.hasType<std::string>()
+          ? gridTrackSizeFromString((std::string)item)
+          : std::nullopt;
+      if (!trackSize.has_value()) {
+        LOG(ERROR) << "Could not parse yoga::GridTrackSize";
+        react_native_expect(false);
+        result.clear();
+        return;
+      }
+      result.push_back(*trackSize);
+    }
+    return;
+  }
+
+  react_native_expect(value.hasType<std::string>());
+  if (!value.hasType<std::string>()) {
+    return;
+  }
+  const auto stringValue = (std::string)value;
+  std::string_view remaining = stringValue;
+  while (!remaining.empty()) {
+    const auto tokenStart = remaining.find_first_not_of(' ');
+    if (tokenStart == std::string_view::npos) {
+      break;
+    }
+    remaining.remove_prefix(tokenStart);
+    const auto tokenEnd = std::min(remaining.find(' '), remaining.length());
+    auto trackSize = gridTrackSizeFromString(remaining.substr(0, tokenEnd));
+    if (!trackSize.has_value()) {
+      LOG(ERROR) << "Could not parse yoga::GridTrackList:" << stringValue;
+      react_native_expect(false);
+      result.clear();
+      return;
+    }
+    result.push_back(*trackSize);
+    remaining.remove_prefix(tokenEnd);
+  }
+}
+
+/*
+ * Parses `gridColumn` and `gridRow`: a start line (e.g. `2` or "-1"), a span
+ * ("span 2"), or a start and an end separated by a slash, each of which may
+ * be a line, a span or "auto" (e.g. "1 / -1", "1 / span 2" or "auto / 3").
+ * Negative lines count back from the end of the explicit grid, so they are
+ * resolved during layout.
+ */
+inline void fromRawValue(
+    const PropsParserContext& context,
+    const RawValue& value,
+    yoga::GridPlacement& result) {
+  result = yoga::GridPlacement{};
+  if (value.hasType<int>()) {
+    auto line = folly::tryTo<int16_t>((int)value);
+    react_native_expect(line.hasValue());
+    result.start = line.hasValue() ? line.value() : 0;
+    return;
+  }
+  react_native_expect(value.hasType<std::string>());
+  if (!value.hasType<std::string>()) {
+    return;
+  }
+
+  const auto stringValue = (std::string)value;
+  const auto trim = [](std::string_view part) {
+    const auto begin = part.find_first_not_of(' ');
+    if (begin == std::string_view::npos) {
+      return std::string_view{};
+    }
+    return part.substr(begin, part.find_last_not_of(' ') - begin + 1);
+  };
+  // Parses "auto", a non-zero line or "span <n>" into `line` or `span`
+  const auto parsePart = [&](std::string_view part, int16_t& line) {
+    part = trim(part);
+    if (part == "auto") {
+      return true;
+    }
+    if (part.starts_with("span ")) {
+      auto span = folly::tryTo<uint16_t>(trim(part.substr(5)));
+      if (!span.hasValue() || span.value() == 0) {
+        return false;
+      }
+      result.span = span.value();
+      return true;
+    }
+    auto parsedLine = folly::tryTo<int16_t>(part);
+    if (!parsedLine.hasValue() || parsedLine.value() == 0) {
+      return false;
+    }
+    line = parsedLine.value();
+    return true;
+  };
+
+  const auto slash = stringValue.find('/');
+  const auto startPart = std::string_view{stringValue}.substr(0, slash);
+  const auto endPart = slash == std::string::npos
+      ? std::string_view{"auto"}
+      : std::string_view{stringValue}.substr(slash + 1);
+  if (!parsePart(startPart, result.start) ||
+      !parsePart(endPart, result.end)) {
+    LOG(ERROR) << "Could not parse yoga::GridPlacement:" << stringValue;
+    react_native_expect(false);
+    result = yoga::GridPlacement{};
+  }
+}
+
 inline void fromRawValue(
     const PropsParserContext& context,
     const RawValue& value,
@@ -820,6 +972,38 @@ inline std::string toString(const yoga::Style::Length& length) {
   }
 }
 
+inline std::string toString(const yoga::GridTrackList& value) {
+  std::string result;
+  for (const auto& trackSize : value) {
+    if (!result.empty()) {
+      result += " ";
+    }
+    switch (trackSize.unit()) {
+      case yoga::GridTrackSize::Unit::Auto:
+        result += "auto";
+        break;
+      case yoga::GridTrackSize::Unit::Point:
+        result += std::to_string(trackSize.value());
+        break;
+      case yoga::GridTrackSize::Unit::Percent:
+        result += std::to_string(trackSize.value()) + "%";
+        break;
+      case yoga::GridTrackSize::Unit::Fraction:
+        result += std::to_string(trackSize.value()) + "fr";
+        break;
+    }
+  }
+  return result.empty() ? "none" : result;
+}
+
+inline std::string toString(const yoga::GridPlacement& value) {
+  const auto start =
+      value.start == 0 ? std::string{"auto"} : std::to_string(value.start);
+  const auto end = value.end == 0 ? "span " + std::to_string(value.span)
+                                  : std::to_string(value.end);
+  return start + " / " + end;
+}
+
 inline std::string toString(const yoga::FloatOptional& value) {
   if (value.isUndefined()) {
     return "undefined";
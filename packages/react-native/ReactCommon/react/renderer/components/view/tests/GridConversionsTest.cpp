@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/utils/ContextContainer.h>
+
+using namespace facebook::react;
+
+class GridConversionsTest : public ::testing::Test {
+ protected:
+  const yoga::Style& parseStyle(folly::dynamic style) {
+    props_ = descriptor_.cloneProps(
+        parserContext_, nullptr, RawProps(std::move(style)));
+    return static_cast<const ViewProps&>(*props_).yogaStyle;
+  }
+
+  yoga::GridPlacement parseGridColumn(folly::dynamic value) {
+    return parseStyle(folly::dynamic::object("gridColumn", std::move(value)))
+        .gridColumn();
+  }
+
+  yoga::GridTrackList parseGridTemplateColumns(folly::dynamic value) {
+    return parseStyle(
+               folly::dynamic::object("gridTemplateColumns", std::move(value)))
+        .gridTemplateColumns();
+  }
+
+  ContextContainer contextContainer_{};
+  PropsParserContext parserContext_{-1, contextContainer_};
+  ViewComponentDescriptor descriptor_{ComponentDescriptorParameters{
+      EventDispatcher::Shared{},
+      nullptr,
+      nullptr}};
+  Props::Shared props_;
+};
+
+static yoga::GridPlacement
+placement(int16_t start, int16_t end, uint16_t span = 1) {
+  return yoga::GridPlacement{.start = start, .end = end, .span = span};
+}
+
+TEST_F(GridConversionsTest, parsesDisplayGrid) {
+  EXPECT_EQ(
+      parseStyle(folly::dynamic::object("display", "grid")).display(),
+      yoga::Display::Grid);
+}
+
+TEST_F(GridConversionsTest, parsesTrackLists) {
+  EXPECT_EQ(
+      parseGridTemplateColumns("1fr  100 auto 50% 20px 0.5fr"),
+      (yoga::GridTrackList{
+          yoga::GridTrackSize::fraction(1),
+          yoga::GridTrackSize::points(100),
+          yoga::GridTrackSize::ofAuto(),
+          yoga::GridTrackSize::percent(50),
+          yoga::GridTrackSize::points(20),
+          yoga::GridTrackSize::fraction(0.5f),
+      }));
+  EXPECT_EQ(
+      parseGridTemplateColumns(folly::dynamic::array(100, "2fr")),
+      (yoga::GridTrackList{
+          yoga::GridTrackSize::points(100),
+          yoga::GridTrackSize::fraction(2),
+      }));
+
+  // Invalid lists are dropped as a whole
+  EXPECT_TRUE(parseGridTemplateColumns("1fr wide").empty());
+  EXPECT_TRUE(parseGridTemplateColumns(folly::dynamic::array("1fr", true))
+                  .empty());
+}
+
+TEST_F(GridConversionsTest, parsesPlacements) {
+  EXPECT_EQ(parseGridColumn(2), placement(2, 0));
+  EXPECT_EQ(parseGridColumn("-1"), placement(-1, 0));
+  EXPECT_EQ(parseGridColumn("span 3"), placement(0, 0, 3));
+  EXPECT_EQ(parseGridColumn("auto"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("2 / span 2"), placement(2, 0, 2));
+  EXPECT_EQ(parseGridColumn("1 / 3"), placement(1, 3));
+  EXPECT_EQ(parseGridColumn("auto / 3"), placement(0, 3));
+  EXPECT_EQ(parseGridColumn("span 2 / 4"), placement(0, 4, 2));
+}
+
+TEST_F(GridConversionsTest, keepsEndLinesToResolveDuringLayout) {
+  // Negative lines depend on the size of the explicit grid, and reversed
+  // lines are swapped, both of which happen during layout.
+  EXPECT_EQ(parseGridColumn("1 / -1"), placement(1, -1));
+  EXPECT_EQ(parseGridColumn("-3 / -1"), placement(-3, -1));
+  EXPECT_EQ(parseGridColumn("3 / 1"), placement(3, 1));
+}
+
+TEST_F(GridConversionsTest, dropsInvalidPlacements) {
+  EXPECT_EQ(parseGridColumn("0"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("1 / 0"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("span 0"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("span -1"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("first / last"), placement(0, 0));
+  EXPECT_EQ(parseGridColumn("1 / 70000"), placement(0, 0));
+}
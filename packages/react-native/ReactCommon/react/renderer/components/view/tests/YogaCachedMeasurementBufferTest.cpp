@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <yoga/node/CachedMeasurementBuffer.h>
+
+namespace facebook::react {
+
+// Same shape as the buffer of compact nodes: two of eight entries inline
+using Buffer = yoga::CachedMeasurementBuffer<8, 2>;
+
+static yoga::CachedMeasurement measurement(float width) {
+  return yoga::CachedMeasurement{
+      .availableWidth = width,
+      .availableHeight = 100,
+      .widthSizingMode = yoga::SizingMode::StretchFit,
+      .heightSizingMode = yoga::SizingMode::FitContent,
+      .computedWidth = width,
+      .computedHeight = 50,
+  };
+}
+
+// Reads through the const accessor, which never allocates
+static const yoga::CachedMeasurement& read(
+    const Buffer& buffer,
+    size_t index) {
+  return buffer[index];
+}
+
+// Records `count` measurements the way `calculateLayoutInternal` does,
+// wrapping around to the first entry once every entry has been used
+static void record(Buffer& buffer, size_t& nextIndex, int count, float first) {
+  for (auto i = 0; i < count; i++) {
+    if (nextIndex == Buffer::size()) {
+      nextIndex = 0;
+    }
+    buffer[nextIndex++] = measurement(first + static_cast<float>(i));
+  }
+}
+
+TEST(YogaCachedMeasurementBufferTest, entriesReadAsDefaultUntilWritten) {
+  auto buffer = Buffer{};
+  EXPECT_EQ(Buffer::size(), 8);
+  for (size_t i = 0; i < Buffer::size(); i++) {
+    EXPECT_EQ(read(buffer, i), yoga::CachedMeasurement{});
+  }
+}
+
+TEST(YogaCachedMeasurementBufferTest, growsOnTheFirstOutOfLineWrite) {
+  auto buffer = Buffer{};
+  buffer[0] = measurement(10);
+  buffer[1] = measurement(11);
+
+  // Inline entries live inside the buffer itself
+  EXPECT_GE(
+      reinterpret_cast<const char*>(&read(buffer, 1)),
+      reinterpret_cast<const char*>(&buffer));
+  EXPECT_LT(
+      reinterpret_cast<const char*>(&read(buffer, 1)),
+      reinterpret_cast<const char*>(&buffer + 1));
+
+  // Out-of-line entries all share the default entry until one is written
+  EXPECT_EQ(&read(buffer, 2), &read(buffer, 7));
+
+  buffer[5] = measurement(15);
+  const auto* overflow = &read(buffer, 2);
+  EXPECT_NE(overflow, &read(buffer, 7));
+  EXPECT_EQ(read(buffer, 2), yoga::CachedMeasurement{});
+  EXPECT_EQ(read(buffer, 5), measurement(15));
+
+  // Later writes reuse the same storage
+  buffer[7] = measurement(17);
+  EXPECT_EQ(&read(buffer, 2), overflow);
+  EXPECT_EQ(read(buffer, 0), measurement(10));
+  EXPECT_EQ(read(buffer, 1), measurement(11));
+  EXPECT_EQ(read(buffer, 7), measurement(17));
+}
+
+TEST(YogaCachedMeasurementBufferTest, evictsTheOldestEntriesFirst) {
+  auto buffer = Buffer{};
+  auto nextIndex = size_t{0};
+
+  record(buffer, nextIndex, 8, 0);
+  for (size_t i = 0; i < Buffer::size(); i++) {
+    EXPECT_EQ(read(buffer, i), measurement(static_cast<float>(i)));
+  }
+
+  // The ninth and tenth measurements replace the first two, in order, and
+  // an eleventh reaches back into the out-of-line entries
+  const auto* overflow = &read(buffer, 2);
+  record(buffer, nextIndex, 3, 8);
+  EXPECT_EQ(read(buffer, 0), measurement(8));
+  EXPECT_EQ(read(buffer, 1), measurement(9));
+  EXPECT_EQ(read(buffer, 2), measurement(10));
+  EXPECT_EQ(&read(buffer, 2), overflow);
+  for (size_t i = 3; i < Buffer::size(); i++) {
+    EXPECT_EQ(read(buffer, i), measurement(static_cast<float>(i)));
+  }
+}
+
+TEST(YogaCachedMeasurementBufferTest, resettingDropsEveryEntry) {
+  auto buffer = Buffer{};
+  auto nextIndex = size_t{0};
+  record(buffer, nextIndex, 8, 0);
+
+  buffer = Buffer{};
+  for (size_t i = 0; i < Buffer::size(); i++) {
+    EXPECT_EQ(read(buffer, i), yoga::CachedMeasurement{});
+  }
+  // The out-of-line entries were released along with their values
+  EXPECT_EQ(&read(buffer, 2), &read(buffer, 7));
+
+  nextIndex = 0;
+  record(buffer, nextIndex, 1, 20);
+  EXPECT_EQ(read(buffer, 0), measurement(20));
+  EXPECT_EQ(read(buffer, 1), yoga::CachedMeasurement{});
+}
+
+TEST(YogaCachedMeasurementBufferTest, copiesOwnTheirEntries) {
+  auto inlineOnly = Buffer{};
+  inlineOnly[1] = measurement(1);
+  auto withOverflow = Buffer{};
+  withOverflow[1] = measurement(1);
+  withOverflow[6] = measurement(6);
+
+  for (const auto* source : {&inlineOnly, &withOverflow}) {
+    auto copy = Buffer{*source};
+    auto assigned = Buffer{};
+    assigned[4] = measurement(4);
+    assigned = *source;
+
+    for (auto* target : {&copy, &assigned}) {
+      for (size_t i = 0; i < Buffer::size(); i++) {
+        EXPECT_EQ(read(*target, i), read(*source, i));
+      }
+      if (source == &withOverflow) {
+        EXPECT_NE(&read(*target, 6), &read(*source, 6));
+      }
+      (*target)[6] = measurement(60);
+    }
+    EXPECT_NE(read(*source, 6), measurement(60));
+  }
+}
+
+TEST(YogaCachedMeasurementBufferTest, movesTakeTheEntries) {
+  auto source = Buffer{};
+  source[0] = measurement(0);
+  source[3] = measurement(3);
+  const auto* overflow = &read(source, 3);
+
+  auto moved = Buffer{std::move(source)};
+  EXPECT_EQ(read(moved, 0), measurement(0));
+  EXPECT_EQ(&read(moved, 3), overflow);
+
+  auto assigned = Buffer{};
+  assigned[4] = measurement(4);
+  assigned = std::move(moved);
+  EXPECT_EQ(read(assigned, 0), measurement(0));
+  EXPECT_EQ(read(assigned, 3), measurement(3));
+  EXPECT_EQ(read(assigned, 4), yoga::CachedMeasurement{});
+  EXPECT_EQ(&read(assigned, 3), overflow);
+}
+
+} // namespace facebook::react
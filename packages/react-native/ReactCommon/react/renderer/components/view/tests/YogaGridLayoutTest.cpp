@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <yoga/Yoga.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::react {
+
+static YGNodeRef createGrid(
+    yoga::GridTrackList columns,
+    yoga::GridTrackList rows = {}) {
+  auto grid = YGNodeNew();
+  YGNodeStyleSetDisplay(grid, YGDisplayGrid);
+  auto style = yoga::resolveRef(grid)->style();
+  style.setGridTemplateColumns(std::move(columns));
+  style.setGridTemplateRows(std::move(rows));
+  yoga::resolveRef(grid)->setStyle(style);
+  return grid;
+}
+
+static YGNodeRef addItem(
+    YGNodeRef grid,
+    yoga::GridPlacement column = {},
+    yoga::GridPlacement row = {}) {
+  auto item = YGNodeNew();
+  auto style = yoga::resolveRef(item)->style();
+  style.setGridColumn(column);
+  style.setGridRow(row);
+  yoga::resolveRef(item)->setStyle(style);
+  YGNodeInsertChild(grid, item, YGNodeGetChildCount(grid));
+  return item;
+}
+
+static yoga::GridPlacement lines(int16_t start, int16_t end) {
+  return yoga::GridPlacement{.start = start, .end = end};
+}
+
+static yoga::GridPlacement span(uint16_t span) {
+  return yoga::GridPlacement{.span = span};
+}
+
+#define EXPECT_FRAME(node, left, top, width, height) \
+  EXPECT_EQ(YGNodeLayoutGetLeft(node), left);        \
+  EXPECT_EQ(YGNodeLayoutGetTop(node), top);          \
+  EXPECT_EQ(YGNodeLayoutGetWidth(node), width);      \
+  EXPECT_EQ(YGNodeLayoutGetHeight(node), height)
+
+TEST(YogaGridLayoutTest, autoPlacesItemsInRows) {
+  auto grid =
+      createGrid(yoga::GridTrackList(3, yoga::GridTrackSize::points(100)));
+  YGNodeRef items[5];
+  for (auto& item : items) {
+    item = addItem(grid);
+    YGNodeStyleSetHeight(item, 20);
+  }
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  EXPECT_EQ(YGNodeLayoutGetWidth(grid), 300);
+  EXPECT_EQ(YGNodeLayoutGetHeight(grid), 40);
+  EXPECT_FRAME(items[0], 0, 0, 100, 20);
+  EXPECT_FRAME(items[2], 200, 0, 100, 20);
+  EXPECT_FRAME(items[3], 0, 20, 100, 20);
+  EXPECT_FRAME(items[4], 100, 20, 100, 20);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, placesItemsOnDefiniteLines) {
+  auto grid = createGrid(
+      yoga::GridTrackList(3, yoga::GridTrackSize::points(100)),
+      yoga::GridTrackList(3, yoga::GridTrackSize::points(20)));
+  auto header = addItem(grid, lines(1, -1));
+  auto last = addItem(grid, lines(-2, 0), lines(-2, 0));
+  auto reversed = addItem(grid, lines(3, 1), lines(3, 0));
+  auto spanning = addItem(grid, span(2));
+  auto endOnly = addItem(grid, lines(0, 2), lines(0, 3));
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  // "1 / -1" spans all of the explicit columns
+  EXPECT_FRAME(header, 0, 0, 300, 20);
+  // Line -2 starts the last explicit track
+  EXPECT_FRAME(last, 200, 40, 100, 20);
+  // "3 / 1" is the same as "1 / 3"
+  EXPECT_FRAME(reversed, 0, 40, 200, 20);
+  // An item with only an end line ends on it
+  EXPECT_FRAME(endOnly, 0, 20, 100, 20);
+  // Auto placed items skip the cells taken by the other items
+  EXPECT_FRAME(spanning, 100, 20, 200, 20);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, addsImplicitTracksPastTheExplicitGrid) {
+  auto grid = createGrid({yoga::GridTrackSize::points(100)});
+  auto first = addItem(grid);
+  auto outside = addItem(grid, lines(3, 0));
+  YGNodeStyleSetHeight(first, 20);
+  YGNodeStyleSetWidth(outside, 50);
+  YGNodeStyleSetHeight(outside, 30);
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  // Implicit tracks are `auto`, so the second column is empty
+  EXPECT_EQ(YGNodeLayoutGetWidth(grid), 150);
+  EXPECT_FRAME(first, 0, 0, 100, 20);
+  EXPECT_FRAME(outside, 100, 0, 50, 30);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, fractionsShareTheSpaceLeft) {
+  auto grid = createGrid({
+      yoga::GridTrackSize::fraction(1),
+      yoga::GridTrackSize::points(100),
+      yoga::GridTrackSize::fraction(3),
+  });
+  YGNodeStyleSetWidth(grid, 500);
+  YGNodeRef items[3];
+  for (auto& item : items) {
+    item = addItem(grid);
+  }
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  EXPECT_FRAME(items[0], 0, 0, 100, 0);
+  EXPECT_FRAME(items[1], 100, 0, 100, 0);
+  EXPECT_FRAME(items[2], 200, 0, 300, 0);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, fractionsFitTheirItemsWithoutDefiniteWidth) {
+  auto grid = createGrid({
+      yoga::GridTrackSize::fraction(1),
+      yoga::GridTrackSize::fraction(2),
+  });
+  auto item = addItem(grid);
+  YGNodeStyleSetWidth(item, 40);
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  // The widest item per `fr` sets the size of all fractions
+  EXPECT_EQ(YGNodeLayoutGetWidth(grid), 120);
+  EXPECT_EQ(YGNodeLayoutGetWidth(YGNodeGetChild(grid, 0)), 40);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, autoTracksFitTheirItems) {
+  auto grid = createGrid(
+      {yoga::GridTrackSize::ofAuto(), yoga::GridTrackSize::fraction(1)});
+  YGNodeStyleSetWidth(grid, 300);
+  auto label = addItem(grid);
+  YGNodeStyleSetWidth(label, 80);
+  YGNodeStyleSetHeight(label, 20);
+  auto value = addItem(grid);
+  YGNodeStyleSetHeight(value, 30);
+  auto spanning = addItem(grid, span(2));
+  YGNodeStyleSetHeight(spanning, 10);
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  // Items are stretched to the height of their row
+  EXPECT_FRAME(label, 0, 0, 80, 20);
+  EXPECT_FRAME(value, 80, 0, 220, 30);
+  EXPECT_FRAME(spanning, 0, 30, 300, 10);
+  EXPECT_EQ(YGNodeLayoutGetHeight(grid), 40);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, separatesTracksByGaps) {
+  auto grid =
+      createGrid(yoga::GridTrackList(2, yoga::GridTrackSize::fraction(1)));
+  YGNodeStyleSetWidth(grid, 210);
+  YGNodeStyleSetPadding(grid, YGEdgeAll, 5);
+  YGNodeStyleSetGap(grid, YGGutterColumn, 10);
+  YGNodeStyleSetGap(grid, YGGutterRow, 4);
+  YGNodeRef items[3];
+  for (auto& item : items) {
+    item = addItem(grid);
+    YGNodeStyleSetHeight(item, 20);
+  }
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  EXPECT_FRAME(items[0], 5, 5, 95, 20);
+  EXPECT_FRAME(items[1], 110, 5, 95, 20);
+  EXPECT_FRAME(items[2], 5, 29, 95, 20);
+  EXPECT_EQ(YGNodeLayoutGetHeight(grid), 54);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, placesColumnsFromTheRightInRTL) {
+  auto grid = createGrid({
+      yoga::GridTrackSize::points(100),
+      yoga::GridTrackSize::points(50),
+  });
+  YGNodeStyleSetWidth(grid, 200);
+  YGNodeStyleSetPadding(grid, YGEdgeLeft, 10);
+  YGNodeStyleSetGap(grid, YGGutterColumn, 5);
+  auto first = addItem(grid);
+  auto second = addItem(grid);
+  auto margined = addItem(grid);
+  YGNodeStyleSetMargin(margined, YGEdgeRight, 20);
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionRTL);
+
+  EXPECT_FRAME(first, 100, 0, 100, 0);
+  EXPECT_FRAME(second, 45, 0, 50, 0);
+  EXPECT_FRAME(margined, 100, 0, 80, 0);
+
+  YGNodeFreeRecursive(grid);
+}
+
+TEST(YogaGridLayoutTest, setsTracksAndPlacementThroughTheCApi) {
+  auto grid = YGNodeNew();
+  YGNodeStyleSetDisplay(grid, YGDisplayGrid);
+  YGNodeStyleSetWidth(grid, 300);
+  const YGGridTrackSize columns[] = {
+      {100, YGGridTrackUnitPoint},
+      {0, YGGridTrackUnitAuto},
+      {1, YGGridTrackUnitFraction},
+  };
+  YGNodeStyleSetGridTemplateColumns(grid, columns, 3);
+  const YGGridTrackSize rows[] = {{25, YGGridTrackUnitPercent}};
+  YGNodeStyleSetGridTemplateRows(grid, rows, 1);
+  YGNodeStyleSetHeight(grid, 80);
+
+  auto item = YGNodeNew();
+  YGNodeStyleSetGridColumnStart(item, 2);
+  YGNodeStyleSetGridColumnSpan(item, 2);
+  YGNodeStyleSetGridRowStart(item, -1);
+  YGNodeStyleSetGridRowEnd(item, -2);
+  YGNodeInsertChild(grid, item, 0);
+
+  ASSERT_EQ(YGNodeStyleGetGridTemplateColumnCount(grid), 3);
+  EXPECT_EQ(YGNodeStyleGetGridTemplateColumn(grid, 0).value, 100);
+  EXPECT_EQ(
+      YGNodeStyleGetGridTemplateColumn(grid, 2).unit, YGGridTrackUnitFraction);
+  ASSERT_EQ(YGNodeStyleGetGridTemplateRowCount(grid), 1);
+  EXPECT_EQ(
+      YGNodeStyleGetGridTemplateRow(grid, 0).unit, YGGridTrackUnitPercent);
+  EXPECT_EQ(YGNodeStyleGetGridColumnStart(item), 2);
+  EXPECT_EQ(YGNodeStyleGetGridColumnEnd(item), 0);
+  EXPECT_EQ(YGNodeStyleGetGridColumnSpan(item), 2);
+  EXPECT_EQ(YGNodeStyleGetGridRowStart(item), -1);
+  EXPECT_EQ(YGNodeStyleGetGridRowEnd(item), -2);
+  EXPECT_EQ(YGNodeStyleGetGridRowSpan(item), 1);
+
+  YGNodeCalculateLayout(grid, YGUndefined, YGUndefined, YGDirectionLTR);
+
+  // Spans the auto and 1fr columns, which share the 200 points left
+  EXPECT_FRAME(item, 100, 0, 200, 20);
+
+  // Setting an unchanged value leaves the layout clean
+  YGNodeStyleSetGridColumnStart(item, 2);
+  YGNodeStyleSetGridTemplateRows(grid, rows, 1);
+  EXPECT_FALSE(YGNodeIsDirty(grid));
+
+  YGNodeStyleSetGridTemplateColumns(grid, nullptr, 0);
+  EXPECT_EQ(YGNodeStyleGetGridTemplateColumnCount(grid), 0);
+  EXPECT_TRUE(YGNodeIsDirty(grid));
+
+  YGNodeFreeRecursive(grid);
+}
+
+} // namespace facebook::react
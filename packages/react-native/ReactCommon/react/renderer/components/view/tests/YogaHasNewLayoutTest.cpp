@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <yoga/Yoga.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::react {
+
+// Reads back new layout results like `YogaLayoutableShadowNode::layout`
+// does, only walking the children of nodes with new layouts below them.
+static void readNewLayout(
+    yoga::Node* node,
+    std::vector<const yoga::Node*>& nodesRead) {
+  if (!node->getHasNewLayoutInDescendants()) {
+    return;
+  }
+  node->setHasNewLayoutInDescendants(false);
+  for (auto child : node->getChildren()) {
+    if (child->getHasNewLayout()) {
+      child->setHasNewLayout(false);
+      nodesRead.push_back(child);
+      readNewLayout(child, nodesRead);
+    }
+  }
+}
+
+static std::vector<const yoga::Node*> readNewLayout(YGNodeRef root) {
+  std::vector<const yoga::Node*> nodesRead;
+  yoga::resolveRef(root)->setHasNewLayout(false);
+  readNewLayout(yoga::resolveRef(root), nodesRead);
+  return nodesRead;
+}
+
+TEST(YogaHasNewLayoutTest, descendantsOfCachedLayoutsHaveNoNewLayout) {
+  auto root = YGNodeNew();
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  auto changing = YGNodeNew();
+  YGNodeStyleSetWidth(changing, 50);
+  YGNodeInsertChild(root, changing, 0);
+  auto cached = YGNodeNew();
+  YGNodeStyleSetWidth(cached, 100);
+  YGNodeInsertChild(root, cached, 1);
+  auto cachedChild = YGNodeNew();
+  YGNodeStyleSetHeight(cachedChild, 20);
+  YGNodeInsertChild(cached, cachedChild, 0);
+
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_TRUE(yoga::resolveRef(root)->getHasNewLayoutInDescendants());
+  EXPECT_TRUE(yoga::resolveRef(cached)->getHasNewLayoutInDescendants());
+  EXPECT_FALSE(yoga::resolveRef(cachedChild)->getHasNewLayoutInDescendants());
+  readNewLayout(root);
+
+  // Moving `cached` gives it a new layout, but from its cache, so nothing
+  // below it is laid out again
+  YGNodeStyleSetWidth(changing, 60);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_TRUE(yoga::resolveRef(root)->getHasNewLayoutInDescendants());
+  EXPECT_TRUE(YGNodeGetHasNewLayout(cached));
+  EXPECT_FALSE(yoga::resolveRef(cached)->getHasNewLayoutInDescendants());
+  EXPECT_FALSE(YGNodeGetHasNewLayout(cachedChild));
+  EXPECT_EQ(YGNodeLayoutGetLeft(cached), 60);
+  readNewLayout(root);
+
+  // Changing what is below `cached` lays it out again
+  YGNodeStyleSetHeight(cachedChild, 30);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_TRUE(yoga::resolveRef(cached)->getHasNewLayoutInDescendants());
+  EXPECT_TRUE(YGNodeGetHasNewLayout(cachedChild));
+
+  YGNodeFreeRecursive(root);
+}
+
+TEST(YogaHasNewLayoutTest, absoluteDescendantsOfCachedStaticNodesAreRead) {
+  auto root = YGNodeNew();
+  YGNodeStyleSetWidth(root, 300);
+  YGNodeStyleSetHeight(root, 300);
+  auto staticNode = YGNodeNew();
+  YGNodeStyleSetPositionType(staticNode, YGPositionTypeStatic);
+  YGNodeStyleSetWidth(staticNode, 100);
+  YGNodeStyleSetHeight(staticNode, 100);
+  YGNodeInsertChild(root, staticNode, 0);
+  auto absoluteNode = YGNodeNew();
+  YGNodeStyleSetPositionType(absoluteNode, YGPositionTypeAbsolute);
+  YGNodeStyleSetWidthPercent(absoluteNode, 50);
+  YGNodeInsertChild(staticNode, absoluteNode, 0);
+
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  readNewLayout(root);
+  EXPECT_EQ(YGNodeLayoutGetWidth(absoluteNode), 150);
+
+  // The static node keeps its size and is laid out from its cache, while its
+  // absolute child is laid out again by the root, its containing block
+  YGNodeStyleSetWidth(root, 400);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetWidth(absoluteNode), 200);
+  auto nodesRead = readNewLayout(root);
+  EXPECT_NE(
+      std::find(
+          nodesRead.begin(), nodesRead.end(), yoga::resolveRef(absoluteNode)),
+      nodesRead.end());
+  EXPECT_FALSE(YGNodeGetHasNewLayout(absoluteNode));
+
+  YGNodeFreeRecursive(root);
+}
+
+} // namespace facebook::react
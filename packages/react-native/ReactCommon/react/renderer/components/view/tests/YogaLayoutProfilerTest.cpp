@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutProfiler.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <yoga/Yoga.h>
+#include <yoga/debug/LayoutProfiler.h>
+
+namespace facebook::react {
+
+static YGSize measureText(
+    YGNodeConstRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  if (widthMode == YGMeasureModeUndefined || width >= 100) {
+    return {100, 20};
+  }
+  return {width, 40};
+}
+
+TEST(YogaLayoutProfilerTest, profilesNodesLaidOutWhileActive) {
+  auto root = YGNodeNew();
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  auto text = YGNodeNew();
+  YGNodeSetMeasureFunc(text, measureText);
+  YGNodeStyleSetFlexShrink(text, 1);
+  YGNodeInsertChild(root, text, 0);
+
+  yoga::LayoutProfiler profiler;
+  {
+    yoga::LayoutProfiler::Scope scope{profiler};
+    YGNodeCalculateLayout(root, 60, YGUndefined, YGDirectionLTR);
+  }
+
+  const auto& profiles = profiler.getNodeProfiles();
+  ASSERT_EQ(profiles.count(yoga::resolveRef(text)), 1);
+  const auto& textProfile = profiles.at(yoga::resolveRef(text));
+  EXPECT_GT(textProfile.measures, 0);
+  EXPECT_GT(textProfile.measureCallbacks, 0);
+  uint32_t cacheMisses = 0;
+  for (auto count : textProfile.cacheMissesByReason) {
+    cacheMisses += count;
+  }
+  EXPECT_EQ(cacheMisses, textProfile.layouts + textProfile.measures);
+  EXPECT_GT(
+      textProfile.cacheMissesByReason[static_cast<size_t>(
+          yoga::LayoutPassReason::kMeasureChild)],
+      0);
+  EXPECT_EQ(profiles.at(yoga::resolveRef(root)).layouts, 1);
+
+  // A pass without an active profiler isn't recorded
+  auto visits = textProfile.visits();
+  YGNodeMarkDirty(text);
+  YGNodeCalculateLayout(root, 60, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(
+      profiler.getNodeProfiles().at(yoga::resolveRef(text)).visits(), visits);
+
+  // Nothing changed, so the layout of the root comes from its cache
+  profiler.clear();
+  {
+    yoga::LayoutProfiler::Scope scope{profiler};
+    YGNodeCalculateLayout(root, 60, YGUndefined, YGDirectionLTR);
+  }
+  EXPECT_EQ(profiler.getNodeProfiles().at(yoga::resolveRef(root)).layouts, 0);
+  EXPECT_EQ(
+      profiler.getNodeProfiles().at(yoga::resolveRef(root)).cachedLayouts, 1);
+  EXPECT_EQ(profiler.getNodeProfiles().count(yoga::resolveRef(text)), 0);
+
+  YGNodeFreeRecursive(root);
+}
+
+TEST(YogaLayoutProfilerTest, attributesProfilesToComponents) {
+  auto builder = simpleComponentBuilder();
+  std::shared_ptr<RootShadowNode> rootShadowNode;
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .children({
+              Element<ViewShadowNode>()
+                .tag(3)
+            }),
+          Element<ViewShadowNode>()
+            .tag(4)
+        });
+  // clang-format on
+  builder.build(element);
+
+  YogaLayoutProfiler::setEnabled(true);
+  rootShadowNode->layoutIfNeeded();
+  YogaLayoutProfiler::setEnabled(false);
+  auto profiles = YogaLayoutProfiler::takeProfiles();
+  EXPECT_TRUE(YogaLayoutProfiler::takeProfiles().empty());
+
+  ASSERT_EQ(profiles.size(), 2);
+  ASSERT_EQ(profiles.count("RootView"), 1);
+  ASSERT_EQ(profiles.count("View"), 1);
+  EXPECT_EQ(profiles.at("RootView").layouts, 1);
+  // The profiles of the three views are added up
+  EXPECT_GE(profiles.at("View").layouts, 3);
+
+  auto dynamic = YogaLayoutProfiler::toDynamic(profiles);
+  ASSERT_TRUE(dynamic.isObject());
+  EXPECT_EQ(dynamic.size(), 2);
+  EXPECT_EQ(dynamic["RootView"]["layouts"], 1);
+  EXPECT_EQ(
+      dynamic["RootView"]["cacheMissesByReason"],
+      folly::dynamic::object("initial", 1));
+  EXPECT_EQ(dynamic["View"]["visits"], profiles.at("View").visits());
+  EXPECT_EQ(dynamic["View"]["measureCallbacks"], 0);
+  EXPECT_TRUE(dynamic["View"]["measureCallbackDurationMs"].isDouble());
+}
+
+} // namespace facebook::react
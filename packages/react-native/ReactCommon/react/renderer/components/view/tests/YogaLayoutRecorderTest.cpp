@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutRecorder.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <yoga/debug/LayoutReplay.h>
+#include <yoga/debug/LayoutSnapshot.h>
+
+namespace facebook::react {
+
+static std::shared_ptr<RootShadowNode> buildTree(ComponentBuilder& builder) {
+  std::shared_ptr<RootShadowNode> rootShadowNode;
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .props([] {
+              auto props = std::make_shared<ViewShadowNodeProps>();
+              props->yogaStyle.setFlexDirection(yoga::FlexDirection::Row);
+              return props;
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .tag(3)
+                .props([] {
+                  auto props = std::make_shared<ViewShadowNodeProps>();
+                  props->yogaStyle.setDimension(
+                      yoga::Dimension::Width, yoga::value::points(100));
+                  props->yogaStyle.setDimension(
+                      yoga::Dimension::Height, yoga::value::points(50));
+                  return props;
+                })
+            })
+        });
+  // clang-format on
+  builder.build(element);
+  return rootShadowNode;
+}
+
+TEST(YogaLayoutRecorderTest, recordsLayoutPassesWhileACallbackIsSet) {
+  auto builder = simpleComponentBuilder();
+  std::vector<std::string> snapshots;
+  YogaLayoutRecorder::setSnapshotCallback([&](std::string&& snapshot) {
+    snapshots.push_back(std::move(snapshot));
+  });
+  EXPECT_TRUE(YogaLayoutRecorder::isRecording());
+
+  auto rootShadowNode = buildTree(builder);
+  rootShadowNode->layoutIfNeeded();
+  YogaLayoutRecorder::setSnapshotCallback(nullptr);
+  EXPECT_FALSE(YogaLayoutRecorder::isRecording());
+
+  ASSERT_EQ(snapshots.size(), 1);
+  auto snapshot = yoga::deserializeLayoutSnapshot(snapshots.front());
+  ASSERT_TRUE(snapshot.has_value());
+  ASSERT_EQ(snapshot->nodes.size(), 3);
+  EXPECT_EQ(snapshot->nodes[2].frame.width, 100);
+  EXPECT_EQ(snapshot->nodes[2].frame.height, 50);
+
+  // The snapshot lays out the same when replayed
+  yoga::LayoutReplay replay{std::move(*snapshot)};
+  replay.run();
+  EXPECT_TRUE(replay.mismatchedNodes().empty());
+
+  // Nothing is recorded once the callback is unset
+  buildTree(builder)->layoutIfNeeded();
+  EXPECT_EQ(snapshots.size(), 1);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <yoga/Yoga.h>
+#include <yoga/debug/LayoutReplay.h>
+#include <yoga/debug/LayoutSnapshot.h>
+
+namespace facebook::react {
+
+static int measureCallCount = 0;
+
+static YGSize measureText(
+    YGNodeConstRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  measureCallCount++;
+  constexpr float textWidth = 120;
+  if (widthMode == YGMeasureModeUndefined || width >= textWidth) {
+    return {textWidth, 20};
+  }
+  return {width, 40};
+}
+
+static float baselineAtTwoThirds(
+    YGNodeConstRef /*node*/,
+    float /*width*/,
+    float height) {
+  return height * 2 / 3;
+}
+
+/*
+ * A row of a label and a badge aligned on their baselines, above a wrapping
+ * paragraph.
+ */
+static YGNodeRef createTree(YGConfigRef config) {
+  auto root = YGNodeNewWithConfig(config);
+  YGNodeStyleSetPadding(root, YGEdgeAll, 8);
+
+  auto row = YGNodeNewWithConfig(config);
+  YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(row, YGAlignBaseline);
+  auto label = YGNodeNewWithConfig(config);
+  YGNodeSetMeasureFunc(label, measureText);
+  auto badge = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(badge, 24);
+  YGNodeStyleSetHeight(badge, 30);
+  YGNodeSetBaselineFunc(badge, baselineAtTwoThirds);
+  YGNodeInsertChild(row, label, 0);
+  YGNodeInsertChild(row, badge, 1);
+  YGNodeInsertChild(root, row, 0);
+
+  auto paragraph = YGNodeNewWithConfig(config);
+  YGNodeStyleSetMarginPercent(paragraph, YGEdgeTop, 5);
+  YGNodeSetMeasureFunc(paragraph, measureText);
+  YGNodeInsertChild(root, paragraph, 1);
+  return root;
+}
+
+TEST(YogaLayoutSnapshotTest, recordingLeavesTheTreeUntouched) {
+  auto config = YGConfigNew();
+  auto root = createTree(config);
+
+  measureCallCount = 0;
+  auto snapshot = yoga::recordLayout(
+      yoga::resolveRef(root), 100, YGUndefined, yoga::Direction::LTR);
+
+  EXPECT_GT(measureCallCount, 0);
+  EXPECT_EQ(snapshot.nodes.size(), 5);
+  EXPECT_EQ(snapshot.nodes[0].children, (std::vector<uint32_t>{1, 4}));
+  EXPECT_EQ(snapshot.nodes[0].frame.width, 100);
+  EXPECT_FALSE(snapshot.nodes[2].measurements.empty());
+  EXPECT_FALSE(snapshot.nodes[3].baselines.empty());
+  EXPECT_TRUE(YGNodeIsDirty(root));
+  EXPECT_TRUE(YGFloatIsUndefined(YGNodeLayoutGetWidth(root)));
+
+  YGNodeFreeRecursive(root);
+  YGConfigFree(config);
+}
+
+TEST(YogaLayoutSnapshotTest, replayMatchesRecordedLayout) {
+  auto config = YGConfigNew();
+  YGConfigSetPointScaleFactor(config, 3);
+  auto root = createTree(config);
+  YGNodeCalculateLayout(root, 100, YGUndefined, YGDirectionRTL);
+
+  auto data = yoga::serializeLayoutSnapshot(yoga::recordLayout(
+      yoga::resolveRef(root), 100, YGUndefined, yoga::Direction::RTL));
+  auto snapshot = yoga::deserializeLayoutSnapshot(data);
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(snapshot->pointScaleFactor, 3);
+  EXPECT_EQ(
+      snapshot->nodes[4].style, yoga::resolveRef(root)->getChild(1)->style());
+
+  yoga::LayoutReplay replay{std::move(*snapshot)};
+  measureCallCount = 0;
+  for (int i = 0; i < 2; i++) {
+    replay.run();
+    EXPECT_TRUE(replay.mismatchedNodes().empty());
+  }
+  EXPECT_EQ(measureCallCount, 0);
+  EXPECT_EQ(replay.getUnrecordedCallCount(), 0);
+  EXPECT_EQ(
+      replay.getNode(4)->getLayout().position(yoga::PhysicalEdge::Top),
+      YGNodeLayoutGetTop(YGNodeGetChild(root, 1)));
+
+  YGNodeFreeRecursive(root);
+  YGConfigFree(config);
+}
+
+TEST(YogaLayoutSnapshotTest, rejectsMalformedData) {
+  auto config = YGConfigNew();
+  auto root = createTree(config);
+  auto data = yoga::serializeLayoutSnapshot(yoga::recordLayout(
+      yoga::resolveRef(root), 100, YGUndefined, yoga::Direction::LTR));
+
+  EXPECT_FALSE(yoga::deserializeLayoutSnapshot("").has_value());
+  EXPECT_FALSE(yoga::deserializeLayoutSnapshot(
+                   std::string_view{data}.substr(0, data.size() - 1))
+                   .has_value());
+  EXPECT_FALSE(yoga::deserializeLayoutSnapshot(data + "x").has_value());
+
+  YGNodeFreeRecursive(root);
+  YGConfigFree(config);
+}
+
+} // namespace facebook::react
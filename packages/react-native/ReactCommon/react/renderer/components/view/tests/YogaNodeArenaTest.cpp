@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <yoga/Yoga.h>
+#include <yoga/config/Config.h>
+#include <yoga/node/Node.h>
+#include <yoga/node/NodeArena.h>
+
+namespace facebook::react {
+
+class YogaNodeArenaTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    config_ = YGConfigNew();
+    YGConfigSetUseNodeArena(config_, true);
+  }
+
+  void TearDown() override {
+    if (config_ != nullptr) {
+      YGConfigFree(config_);
+    }
+  }
+
+  size_t allocatedCount() const {
+    return yoga::resolveRef(config_)->getNodeArena()->getAllocatedCount();
+  }
+
+  static bool isArenaAllocated(YGNodeConstRef node) {
+    return yoga::resolveRef(node)->isArenaAllocated();
+  }
+
+  YGConfigRef config_{nullptr};
+};
+
+TEST_F(YogaNodeArenaTest, freedNodesAreReused) {
+  auto first = YGNodeNewWithConfig(config_);
+  auto second = YGNodeNewWithConfig(config_);
+  EXPECT_TRUE(isArenaAllocated(first));
+  EXPECT_NE(first, second);
+  EXPECT_EQ(allocatedCount(), 2);
+
+  YGNodeFree(first);
+  EXPECT_EQ(allocatedCount(), 1);
+
+  // The slot of the last freed node is handed out first
+  auto third = YGNodeNewWithConfig(config_);
+  EXPECT_EQ(third, first);
+  EXPECT_TRUE(isArenaAllocated(third));
+  EXPECT_EQ(allocatedCount(), 2);
+
+  // A reused slot holds a fresh node
+  EXPECT_EQ(YGNodeGetChildCount(third), 0);
+  EXPECT_TRUE(YGFloatIsUndefined(YGNodeLayoutGetWidth(third)));
+
+  YGNodeFree(second);
+  YGNodeFree(third);
+  EXPECT_EQ(allocatedCount(), 0);
+}
+
+TEST_F(YogaNodeArenaTest, freeingATreeReturnsEveryNode) {
+  auto root = YGNodeNewWithConfig(config_);
+  for (size_t i = 0; i < 300; i++) {
+    YGNodeInsertChild(root, YGNodeNewWithConfig(config_), i);
+  }
+  EXPECT_EQ(allocatedCount(), 301);
+
+  YGNodeFreeRecursive(root);
+  EXPECT_EQ(allocatedCount(), 0);
+}
+
+TEST_F(YogaNodeArenaTest, clonesFollowTheConfigOfTheSource) {
+  YGConfigSetUseNodeArena(config_, false);
+  auto heapNode = YGNodeNewWithConfig(config_);
+  YGNodeStyleSetWidth(heapNode, 100);
+  EXPECT_FALSE(isArenaAllocated(heapNode));
+
+  // Cloning a heap node into the arena
+  YGConfigSetUseNodeArena(config_, true);
+  auto arenaClone = YGNodeClone(heapNode);
+  EXPECT_TRUE(isArenaAllocated(arenaClone));
+  EXPECT_EQ(YGNodeStyleGetWidth(arenaClone).value, 100);
+  EXPECT_EQ(allocatedCount(), 1);
+
+  // Cloning an arena node out of it must not keep its arena flag, or freeing
+  // the clone would treat a heap allocation as an arena slot
+  YGConfigSetUseNodeArena(config_, false);
+  auto heapClone = YGNodeClone(arenaClone);
+  EXPECT_FALSE(isArenaAllocated(heapClone));
+  EXPECT_EQ(YGNodeStyleGetWidth(heapClone).value, 100);
+  EXPECT_EQ(allocatedCount(), 1);
+
+  YGNodeFree(heapClone);
+  YGNodeFree(arenaClone);
+  YGNodeFree(heapNode);
+  EXPECT_EQ(allocatedCount(), 0);
+}
+
+TEST_F(YogaNodeArenaTest, nodesCanBeFreedAfterTheArenaIsDisabled) {
+  auto arenaNode = YGNodeNewWithConfig(config_);
+  YGConfigSetUseNodeArena(config_, false);
+  EXPECT_FALSE(YGConfigGetUseNodeArena(config_));
+
+  auto heapNode = YGNodeNewWithConfig(config_);
+  EXPECT_FALSE(isArenaAllocated(heapNode));
+  YGNodeInsertChild(arenaNode, heapNode, 0);
+  YGNodeRemoveChild(arenaNode, heapNode);
+  YGNodeFree(heapNode);
+
+  // The slot still goes back to the arena, which is kept around
+  YGNodeFree(arenaNode);
+  EXPECT_EQ(allocatedCount(), 0);
+
+  YGConfigSetUseNodeArena(config_, true);
+  EXPECT_EQ(YGNodeNewWithConfig(config_), arenaNode);
+  EXPECT_EQ(allocatedCount(), 1);
+}
+
+TEST_F(YogaNodeArenaTest, resetFreesEveryNodeAndKeepsTheMemory) {
+  auto root = YGNodeNewWithConfig(config_);
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  for (size_t i = 0; i < 3; i++) {
+    auto child = YGNodeNewWithConfig(config_);
+    YGNodeStyleSetWidth(child, 10);
+    YGNodeInsertChild(root, child, i);
+  }
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetWidth(root), 30);
+  EXPECT_EQ(allocatedCount(), 4);
+
+  YGConfigResetNodeArena(config_);
+  EXPECT_EQ(allocatedCount(), 0);
+
+  // The next tree starts over at the first slot
+  auto nextRoot = YGNodeNewWithConfig(config_);
+  EXPECT_EQ(nextRoot, root);
+  EXPECT_EQ(YGNodeGetChildCount(nextRoot), 0);
+  EXPECT_EQ(allocatedCount(), 1);
+
+  // Resetting twice, or an arena which was never used, is fine
+  YGConfigResetNodeArena(config_);
+  YGConfigResetNodeArena(config_);
+  auto unusedConfig = YGConfigNew();
+  YGConfigResetNodeArena(unusedConfig);
+  YGConfigSetUseNodeArena(unusedConfig, true);
+  YGConfigResetNodeArena(unusedConfig);
+  YGConfigFree(unusedConfig);
+}
+
+TEST_F(YogaNodeArenaTest, freeingTheConfigFreesTheNodesLeft) {
+  auto root = YGNodeNewWithConfig(config_);
+  for (size_t i = 0; i < 3; i++) {
+    auto child = YGNodeNewWithConfig(config_);
+    // Children storage and some style values are heap allocated by each
+    // node, and would leak if the arena did not run the node destructors
+    YGNodeStyleSetWidthPercent(child, 33.3f);
+    YGNodeInsertChild(root, child, i);
+  }
+  YGNodeFree(YGNodeGetChild(root, 2));
+  EXPECT_EQ(allocatedCount(), 3);
+
+  YGConfigFree(config_);
+  config_ = nullptr;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <yoga/node/SmallVector.h>
+
+namespace facebook::react {
+
+// Two elements fit inline, the third one moves the vector to the heap
+using Vector = yoga::SmallVector<int, 2>;
+
+static std::vector<int> elements(const Vector& vector) {
+  return {vector.begin(), vector.end()};
+}
+
+static Vector makeInline() {
+  return Vector{1, 2};
+}
+
+static Vector makeHeap() {
+  return Vector{1, 2, 3, 4, 5};
+}
+
+TEST(YogaSmallVectorTest, pushBackMovesToTheHeapPastTheInlineCapacity) {
+  auto vector = Vector{};
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(vector.capacity(), 2);
+
+  vector.push_back(1);
+  vector.push_back(2);
+  const auto* inlineData = vector.data();
+  EXPECT_EQ(vector.capacity(), 2);
+
+  vector.push_back(3);
+  EXPECT_NE(vector.data(), inlineData);
+  EXPECT_EQ(vector.capacity(), 4);
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 2, 3}));
+
+  vector.push_back(4);
+  vector.push_back(5);
+  EXPECT_EQ(vector.capacity(), 8);
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(vector.at(4), 5);
+}
+
+TEST(YogaSmallVectorTest, insertKeepsOrderAcrossTheInlineBoundary) {
+  auto vector = Vector{1, 3};
+
+  // Inserting into a full inline vector moves it to the heap first
+  auto position = vector.insert(vector.begin() + 1, 2);
+  EXPECT_EQ(*position, 2);
+  EXPECT_EQ(vector.capacity(), 4);
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 2, 3}));
+
+  vector.insert(vector.begin(), 0);
+  vector.insert(vector.end(), 4);
+  EXPECT_EQ(elements(vector), (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(YogaSmallVectorTest, eraseAndClearKeepTheCapacity) {
+  auto vector = makeHeap();
+  const auto capacity = vector.capacity();
+
+  auto position = vector.erase(vector.begin() + 1);
+  EXPECT_EQ(*position, 3);
+  vector.erase(vector.end() - 1);
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 3, 4}));
+
+  vector.erase(vector.begin());
+  vector.erase(vector.begin());
+  EXPECT_EQ(elements(vector), (std::vector<int>{4}));
+  EXPECT_EQ(vector.capacity(), capacity);
+
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(vector.capacity(), capacity);
+
+  vector.push_back(6);
+  EXPECT_EQ(elements(vector), (std::vector<int>{6}));
+}
+
+TEST(YogaSmallVectorTest, shrinkToFitMovesBackInlineWhenPossible) {
+  auto vector = makeHeap();
+  vector.push_back(6);
+  EXPECT_EQ(vector.capacity(), 10);
+
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 6);
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+  // Already tight
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 6);
+
+  while (vector.size() > 2) {
+    vector.erase(vector.begin());
+  }
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 2);
+  EXPECT_EQ(elements(vector), (std::vector<int>{5, 6}));
+
+  // An inline vector can still grow again
+  vector.push_back(7);
+  EXPECT_EQ(elements(vector), (std::vector<int>{5, 6, 7}));
+
+  vector.clear();
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 2);
+  EXPECT_TRUE(vector.empty());
+}
+
+TEST(YogaSmallVectorTest, copyConstructionCopiesTheElements) {
+  for (const auto& source : {makeInline(), makeHeap()}) {
+    auto copy = Vector{source};
+    EXPECT_EQ(elements(copy), elements(source));
+    EXPECT_NE(copy.data(), source.data());
+
+    copy[0] = 42;
+    EXPECT_EQ(source[0], 1);
+  }
+}
+
+TEST(YogaSmallVectorTest, copyAssignmentCopiesTheElements) {
+  for (const auto& source : {makeInline(), makeHeap()}) {
+    for (auto target : {makeInline(), makeHeap(), Vector{}}) {
+      target = source;
+      EXPECT_EQ(elements(target), elements(source));
+      EXPECT_NE(target.data(), source.data());
+    }
+  }
+
+  auto vector = makeHeap();
+  const auto& alias = vector;
+  vector = alias;
+  EXPECT_EQ(elements(vector), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(YogaSmallVectorTest, moveConstructionEmptiesTheSource) {
+  auto inlineSource = makeInline();
+  auto inlineMoved = Vector{std::move(inlineSource)};
+  EXPECT_EQ(elements(inlineMoved), (std::vector<int>{1, 2}));
+  EXPECT_EQ(inlineMoved.capacity(), 2);
+  EXPECT_TRUE(inlineSource.empty());
+
+  // The heap buffer changes hands
+  auto heapSource = makeHeap();
+  const auto* heapData = heapSource.data();
+  auto heapMoved = Vector{std::move(heapSource)};
+  EXPECT_EQ(heapMoved.data(), heapData);
+  EXPECT_EQ(elements(heapMoved), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_TRUE(heapSource.empty());
+  EXPECT_EQ(heapSource.capacity(), 2);
+
+  // Moved-from vectors are usable
+  heapSource.push_back(9);
+  EXPECT_EQ(elements(heapSource), (std::vector<int>{9}));
+}
+
+TEST(YogaSmallVectorTest, moveAssignmentReleasesTheTarget) {
+  for (auto target : {makeInline(), makeHeap(), Vector{}}) {
+    auto inlineSource = Vector{7};
+    target = std::move(inlineSource);
+    EXPECT_EQ(elements(target), (std::vector<int>{7}));
+    EXPECT_EQ(target.capacity(), 2);
+    EXPECT_TRUE(inlineSource.empty());
+  }
+
+  for (auto target : {makeInline(), makeHeap(), Vector{}}) {
+    auto heapSource = makeHeap();
+    const auto* heapData = heapSource.data();
+    target = std::move(heapSource);
+    EXPECT_EQ(target.data(), heapData);
+    EXPECT_EQ(elements(target), (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_TRUE(heapSource.empty());
+    EXPECT_EQ(heapSource.capacity(), 2);
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/utils/ContextContainer.h>
+#include <string>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+// A plain layout container, the most common kind of `View`.
+auto layoutPropsDynamic = folly::parseJson(R"({
+  "flex": 1,
+  "flexDirection": "row",
+  "alignItems": "center",
+  "justifyContent": "space-between",
+  "paddingHorizontal": 16,
+  "paddingVertical": 8
+})");
+
+// A decorated "card" with borders, shadow and a transform.
+auto decoratedPropsDynamic = folly::parseJson(R"({
+  "margin": 8,
+  "padding": 12,
+  "backgroundColor": 4294967295,
+  "borderRadius": 12,
+  "borderWidth": 1,
+  "borderColor": 4292927712,
+  "shadowColor": 4278190080,
+  "shadowOpacity": 0.2,
+  "shadowRadius": 6,
+  "shadowOffset": {"width": 0, "height": 2},
+  "opacity": 0.9,
+  "transform": [{"translateY": 4}, {"scale": 0.98}]
+})");
+
+// An interactive, accessible element (e.g. a list row acting as a button).
+auto accessiblePropsDynamic = folly::parseJson(R"({
+  "height": 48,
+  "flexDirection": "row",
+  "accessible": true,
+  "accessibilityRole": "button",
+  "accessibilityLabel": "Open conversation",
+  "accessibilityHint": "Double tap to open the conversation",
+  "accessibilityLanguage": "en-US",
+  "accessibilityState": {"disabled": false, "selected": true},
+  "accessibilityValue": {"min": 0, "max": 10, "now": 3},
+  "accessibilityActions": [{"name": "activate"}, {"name": "longpress", "label": "More"}],
+  "testID": "conversation-row",
+  "nativeID": "row",
+  "onLayout": true
+})");
+
+static void viewNodeCreation(
+    benchmark::State& state,
+    const folly::dynamic& propsDynamic) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto tag = Tag{1};
+  for (auto _ : state) {
+    auto family = viewComponentDescriptor.createFamily(ShadowNodeFamilyFragment{
+        /* .tag = */ tag++,
+        /* .surfaceId = */ 1,
+        /* .instanceHandle = */ nullptr,
+    });
+    auto props = viewComponentDescriptor.cloneProps(
+        parserContext, nullptr, RawProps{propsDynamic});
+    auto shadowNode = viewComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{/* .props = */ props}, family);
+    benchmark::DoNotOptimize(shadowNode);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(viewNodeCreation, layout, layoutPropsDynamic);
+BENCHMARK_CAPTURE(viewNodeCreation, decorated, decoratedPropsDynamic);
+BENCHMARK_CAPTURE(viewNodeCreation, accessible, accessiblePropsDynamic);
+
+static void viewNodeCloneWithUnchangedProps(
+    benchmark::State& state,
+    const folly::dynamic& propsDynamic) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto sourceProps = viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{propsDynamic});
+  auto emptyPropsDynamic = folly::dynamic::object();
+  for (auto _ : state) {
+    auto props = viewComponentDescriptor.cloneProps(
+        parserContext, sourceProps, RawProps{emptyPropsDynamic});
+    benchmark::DoNotOptimize(props);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(viewNodeCloneWithUnchangedProps, layout, layoutPropsDynamic);
+BENCHMARK_CAPTURE(
+    viewNodeCloneWithUnchangedProps,
+    accessible,
+    accessiblePropsDynamic);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
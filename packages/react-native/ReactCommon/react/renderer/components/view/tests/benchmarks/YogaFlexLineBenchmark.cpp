@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+
+namespace facebook::react {
+
+/*
+ * A row of `chipCount` chips, like a chip group or a scrollable tab bar.
+ * Chips have a preferred width, grow and shrink from it, and are limited by
+ * min and max widths, so every layout resolves the flexible lengths of the
+ * whole row. With `wrap`, chips are spread over lines of about ten chips.
+ */
+static YGNodeRef createChipRow(YGConfigRef config, int chipCount, bool wrap) {
+  auto row = YGNodeNewWithConfig(config);
+  YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+  YGNodeStyleSetJustifyContent(row, YGJustifySpaceBetween);
+  YGNodeStyleSetGap(row, YGGutterAll, 8);
+  YGNodeStyleSetPadding(row, YGEdgeHorizontal, 16);
+  if (wrap) {
+    YGNodeStyleSetFlexWrap(row, YGWrapWrap);
+  }
+
+  for (int i = 0; i < chipCount; i++) {
+    auto chip = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexBasis(chip, static_cast<float>(48 + (i % 7) * 12));
+    YGNodeStyleSetFlexGrow(chip, i % 3 == 0 ? 2 : 1);
+    YGNodeStyleSetFlexShrink(chip, 1);
+    YGNodeStyleSetMinWidth(chip, 40);
+    YGNodeStyleSetMaxWidth(chip, i % 5 == 0 ? 72 : 160);
+    YGNodeStyleSetHeight(chip, 32);
+    YGNodeStyleSetPadding(chip, YGEdgeHorizontal, 12);
+    YGNodeStyleSetBorder(chip, YGEdgeAll, 1);
+    YGNodeInsertChild(row, chip, static_cast<size_t>(i));
+  }
+  return row;
+}
+
+/*
+ * Lays out a row of chips at alternating widths, so that every pass has to
+ * grow or shrink all of them.
+ */
+static void yogaFlexLineLayout(benchmark::State& state) {
+  auto config = YGConfigNew();
+  auto chipCount = static_cast<int>(state.range(0));
+  auto wrap = state.range(1) != 0;
+  auto row = createChipRow(config, chipCount, wrap);
+
+  float baseWidth = wrap ? 1000 : static_cast<float>(chipCount) * 80;
+  float width = baseWidth;
+  for (auto _ : state) {
+    width = width == baseWidth ? baseWidth * 1.25f : baseWidth;
+    YGNodeStyleSetWidth(row, width);
+    YGNodeCalculateLayout(row, YGUndefined, YGUndefined, YGDirectionLTR);
+    benchmark::DoNotOptimize(YGNodeLayoutGetHeight(row));
+  }
+
+  YGNodeFreeRecursive(row);
+  YGConfigFree(config);
+  state.SetItemsProcessed(state.iterations() * chipCount);
+}
+BENCHMARK(yogaFlexLineLayout)
+    ->ArgNames({"chips", "wrap"})
+    ->Args({8, 0})
+    ->Args({100, 0})
+    ->Args({500, 0})
+    ->Args({500, 1});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <yoga/node/Node.h>
+
+#include <algorithm>
+
+namespace facebook::react {
+
+constexpr int kColumnCount = 10;
+constexpr float kGap = 4;
+
+/*
+ * A cell of text, which wraps to as many lines as its width requires.
+ */
+static YGSize measureCell(
+    YGNodeConstRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  constexpr float textWidth = 60;
+  constexpr float lineHeight = 18;
+  if (widthMode == YGMeasureModeUndefined || width >= textWidth) {
+    return {textWidth, lineHeight};
+  }
+  auto lines = static_cast<int>(textWidth / std::max(width, 1.0f)) + 1;
+  return {width, lineHeight * static_cast<float>(lines)};
+}
+
+static YGNodeRef createCell(YGConfigRef config) {
+  auto cell = YGNodeNewWithConfig(config);
+  YGNodeSetMeasureFunc(cell, measureCell);
+  return cell;
+}
+
+/*
+ * A table of `cellCount` cells in ten equal columns, as a single grid
+ * container.
+ */
+static YGNodeRef createGrid(YGConfigRef config, int cellCount) {
+  auto grid = YGNodeNewWithConfig(config);
+  YGNodeStyleSetDisplay(grid, YGDisplayGrid);
+  YGNodeStyleSetGap(grid, YGGutterAll, kGap);
+  auto style = yoga::resolveRef(grid)->style();
+  style.setGridTemplateColumns(yoga::GridTrackList(
+      kColumnCount, yoga::GridTrackSize::fraction(1)));
+  yoga::resolveRef(grid)->setStyle(style);
+
+  for (int i = 0; i < cellCount; i++) {
+    YGNodeInsertChild(grid, createCell(config), static_cast<size_t>(i));
+  }
+  return grid;
+}
+
+/*
+ * The same table built from flexbox: a column of rows, each with ten cells
+ * growing to the same width.
+ */
+static YGNodeRef createNestedFlex(YGConfigRef config, int cellCount) {
+  auto table = YGNodeNewWithConfig(config);
+  YGNodeStyleSetGap(table, YGGutterRow, kGap);
+  for (int i = 0; i < cellCount / kColumnCount; i++) {
+    auto row = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+    YGNodeStyleSetGap(row, YGGutterColumn, kGap);
+    for (int j = 0; j < kColumnCount; j++) {
+      auto cell = createCell(config);
+      YGNodeStyleSetFlexGrow(cell, 1);
+      YGNodeStyleSetFlexShrink(cell, 1);
+      YGNodeStyleSetFlexBasis(cell, 0);
+      YGNodeInsertChild(row, cell, static_cast<size_t>(j));
+    }
+    YGNodeInsertChild(table, row, static_cast<size_t>(i));
+  }
+  return table;
+}
+
+/*
+ * Lays out a table of 1000 cells at alternating widths, either as a grid
+ * (`grid` = 1) or as nested flex rows (`grid` = 0). Both produce the same
+ * cell frames.
+ */
+static void yogaGridLayout(benchmark::State& state) {
+  auto config = YGConfigNew();
+  auto useGrid = state.range(0) != 0;
+  auto cellCount = static_cast<int>(state.range(1));
+  auto table = useGrid ? createGrid(config, cellCount)
+                       : createNestedFlex(config, cellCount);
+
+  float width = 390;
+  for (auto _ : state) {
+    width = width == 390 ? 414 : 390;
+    YGNodeStyleSetWidth(table, width);
+    YGNodeCalculateLayout(table, YGUndefined, YGUndefined, YGDirectionLTR);
+    benchmark::DoNotOptimize(YGNodeLayoutGetHeight(table));
+  }
+
+  state.counters["height"] = YGNodeLayoutGetHeight(table);
+  YGNodeFreeRecursive(table);
+  YGConfigFree(config);
+  state.SetItemsProcessed(state.iterations() * cellCount);
+}
+BENCHMARK(yogaGridLayout)
+    ->ArgNames({"grid", "cells"})
+    ->Args({0, 1000})
+    ->Args({1, 1000});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <yoga/debug/LayoutReplay.h>
+#include <yoga/debug/LayoutSnapshot.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace facebook::react {
+
+static YGSize measureText(
+    YGNodeConstRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  constexpr float textWidth = 180;
+  constexpr float lineHeight = 18;
+  if (widthMode == YGMeasureModeUndefined || width >= textWidth) {
+    return {textWidth, lineHeight};
+  }
+  auto lines = static_cast<int>(textWidth / std::max(width, 1.0f)) + 1;
+  return {width, lineHeight * static_cast<float>(lines)};
+}
+
+/*
+ * Snapshot of a list of 500 rows made of an avatar, a title and a subtitle,
+ * used when no snapshot file is given.
+ */
+static yoga::LayoutSnapshot recordSampleList() {
+  auto config = YGConfigNew();
+  auto list = YGNodeNewWithConfig(config);
+  for (size_t i = 0; i < 500; i++) {
+    auto row = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+    YGNodeStyleSetPadding(row, YGEdgeAll, 12);
+    auto avatar = YGNodeNewWithConfig(config);
+    YGNodeStyleSetWidth(avatar, 40);
+    YGNodeStyleSetHeight(avatar, 40);
+    YGNodeInsertChild(row, avatar, 0);
+    auto content = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexShrink(content, 1);
+    for (size_t j = 0; j < 2; j++) {
+      auto text = YGNodeNewWithConfig(config);
+      YGNodeSetMeasureFunc(text, measureText);
+      YGNodeInsertChild(content, text, j);
+    }
+    YGNodeInsertChild(row, content, 1);
+    YGNodeInsertChild(list, row, i);
+  }
+
+  auto snapshot = yoga::recordLayout(
+      yoga::resolveRef(list), 390, YGUndefined, yoga::Direction::LTR);
+  YGNodeFreeRecursive(list);
+  YGConfigFree(config);
+  return snapshot;
+}
+
+/*
+ * Replays a recorded layout pass from scratch, and fails if it doesn't
+ * produce the recorded layout, so that a snapshot of a slow screen can act as
+ * a regression test too.
+ */
+static void yogaLayoutReplay(
+    benchmark::State& state,
+    const yoga::LayoutSnapshot& snapshot) {
+  yoga::LayoutReplay replay{snapshot};
+  for (auto _ : state) {
+    replay.run();
+  }
+
+  const auto mismatches = replay.mismatchedNodes();
+  state.counters["nodes"] = static_cast<double>(snapshot.nodes.size());
+  state.counters["mismatchedNodes"] = static_cast<double>(mismatches.size());
+  state.counters["unrecordedCalls"] =
+      static_cast<double>(replay.getUnrecordedCallCount());
+  if (!mismatches.empty()) {
+    state.SkipWithError("Replayed layout differs from the recorded one");
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(snapshot.nodes.size()));
+}
+
+} // namespace facebook::react
+
+/*
+ * Usage: YogaLayoutReplayBenchmark [benchmark flags] [snapshot files...]
+ * where the files were written from `yoga::serializeLayoutSnapshot`, e.g. by
+ * recording an app with `YogaLayoutRecorder::writeToDirectory`.
+ */
+int main(int argc, char** argv) {
+  using namespace facebook;
+
+  benchmark::Initialize(&argc, argv);
+
+  std::vector<std::pair<std::string, yoga::LayoutSnapshot>> snapshots;
+  for (int i = 1; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    std::stringstream data;
+    data << file.rdbuf();
+    auto snapshot = yoga::deserializeLayoutSnapshot(data.str());
+    if (!snapshot.has_value()) {
+      std::cerr << "Could not read a layout snapshot from " << argv[i] << "\n";
+      return 1;
+    }
+    snapshots.emplace_back(argv[i], std::move(*snapshot));
+  }
+  if (snapshots.empty()) {
+    snapshots.emplace_back("sampleList", react::recordSampleList());
+  }
+
+  for (const auto& [name, snapshot] : snapshots) {
+    benchmark::RegisterBenchmark(
+        ("yogaLayoutReplay/" + name).c_str(),
+        react::yogaLayoutReplay,
+        snapshot);
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <yoga/node/Node.h>
+
+#include <algorithm>
+#include <fstream>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace facebook::react {
+
+/*
+ * Resident set size of the process in bytes, or 0 where it can't be read.
+ */
+static size_t residentSetSize() {
+#if defined(__linux__)
+  auto statm = std::ifstream("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  statm >> size >> resident;
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+/*
+ * Measures a leaf the way a paragraph of a few words would: it wraps to as
+ * many lines as the available width requires.
+ */
+static YGSize measureText(
+    YGNodeConstRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  constexpr float textWidth = 180;
+  constexpr float lineHeight = 18;
+  if (widthMode == YGMeasureModeUndefined || width >= textWidth) {
+    return {textWidth, lineHeight};
+  }
+  auto lines = static_cast<int>(textWidth / std::max(width, 1.0f)) + 1;
+  return {width, lineHeight * static_cast<float>(lines)};
+}
+
+/*
+ * A scrollable list of rows, each made of an avatar and a column with a title
+ * and a subtitle, i.e. five nodes per row.
+ */
+static YGNodeRef createList(YGConfigRef config, int rowCount) {
+  auto list = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(list, 390);
+  for (int i = 0; i < rowCount; i++) {
+    auto row = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+    YGNodeStyleSetAlignItems(row, YGAlignCenter);
+    YGNodeStyleSetPadding(row, YGEdgeAll, 12);
+
+    auto avatar = YGNodeNewWithConfig(config);
+    YGNodeStyleSetWidth(avatar, 40);
+    YGNodeStyleSetHeight(avatar, 40);
+    YGNodeStyleSetMargin(avatar, YGEdgeEnd, 8);
+    YGNodeInsertChild(row, avatar, 0);
+
+    auto content = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexShrink(content, 1);
+    YGNodeStyleSetFlexGrow(content, 1);
+    for (size_t j = 0; j < 2; j++) {
+      auto text = YGNodeNewWithConfig(config);
+      YGNodeSetMeasureFunc(text, measureText);
+      YGNodeInsertChild(content, text, j);
+    }
+    YGNodeInsertChild(row, content, 1);
+
+    YGNodeInsertChild(list, row, static_cast<size_t>(i));
+  }
+  return list;
+}
+
+/*
+ * Sums the frames of every node of a laid out tree, so that layouts computed
+ * by different builds can be compared.
+ */
+static double layoutChecksum(YGNodeRef node) {
+  auto checksum = YGNodeLayoutGetLeft(node) + 3 * YGNodeLayoutGetTop(node) +
+      5 * YGNodeLayoutGetWidth(node) + 7 * YGNodeLayoutGetHeight(node);
+  for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    checksum += layoutChecksum(YGNodeGetChild(node, i));
+  }
+  return static_cast<double>(checksum);
+}
+
+/*
+ * Builds and lays out a list, and reports how much memory each node takes.
+ * `layoutChecksum` must be the same whether or not Yoga is built with
+ * YOGA_COMPACT_NODES.
+ */
+static void yogaNodeMemory(benchmark::State& state) {
+  auto config = YGConfigNew();
+  auto rowCount = static_cast<int>(state.range(0));
+  auto nodeCount = static_cast<double>(rowCount * 5 + 1);
+
+  auto residentSizeDelta = 0.0;
+  auto checksum = 0.0;
+  for (auto _ : state) {
+    auto residentSizeBefore = residentSetSize();
+    auto list = createList(config, rowCount);
+    YGNodeCalculateLayout(list, YGUndefined, YGUndefined, YGDirectionLTR);
+    residentSizeDelta = static_cast<double>(residentSetSize()) -
+        static_cast<double>(residentSizeBefore);
+    checksum = layoutChecksum(list);
+
+    state.PauseTiming();
+    YGNodeFreeRecursive(list);
+    state.ResumeTiming();
+  }
+
+  YGConfigFree(config);
+  state.counters["nodeSize"] = sizeof(yoga::Node);
+  state.counters["rssBytesPerNode"] = residentSizeDelta / nodeCount;
+  state.counters["layoutChecksum"] = checksum;
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(nodeCount));
+}
+BENCHMARK(yogaNodeMemory)->Arg(4000)->Iterations(1);
+
+/*
+ * Lays out an existing list again at a new width, which has to visit every
+ * node and consult its measurement caches.
+ */
+static void yogaRelayout(benchmark::State& state) {
+  auto config = YGConfigNew();
+  auto list = createList(config, static_cast<int>(state.range(0)));
+
+  float width = 390;
+  for (auto _ : state) {
+    width = width == 390 ? 414 : 390;
+    YGNodeStyleSetWidth(list, width);
+    YGNodeCalculateLayout(list, YGUndefined, YGUndefined, YGDirectionLTR);
+  }
+
+  YGNodeFreeRecursive(list);
+  YGConfigFree(config);
+  state.SetItemsProcessed(state.iterations() * (state.range(0) * 5 + 1));
+}
+BENCHMARK(yogaRelayout)->Arg(4000);
+
+/*
+ * Creates, lays out and frees a whole list, as for a tree which is only laid
+ * out once. Nodes are either allocated and freed one by one, or allocated
+ * from the arena of the config and freed all at once.
+ */
+static void yogaTreeLifecycle(benchmark::State& state) {
+  auto config = YGConfigNew();
+  auto useNodeArena = state.range(0) != 0;
+  auto rowCount = static_cast<int>(state.range(1));
+  YGConfigSetUseNodeArena(config, useNodeArena);
+
+  for (auto _ : state) {
+    auto list = createList(config, rowCount);
+    YGNodeCalculateLayout(list, YGUndefined, YGUndefined, YGDirectionLTR);
+    benchmark::DoNotOptimize(YGNodeLayoutGetHeight(list));
+    if (useNodeArena) {
+      YGConfigResetNodeArena(config);
+    } else {
+      YGNodeFreeRecursive(list);
+    }
+  }
+
+  YGConfigFree(config);
+  state.SetItemsProcessed(state.iterations() * (rowCount * 5 + 1));
+}
+BENCHMARK(yogaTreeLifecycle)
+    ->ArgNames({"arena", "rows"})
+    ->Args({0, 20000})
+    ->Args({1, 20000});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
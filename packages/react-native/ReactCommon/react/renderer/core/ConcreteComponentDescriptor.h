@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/ComponentDescriptor.h>
@@ -20,6 +21,7 @@
 #include <react/renderer/core/State.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/utils/CoreFeatures.h>
+#include <react/utils/PoolAllocator.h>
 
 namespace facebook::react {
 
@@ -66,8 +68,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   std::shared_ptr<ShadowNode> createShadowNode(
       const ShadowNodeFragment& fragment,
       const ShadowNodeFamily::Shared& family) const override {
-    auto shadowNode =
-        std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+    auto shadowNode = makeShadowNode(fragment, family, getTraits());
 
     adopt(*shadowNode);
 
@@ -77,7 +78,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   ShadowNode::Unshared cloneShadowNode(
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment) const override {
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode = makeShadowNode(sourceShadowNode, fragment);
 
     adopt(*shadowNode);
     return shadowNode;
@@ -162,11 +163,33 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     auto eventEmitter = std::make_shared<const ConcreteEventEmitter>(
         std::make_shared<EventTarget>(fragment.instanceHandle),
         eventDispatcher_);
+    if (CoreFeatures::enablePooledShadowNodes) {
+      return std::allocate_shared<ShadowNodeFamily>(
+          PoolAllocator<ShadowNodeFamily>{},
+          fragment,
+          std::move(eventEmitter),
+          eventDispatcher_,
+          *this);
+    }
     return std::make_shared<ShadowNodeFamily>(
         fragment, std::move(eventEmitter), eventDispatcher_, *this);
   }
 
  protected:
+  /*
+   * Allocates a node of the concrete type, from a pool dedicated to nodes of
+   * its size if pooling is enabled. Nodes are cloned on every commit, so this
+   * is one of the hottest allocations of the renderer.
+   */
+  template <typename... ArgsT>
+  static std::shared_ptr<ShadowNodeT> makeShadowNode(ArgsT&&... args) {
+    if (CoreFeatures::enablePooledShadowNodes) {
+      return std::allocate_shared<ShadowNodeT>(
+          PoolAllocator<ShadowNodeT>{}, std::forward<ArgsT>(args)...);
+    }
+    return std::make_shared<ShadowNodeT>(std::forward<ArgsT>(args)...);
+  }
+
   virtual void adopt(ShadowNode& shadowNode) const override {
     // Default implementation does nothing.
     react_native_assert(
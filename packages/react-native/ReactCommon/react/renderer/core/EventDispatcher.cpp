@@ -37,7 +37,7 @@ void EventDispatcher::dispatchEvent(RawEvent&& rawEvent) const {
 
   auto eventLogger = eventLogger_.lock();
   if (eventLogger != nullptr) {
-    rawEvent.loggingTag = eventLogger->onEventStart(rawEvent.type);
+    rawEvent.loggingTag = eventLogger->onEventStart(rawEvent.type.getName());
   }
   eventQueue_.enqueueEvent(std::move(rawEvent));
 }
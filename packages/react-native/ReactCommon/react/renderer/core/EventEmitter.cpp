@@ -7,6 +7,8 @@
 
 #include "EventEmitter.h"
 
+#include <array>
+
 #include <folly/dynamic.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
@@ -16,31 +18,16 @@
 
 namespace facebook::react {
 
-static bool hasPrefix(const std::string& str, const std::string& prefix) {
-  return str.compare(0, prefix.length(), prefix) == 0;
-}
+std::mutex& EventEmitter::DispatchMutex(const EventTarget* eventTarget) {
+  // Padded to a cache line so neighbouring stripes don't share one.
+  struct alignas(64) Stripe {
+    std::mutex mutex;
+  };
+  static auto stripes = std::array<Stripe, 64>{};
 
-// TODO(T29874519): Get rid of "top" prefix once and for all.
-/*
- * Replaces "on" with "top" if present. Or capitalizes the first letter and adds
- * "top" prefix. E.g. "eventName" becomes "topEventName", "onEventName" also
- * becomes "topEventName".
- */
-static std::string normalizeEventType(std::string type) {
-  auto prefixedType = std::move(type);
-  if (facebook::react::hasPrefix(prefixedType, "top")) {
-    return prefixedType;
-  }
-  if (facebook::react::hasPrefix(prefixedType, "on")) {
-    return "top" + prefixedType.substr(2);
-  }
-  prefixedType[0] = static_cast<char>(toupper(prefixedType[0]));
-  return "top" + prefixedType;
-}
-
-std::mutex& EventEmitter::DispatchMutex() {
-  static std::mutex mutex;
-  return mutex;
+  // Event targets are heap-allocated, so the lowest bits carry no entropy.
+  auto address = reinterpret_cast<uintptr_t>(eventTarget);
+  return stripes[(address >> 4) % stripes.size()].mutex;
 }
 
 ValueFactory EventEmitter::defaultPayloadFactory() {
@@ -53,6 +40,7 @@ EventEmitter::EventEmitter(
     SharedEventTarget eventTarget,
     EventDispatcher::Weak eventDispatcher)
     : eventTarget_(std::move(eventTarget)),
+      dispatchMutex_(DispatchMutex(eventTarget_.get())),
       eventDispatcher_(std::move(eventDispatcher)) {}
 
 void EventEmitter::dispatchEvent(
@@ -97,7 +85,7 @@ void EventEmitter::dispatchEvent(
   }
 
   eventDispatcher->dispatchEvent(RawEvent(
-      normalizeEventType(std::move(type)),
+      EventType::fromEmitterName(type),
       std::move(payload),
       eventTarget_,
       category));
@@ -122,13 +110,15 @@ void EventEmitter::dispatchUniqueEvent(
   }
 
   eventDispatcher->dispatchUniqueEvent(RawEvent(
-      normalizeEventType(std::move(type)),
+      EventType::fromEmitterName(type),
       std::move(payload),
       eventTarget_,
       RawEvent::Category::Continuous));
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
+  std::scoped_lock lock(dispatchMutex_);
+
   enableCounter_ += enabled ? 1 : -1;
 
   bool shouldBeEnabled = enableCounter_ > 0;
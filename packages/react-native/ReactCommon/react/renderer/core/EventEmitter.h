@@ -33,7 +33,13 @@ class EventEmitter {
  public:
   using Shared = std::shared_ptr<const EventEmitter>;
 
-  static std::mutex& DispatchMutex();
+  /*
+   * Returns the mutex protecting the enabled state of the given event target
+   * (and of the event emitter it belongs to).
+   * Event targets are spread across a fixed set of mutexes, so mounting and
+   * dispatching events to unrelated views doesn't contend on a single lock.
+   */
+  static std::mutex& DispatchMutex(const EventTarget* eventTarget);
 
   static ValueFactory defaultPayloadFactory();
 
@@ -51,7 +57,7 @@ class EventEmitter {
    * a possibility to extract JSI value from it.
    * The enable state is additive; a number of `enable` calls should be equal to
    * a number of `disable` calls to release the event target.
-   * `DispatchMutex` must be acquired before calling.
+   * Acquires the `DispatchMutex` of the event target internally.
    */
   void setEnabled(bool enabled) const;
 
@@ -108,9 +114,15 @@ class EventEmitter {
 
   mutable SharedEventTarget eventTarget_;
 
+  /*
+   * The `DispatchMutex` of the event target the emitter was created with.
+   * Stays the same after the event target is released.
+   */
+  std::mutex& dispatchMutex_;
+
   EventDispatcher::Weak eventDispatcher_;
-  mutable int enableCounter_{0};
-  mutable bool isEnabled_{false};
+  mutable int enableCounter_{0}; // Protected by `dispatchMutex_`.
+  mutable bool isEnabled_{false}; // Protected by `dispatchMutex_`.
 };
 
 } // namespace facebook::react
@@ -18,22 +18,22 @@ EventQueueProcessor::EventQueueProcessor(
     EventPipe eventPipe,
     EventPipeConclusion eventPipeConclusion,
     StatePipe statePipe,
-    std::weak_ptr<EventLogger> eventLogger)
+    std::weak_ptr<EventLogger> eventLogger,
+    StateBatchPipe stateBatchPipe)
     : eventPipe_(std::move(eventPipe)),
       eventPipeConclusion_(std::move(eventPipeConclusion)),
       statePipe_(std::move(statePipe)),
-      eventLogger_(std::move(eventLogger)) {}
+      eventLogger_(std::move(eventLogger)),
+      stateBatchPipe_(std::move(stateBatchPipe)) {}
 
 void EventQueueProcessor::flushEvents(
     jsi::Runtime& runtime,
     std::vector<RawEvent>&& events) const {
-  {
-    std::scoped_lock lock(EventEmitter::DispatchMutex());
-
-    for (const auto& event : events) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
+  for (const auto& event : events) {
+    if (event.eventTarget) {
+      std::scoped_lock lock(
+          EventEmitter::DispatchMutex(event.eventTarget.get()));
+      event.eventTarget->retain(runtime);
     }
   }
 
@@ -68,7 +68,7 @@ void EventQueueProcessor::flushEvents(
     eventPipe_(
         runtime,
         event.eventTarget.get(),
-        event.type,
+        event.type.getName(),
         reactPriority,
         *event.eventPayload);
 
@@ -84,7 +84,7 @@ void EventQueueProcessor::flushEvents(
   // We only run the "Conclusion" once per event group when batched.
   eventPipeConclusion_(runtime);
 
-  // No need to lock `EventEmitter::DispatchMutex()` here.
+  // No need to lock `EventEmitter::DispatchMutex` here.
   // The mutex protects from a situation when the `instanceHandle` can be
   // deallocated during accessing, but that's impossible at this point because
   // we have a strong pointer to it.
@@ -97,6 +97,11 @@ void EventQueueProcessor::flushEvents(
 
 void EventQueueProcessor::flushStateUpdates(
     std::vector<StateUpdate>&& states) const {
+  if (stateBatchPipe_) {
+    stateBatchPipe_(std::move(states));
+    return;
+  }
+
   for (const auto& stateUpdate : states) {
     statePipe_(stateUpdate);
   }
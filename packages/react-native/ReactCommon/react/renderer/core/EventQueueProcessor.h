@@ -23,7 +23,8 @@ class EventQueueProcessor {
       EventPipe eventPipe,
       EventPipeConclusion eventPipeConclusion,
       StatePipe statePipe,
-      std::weak_ptr<EventLogger> eventLogger);
+      std::weak_ptr<EventLogger> eventLogger,
+      StateBatchPipe stateBatchPipe = nullptr);
 
   void flushEvents(jsi::Runtime& runtime, std::vector<RawEvent>&& events) const;
   void flushStateUpdates(std::vector<StateUpdate>&& states) const;
@@ -33,6 +34,7 @@ class EventQueueProcessor {
   const EventPipeConclusion eventPipeConclusion_;
   const StatePipe statePipe_;
   const std::weak_ptr<EventLogger> eventLogger_;
+  const StateBatchPipe stateBatchPipe_;
 
   mutable bool hasContinuousEventStarted_{false};
 };
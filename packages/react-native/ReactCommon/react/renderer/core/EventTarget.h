@@ -66,7 +66,8 @@ class EventTarget {
 
  private:
   const InstanceHandle::Shared instanceHandle_;
-  mutable bool enabled_{false}; // Protected by `EventEmitter::DispatchMutex()`.
+  // Protected by `EventEmitter::DispatchMutex(this)`.
+  mutable bool enabled_{false};
   mutable jsi::Value strongInstanceHandle_; // Protected by `jsi::Runtime &`.
   mutable size_t retainCount_{0}; // Protected by `jsi::Runtime &`.
 };
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventType.h"
+
+#include <cctype>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+static bool hasPrefix(const std::string& str, const std::string& prefix) {
+  return str.compare(0, prefix.length(), prefix) == 0;
+}
+
+// TODO(T29874519): Get rid of "top" prefix once and for all.
+/*
+ * Replaces "on" with "top" if present. Or capitalizes the first letter and adds
+ * "top" prefix. E.g. "eventName" becomes "topEventName", "onEventName" also
+ * becomes "topEventName".
+ */
+static std::string normalizeEventType(std::string type) {
+  auto prefixedType = std::move(type);
+  if (facebook::react::hasPrefix(prefixedType, "top")) {
+    return prefixedType;
+  }
+  if (facebook::react::hasPrefix(prefixedType, "on")) {
+    return "top" + prefixedType.substr(2);
+  }
+  prefixedType[0] = static_cast<char>(toupper(prefixedType[0]));
+  return "top" + prefixedType;
+}
+
+/*
+ * Process-wide storage of event type names.
+ * The set of event types is small and stabilizes quickly, so lookups take a
+ * shared lock and only a first sighting of a name takes an exclusive one.
+ */
+class EventTypeRegistry final {
+ public:
+  static EventTypeRegistry& shared() {
+    static auto registry = EventTypeRegistry{};
+    return registry;
+  }
+
+  EventType intern(const std::string& name) {
+    {
+      std::shared_lock lock(mutex_);
+      auto iterator = ids_.find(name);
+      if (iterator != ids_.end()) {
+        return EventType{iterator->second, iterator->first};
+      }
+    }
+
+    std::unique_lock lock(mutex_);
+    return internLocked(name);
+  }
+
+  EventType internEmitterName(const std::string& name) {
+    {
+      std::shared_lock lock(mutex_);
+      auto iterator = emitterNames_.find(name);
+      if (iterator != emitterNames_.end()) {
+        return iterator->second;
+      }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto iterator = emitterNames_.find(name);
+    if (iterator != emitterNames_.end()) {
+      return iterator->second;
+    }
+
+    auto type = internLocked(normalizeEventType(name));
+    emitterNames_.emplace(name, type);
+    return type;
+  }
+
+ private:
+  EventType internLocked(const std::string& name) {
+    // Keys of `std::unordered_map` never move, so `EventType` can point
+    // to them directly.
+    auto [iterator, inserted] =
+        ids_.emplace(name, static_cast<EventType::Id>(ids_.size()));
+    return EventType{iterator->second, iterator->first};
+  }
+
+  std::shared_mutex mutex_;
+  std::unordered_map<std::string, EventType::Id> ids_;
+  std::unordered_map<std::string, EventType> emitterNames_;
+};
+
+EventType::EventType(const std::string& name)
+    : EventType(EventTypeRegistry::shared().intern(name)) {}
+
+EventType::EventType(Id id, const std::string& name) : id_(id), name_(&name) {}
+
+EventType EventType::fromEmitterName(const std::string& name) {
+  return EventTypeRegistry::shared().internEmitterName(name);
+}
+
+EventType::Id EventType::getId() const {
+  return id_;
+}
+
+const std::string& EventType::getName() const {
+  return *name_;
+}
+
+bool EventType::operator==(const EventType& rhs) const {
+  return id_ == rhs.id_;
+}
+
+bool EventType::operator!=(const EventType& rhs) const {
+  return id_ != rhs.id_;
+}
+
+} // namespace facebook::react
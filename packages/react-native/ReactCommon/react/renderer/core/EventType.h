@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace facebook::react {
+
+/*
+ * Interned name of an event type (e.g. "topScroll").
+ * Every distinct name is stored only once per process and gets a stable
+ * integer identifier, so event types are cheap to copy and compare.
+ */
+class EventType final {
+ public:
+  using Id = uint32_t;
+
+  /*
+   * Returns the event type with the given name, taken verbatim.
+   */
+  explicit EventType(const std::string& name);
+
+  /*
+   * Returns the event type for a name as passed to `EventEmitter` methods,
+   * normalized to the "top"-prefixed form expected by JavaScript.
+   * E.g. "eventName" and "onEventName" both become "topEventName".
+   * The normalization of every distinct name is performed only once.
+   */
+  static EventType fromEmitterName(const std::string& name);
+
+  /*
+   * Returns the unique identifier of the event type.
+   */
+  Id getId() const;
+
+  /*
+   * Returns the name of the event type.
+   * The reference remains valid for the lifetime of the process.
+   */
+  const std::string& getName() const;
+
+  bool operator==(const EventType& rhs) const;
+  bool operator!=(const EventType& rhs) const;
+
+ private:
+  friend class EventTypeRegistry;
+
+  EventType(Id id, const std::string& name);
+
+  Id id_;
+  const std::string* name_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSIObjectShape.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+namespace {
+
+// Caches of all runtimes which have one, protected by `registryMutex`.
+// `registryGeneration` changes whenever a cache is added or removed, which
+// invalidates the caches remembered by `JSIObjectShapeCache::get`.
+std::mutex registryMutex;
+std::unordered_map<jsi::Runtime*, JSIObjectShapeCache*> registry;
+std::atomic<uint64_t> registryGeneration{0};
+
+} // namespace
+
+JSIObjectShape::JSIObjectShape(
+    std::initializer_list<const char*> propertyNames)
+    : propertyNames_(propertyNames.begin(), propertyNames.end()) {
+  static std::atomic<size_t> nextIndex{0};
+  index_ = nextIndex++;
+}
+
+size_t JSIObjectShape::size() const {
+  return propertyNames_.size();
+}
+
+jsi::Object JSIObjectShape::createObject(
+    jsi::Runtime& runtime,
+    const jsi::Value* values) const {
+  auto object = jsi::Object(runtime);
+  if (auto* cache = JSIObjectShapeCache::get(runtime)) {
+    const auto& propNameIDs = cache->getPropNameIDs(*this);
+    for (size_t i = 0; i < propNameIDs.size(); i++) {
+      object.setProperty(runtime, propNameIDs[i], values[i]);
+    }
+  } else {
+    for (size_t i = 0; i < propertyNames_.size(); i++) {
+      object.setProperty(runtime, propertyNames_[i].c_str(), values[i]);
+    }
+  }
+  return object;
+}
+
+jsi::Object JSIObjectShape::createObject(
+    jsi::Runtime& runtime,
+    std::initializer_list<jsi::Value> values) const {
+  react_native_assert(values.size() == propertyNames_.size());
+  return createObject(runtime, values.begin());
+}
+
+void JSIObjectShape::setProperty(
+    jsi::Runtime& runtime,
+    jsi::Object& object,
+    size_t index,
+    const jsi::Value& value) const {
+  react_native_assert(index < propertyNames_.size());
+  if (auto* cache = JSIObjectShapeCache::get(runtime)) {
+    object.setProperty(runtime, cache->getPropNameIDs(*this)[index], value);
+  } else {
+    object.setProperty(runtime, propertyNames_[index].c_str(), value);
+  }
+}
+
+JSIObjectShapeCache::JSIObjectShapeCache(jsi::Runtime& runtime)
+    : runtime_(runtime) {
+  std::scoped_lock lock(registryMutex);
+  auto inserted = registry.emplace(&runtime, this).second;
+  react_native_assert(inserted && "A runtime can only have one cache.");
+  (void)inserted;
+  registryGeneration++;
+}
+
+JSIObjectShapeCache::~JSIObjectShapeCache() {
+  std::scoped_lock lock(registryMutex);
+  registry.erase(&runtime_);
+  registryGeneration++;
+}
+
+JSIObjectShapeCache* JSIObjectShapeCache::get(jsi::Runtime& runtime) {
+  // Almost always, all shapes on a thread are used with the same runtime, so
+  // the last lookup is remembered until a cache is added or removed.
+  thread_local jsi::Runtime* lastRuntime = nullptr;
+  thread_local JSIObjectShapeCache* lastCache = nullptr;
+  thread_local uint64_t lastGeneration = 0;
+
+  auto generation = registryGeneration.load();
+  if (lastRuntime == &runtime && lastGeneration == generation) {
+    return lastCache;
+  }
+
+  std::scoped_lock lock(registryMutex);
+  auto iterator = registry.find(&runtime);
+  lastRuntime = &runtime;
+  lastCache = iterator != registry.end() ? iterator->second : nullptr;
+  lastGeneration = registryGeneration.load();
+  return lastCache;
+}
+
+const std::vector<jsi::PropNameID>& JSIObjectShapeCache::getPropNameIDs(
+    const JSIObjectShape& shape) {
+  if (shapes_.size() <= shape.index_) {
+    shapes_.resize(shape.index_ + 1);
+  }
+
+  // Each list is allocated separately, so references to it stay valid when
+  // lists of other shapes are added.
+  auto& propNameIDs = shapes_[shape.index_];
+  if (propNameIDs == nullptr) {
+    auto newPropNameIDs = std::vector<jsi::PropNameID>{};
+    newPropNameIDs.reserve(shape.propertyNames_.size());
+    for (const auto& name : shape.propertyNames_) {
+      newPropNameIDs.push_back(jsi::PropNameID::forAscii(runtime_, name));
+    }
+    propNameIDs = std::make_unique<const std::vector<jsi::PropNameID>>(
+        std::move(newPropNameIDs));
+  }
+  return *propNameIDs;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <jsi/jsi.h>
+
+namespace facebook::react {
+
+/*
+ * Describes a fixed list of property names of objects which are created
+ * repeatedly on the native side and passed to JavaScript, such as event
+ * payloads or layout results.
+ * `jsi::PropNameID`s for the names are created only once per runtime when
+ * the runtime has a `JSIObjectShapeCache`, and on every call otherwise.
+ *
+ * Shapes are meant to be defined as `static` variables and are never
+ * destroyed; property names must be ASCII and unique within a shape.
+ */
+class JSIObjectShape final {
+ public:
+  JSIObjectShape(std::initializer_list<const char*> propertyNames);
+
+  JSIObjectShape(const JSIObjectShape& other) = delete;
+  JSIObjectShape& operator=(const JSIObjectShape& other) = delete;
+
+  /*
+   * Returns the number of properties of the shape.
+   */
+  size_t size() const;
+
+  /*
+   * Creates an object with the properties of the shape set to `values`,
+   * which must contain exactly `size()` values, in the same order.
+   * Must be called on the JavaScript thread.
+   */
+  jsi::Object createObject(jsi::Runtime& runtime, const jsi::Value* values)
+      const;
+  jsi::Object createObject(
+      jsi::Runtime& runtime,
+      std::initializer_list<jsi::Value> values) const;
+
+  /*
+   * Sets the property at `index` on `object`, e.g. on an object which was not
+   * created from the shape.
+   * Must be called on the JavaScript thread.
+   */
+  void setProperty(
+      jsi::Runtime& runtime,
+      jsi::Object& object,
+      size_t index,
+      const jsi::Value& value) const;
+
+ private:
+  friend class JSIObjectShapeCache;
+
+  std::vector<std::string> propertyNames_;
+  size_t index_;
+};
+
+/*
+ * Holds the `jsi::PropNameID`s of all shapes used with a runtime, entirely on
+ * the native side.
+ * The owner of the runtime creates it on the JavaScript thread and must
+ * destroy it before the runtime is destroyed, or from a `jsi::HostObject` the
+ * runtime destroys (e.g. the binding installed into the runtime), where
+ * releasing `jsi::PropNameID`s is still safe.
+ * At most one cache may exist per runtime.
+ */
+class JSIObjectShapeCache final {
+ public:
+  explicit JSIObjectShapeCache(jsi::Runtime& runtime);
+  ~JSIObjectShapeCache();
+
+  JSIObjectShapeCache(const JSIObjectShapeCache& other) = delete;
+  JSIObjectShapeCache& operator=(const JSIObjectShapeCache& other) = delete;
+
+  /*
+   * Returns the cache of `runtime`, or `nullptr` if it has none.
+   */
+  static JSIObjectShapeCache* get(jsi::Runtime& runtime);
+
+  /*
+   * Returns the property names of `shape`, creating them on first use.
+   * The returned list is never moved or modified while the cache exists.
+   */
+  const std::vector<jsi::PropNameID>& getPropNameIDs(
+      const JSIObjectShape& shape);
+
+ private:
+  jsi::Runtime& runtime_;
+  std::vector<std::unique_ptr<const std::vector<jsi::PropNameID>>> shapes_;
+};
+
+} // namespace facebook::react
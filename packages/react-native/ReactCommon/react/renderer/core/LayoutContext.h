@@ -35,6 +35,16 @@ struct LayoutContext {
    */
   std::vector<const LayoutableShadowNode*>* affectedNodes{};
 
+  /*
+   * A raw pointer to the number of subtrees that the re-layout pass didn't
+   * have to read back because nothing in them has a new layout. Each skipped
+   * subtree counts once, whatever its size, as counting its nodes would mean
+   * walking it. If the field is not `nullptr`, a particular
+   * `LayoutableShadowNode` implementation should add the subtrees it skips to
+   * it.
+   */
+  int* skippedSubtreesCount{};
+
   /*
    * Flag indicating whether in reassignment of direction
    * aware properties should take place. If yes, following
@@ -65,12 +75,14 @@ inline bool operator==(const LayoutContext& lhs, const LayoutContext& rhs) {
   return std::tie(
              lhs.pointScaleFactor,
              lhs.affectedNodes,
+             lhs.skippedSubtreesCount,
              lhs.swapLeftAndRightInRTL,
              lhs.fontSizeMultiplier,
              lhs.viewportOffset) ==
       std::tie(
              rhs.pointScaleFactor,
              rhs.affectedNodes,
+             rhs.skippedSubtreesCount,
              rhs.swapLeftAndRightInRTL,
              rhs.fontSizeMultiplier,
              rhs.viewportOffset);
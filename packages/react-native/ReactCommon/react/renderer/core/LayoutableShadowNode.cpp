@@ -291,6 +291,7 @@ Size LayoutableShadowNode::measure(
 
   auto localLayoutContext = layoutContext;
   localLayoutContext.affectedNodes = nullptr;
+  localLayoutContext.skippedSubtreesCount = nullptr;
 
   layoutableShadowNode.layoutTree(localLayoutContext, layoutConstraints);
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <glog/logging.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawValue.h>
+#include <react/renderer/core/propsConversions.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+/*
+ * `LazyProp<T>` is a prop field that keeps its value in raw form until it is
+ * read for the first time. The conversion happens once, is memoized, and is
+ * safe to trigger concurrently from any thread.
+ *
+ * Values are stored behind a shared immutable block, so carrying a value over
+ * from `sourceProps` (the common case during cloning) is a reference count
+ * bump instead of a deep copy.
+ *
+ * Only use this for props that are rarely read on the commit path and whose
+ * `fromRawValue` conversion does not depend on the `ContextContainer`: the
+ * conversion may happen long after the `PropsParserContext` is gone, only
+ * `surfaceId` is preserved.
+ */
+template <typename T>
+class LazyProp final {
+ public:
+  LazyProp() = default;
+
+  LazyProp(T value)
+      : storage_(std::make_shared<const Storage>(std::move(value))) {}
+
+  LazyProp& operator=(T value) {
+    storage_ = std::make_shared<const Storage>(std::move(value));
+    return *this;
+  }
+
+  /*
+   * Creates a pending value from a given `RawValue`. The value will be
+   * converted on the first call to `get()`.
+   */
+  static LazyProp pending(
+      const PropsParserContext& context,
+      const RawValue& rawValue) {
+    auto result = LazyProp{};
+    result.storage_ =
+        std::make_shared<const Storage>(RawValue{rawValue}, context.surfaceId);
+    return result;
+  }
+
+  /*
+   * Returns the converted value, converting it first if needed.
+   */
+  const T& get() const {
+    if (!storage_) {
+      return defaultValue();
+    }
+    return storage_->resolve();
+  }
+
+  operator const T&() const {
+    return get();
+  }
+
+  const T* operator->() const {
+    return &get();
+  }
+
+  /*
+   * Returns `true` if the value was not converted yet.
+   * Intended for testing and instrumentation only.
+   */
+  bool isPending() const {
+    return storage_ && storage_->isPending();
+  }
+
+  bool operator==(const LazyProp& rhs) const {
+    return storage_ == rhs.storage_ || get() == rhs.get();
+  }
+
+  bool operator!=(const LazyProp& rhs) const {
+    return !(*this == rhs);
+  }
+
+ private:
+  class Storage final {
+   public:
+    explicit Storage(T value) : value_(std::move(value)), pending_(false) {}
+
+    Storage(RawValue&& rawValue, SurfaceId surfaceId)
+        : rawValue_(std::move(rawValue)), pending_(true), surfaceId_(surfaceId) {}
+
+    const T& resolve() const {
+      if (pending_.load(std::memory_order_acquire)) {
+        std::call_once(onceFlag_, [this]() { convert(); });
+      }
+      return value_;
+    }
+
+    bool isPending() const {
+      return pending_.load(std::memory_order_acquire);
+    }
+
+   private:
+    void convert() const {
+      static const auto contextContainer = ContextContainer{};
+      auto context = PropsParserContext{surfaceId_, contextContainer};
+      try {
+        fromRawValue(context, rawValue_, value_, T{});
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Error while converting lazy prop: " << e.what();
+        value_ = T{};
+      }
+      rawValue_ = RawValue{};
+      pending_.store(false, std::memory_order_release);
+    }
+
+    mutable T value_{};
+    mutable RawValue rawValue_{};
+    mutable std::atomic<bool> pending_;
+    mutable std::once_flag onceFlag_{};
+    SurfaceId surfaceId_{};
+  };
+
+  static const T& defaultValue() {
+    static const auto value = T{};
+    return value;
+  }
+
+  std::shared_ptr<const Storage> storage_{};
+};
+
+/*
+ * Stores `rawValue` inside `result` without converting it. Used by both
+ * `convertRawProp` and `setProp`-based parsing for `LazyProp` fields.
+ */
+template <typename T>
+void fromRawValue(
+    const PropsParserContext& context,
+    const RawValue& rawValue,
+    LazyProp<T>& result) {
+  result = LazyProp<T>::pending(context, rawValue);
+}
+
+} // namespace facebook::react
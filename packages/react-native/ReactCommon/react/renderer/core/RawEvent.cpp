@@ -10,13 +10,24 @@
 namespace facebook::react {
 
 RawEvent::RawEvent(
-    std::string type,
+    EventType type,
     SharedEventPayload eventPayload,
     SharedEventTarget eventTarget,
     Category category)
-    : type(std::move(type)),
+    : type(type),
       eventPayload(std::move(eventPayload)),
       eventTarget(std::move(eventTarget)),
       category(category) {}
 
+RawEvent::RawEvent(
+    const std::string& type,
+    SharedEventPayload eventPayload,
+    SharedEventTarget eventTarget,
+    Category category)
+    : RawEvent(
+          EventType{type},
+          std::move(eventPayload),
+          std::move(eventTarget),
+          category) {}
+
 } // namespace facebook::react
@@ -13,6 +13,7 @@
 #include <react/renderer/core/EventLogger.h>
 #include <react/renderer/core/EventPayload.h>
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/EventType.h>
 
 namespace facebook::react {
 
@@ -59,12 +60,18 @@ struct RawEvent {
   };
 
   RawEvent(
-      std::string type,
+      EventType type,
       SharedEventPayload eventPayload,
       SharedEventTarget eventTarget,
       Category category = Category::Unspecified);
 
-  std::string type;
+  RawEvent(
+      const std::string& type,
+      SharedEventPayload eventPayload,
+      SharedEventTarget eventTarget,
+      Category category = Category::Unspecified);
+
+  EventType type;
   SharedEventPayload eventPayload;
   SharedEventTarget eventTarget;
   Category category;
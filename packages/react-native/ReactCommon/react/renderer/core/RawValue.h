@@ -21,6 +21,9 @@ namespace facebook::react {
 
 class RawPropsParser;
 
+template <typename T>
+class LazyProp;
+
 /*
  * `RawValue` abstracts some arbitrary complex data structure similar to JSON.
  * `RawValue` supports explicit conversion to: `bool`, `int`, `int64_t`,
@@ -69,6 +72,8 @@ class RawValue {
   friend class RawProps;
   friend class RawPropsParser;
   friend class UIManagerBinding;
+  template <typename T>
+  friend class LazyProp;
 
   /*
    * Arbitrary constructors are private only for RawProps and internal usage.
@@ -371,6 +371,87 @@ ShadowNode::Unshared ShadowNode::cloneTree(
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+namespace {
+
+/*
+ * Clones `shadowNode` and the descendants leading to updated nodes.
+ */
+ShadowNode::Unshared cloneMultipleRecursive(
+    const ShadowNode& shadowNode,
+    const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+    const std::unordered_set<const ShadowNodeFamily*>& ancestorFamilies,
+    const std::function<ShadowNode::Unshared(
+        const ShadowNode& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) {
+  const auto* family = &shadowNode.getFamily();
+
+  auto newChildren = ShadowNode::SharedListOfShared{};
+  if (ancestorFamilies.contains(family)) {
+    auto children = shadowNode.getChildren();
+    for (auto& childNode : children) {
+      const auto* childFamily = &childNode->getFamily();
+      if (familiesToUpdate.contains(childFamily) ||
+          ancestorFamilies.contains(childFamily)) {
+        childNode = cloneMultipleRecursive(
+            *childNode, familiesToUpdate, ancestorFamilies, callback);
+      }
+    }
+    newChildren =
+        std::make_shared<ShadowNode::ListOfShared>(std::move(children));
+  }
+
+  const auto& children =
+      newChildren ? newChildren : ShadowNodeFragment::childrenPlaceholder();
+  auto fragment = ShadowNodeFragment{
+      /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+      /* .children = */ children,
+  };
+
+  if (familiesToUpdate.contains(family)) {
+    auto newShadowNode = callback(shadowNode, fragment);
+    react_native_assert(
+        newShadowNode &&
+        "`callback` returned `nullptr` which is not allowed value.");
+    return newShadowNode;
+  }
+
+  return shadowNode.clone(fragment);
+}
+
+} // namespace
+
+ShadowNode::Unshared ShadowNode::cloneMultiple(
+    const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+    const std::function<Unshared(
+        const ShadowNode& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) const {
+  auto ancestorFamilies = std::unordered_set<const ShadowNodeFamily*>{};
+  auto hasNodesToUpdate = familiesToUpdate.contains(&getFamily());
+
+  for (const auto* family : familiesToUpdate) {
+    auto ancestors = family->getAncestors(*this);
+    if (ancestors.empty()) {
+      continue;
+    }
+
+    hasNodesToUpdate = true;
+    for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+      // Paths from the root share their beginning; once an ancestor is
+      // known, so are all of its ancestors.
+      if (!ancestorFamilies.insert(&it->first.get().getFamily()).second) {
+        break;
+      }
+    }
+  }
+
+  if (!hasNodesToUpdate) {
+    return nullptr;
+  }
+
+  return cloneMultipleRecursive(
+      *this, familiesToUpdate, ancestorFamilies, callback);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
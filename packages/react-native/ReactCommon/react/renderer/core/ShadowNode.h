@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include <react/renderer/core/EventEmitter.h>
@@ -104,6 +105,23 @@ class ShadowNode : public Sealable,
       const std::function<Unshared(const ShadowNode& oldShadowNode)>& callback,
       ShadowNodeTraits traits = {}) const;
 
+  /*
+   * Clones the node (and the part of the tree containing all given nodes) by
+   * replacing every node which belongs to one of `familiesToUpdate` with the
+   * node that `callback` returns. Every ancestor shared by several of these
+   * nodes is cloned once. `callback` receives a fragment holding the new
+   * children of the node (if any of its descendants were replaced) which the
+   * returned node must use.
+   * Families without a node in the tree are ignored.
+   *
+   * Returns `nullptr` if none of the families has a node in the tree.
+   */
+  Unshared cloneMultiple(
+      const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+      const std::function<Unshared(
+          const ShadowNode& oldShadowNode,
+          const ShadowNodeFragment& fragment)>& callback) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -173,7 +191,6 @@ class ShadowNode : public Sealable,
   /*
    * Performs all side effects associated with mounting/unmounting in one place.
    * This is not `virtual` on purpose, do not override this.
-   * `EventEmitter::DispatchMutex()` must be acquired before calling.
    */
   void setMounted(bool mounted) const;
 
@@ -144,4 +144,28 @@ TEST_F(EventQueueProcessorTest, alwaysDiscreteEvent) {
   EXPECT_EQ(eventPriorities_[0], ReactEventPriority::Discrete);
 }
 
+TEST_F(EventQueueProcessorTest, stateUpdatesAreFlushedAsBatch) {
+  auto statePipeCallCount = 0;
+  auto batches = std::vector<std::vector<StateUpdate>>{};
+  auto eventProcessor = EventQueueProcessor(
+      [](jsi::Runtime& /*runtime*/,
+         const EventTarget* /*eventTarget*/,
+         const std::string& /*type*/,
+         ReactEventPriority /*priority*/,
+         const EventPayload& /*payload*/) {},
+      [](jsi::Runtime& /*runtime*/) {},
+      [&](const StateUpdate& /*stateUpdate*/) { statePipeCallCount++; },
+      std::make_shared<MockEventLogger>(),
+      [&](std::vector<StateUpdate>&& stateUpdates) {
+        batches.push_back(std::move(stateUpdates));
+      });
+
+  eventProcessor.flushStateUpdates(
+      {StateUpdate{}, StateUpdate{}, StateUpdate{}});
+
+  EXPECT_EQ(statePipeCallCount, 0);
+  EXPECT_EQ(batches.size(), 1);
+  EXPECT_EQ(batches[0].size(), 3);
+}
+
 } // namespace facebook::react
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/EventType.h>
+
+using namespace facebook::react;
+
+TEST(EventTypeTest, sameNameHasSameId) {
+  auto scroll = EventType{"topScroll"};
+  auto anotherScroll = EventType{std::string{"top"} + "Scroll"};
+  auto layout = EventType{"topLayout"};
+
+  EXPECT_EQ(scroll, anotherScroll);
+  EXPECT_EQ(scroll.getId(), anotherScroll.getId());
+  EXPECT_EQ(&scroll.getName(), &anotherScroll.getName());
+  EXPECT_NE(scroll, layout);
+  EXPECT_NE(scroll.getId(), layout.getId());
+}
+
+TEST(EventTypeTest, nameIsTakenVerbatim) {
+  EXPECT_EQ(EventType{"my type"}.getName(), "my type");
+  EXPECT_EQ(EventType{"onScroll"}.getName(), "onScroll");
+  EXPECT_NE(EventType{"onScroll"}, EventType{"topScroll"});
+}
+
+TEST(EventTypeTest, emitterNamesAreNormalized) {
+  auto topScroll = EventType{"topScroll"};
+
+  EXPECT_EQ(EventType::fromEmitterName("topScroll"), topScroll);
+  EXPECT_EQ(EventType::fromEmitterName("onScroll"), topScroll);
+  EXPECT_EQ(EventType::fromEmitterName("scroll"), topScroll);
+  EXPECT_EQ(EventType::fromEmitterName("scroll").getName(), "topScroll");
+  EXPECT_EQ(
+      EventType::fromEmitterName("pointerMove").getName(), "topPointerMove");
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/JSIObjectShape.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+static const auto pointShape = JSIObjectShape{"x", "y"};
+static const auto labelShape = JSIObjectShape{"text", "point"};
+
+static size_t countGlobalProperties(jsi::Runtime& runtime) {
+  return runtime.global()
+      .getPropertyAsObject(runtime, "Object")
+      .getPropertyAsFunction(runtime, "getOwnPropertyNames")
+      .call(runtime, runtime.global())
+      .asObject(runtime)
+      .asArray(runtime)
+      .size(runtime);
+}
+
+TEST(JSIObjectShapeTest, createsObjectsWithAllProperties) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto cache = JSIObjectShapeCache{*runtime};
+
+  auto point = pointShape.createObject(*runtime, {1.5, 2});
+  auto label = labelShape.createObject(
+      *runtime,
+      {jsi::String::createFromAscii(*runtime, "hello"), std::move(point)});
+
+  EXPECT_EQ(labelShape.size(), 2);
+  EXPECT_EQ(
+      label.getProperty(*runtime, "text").asString(*runtime).utf8(*runtime),
+      "hello");
+  auto labelPoint = label.getPropertyAsObject(*runtime, "point");
+  EXPECT_EQ(labelPoint.getProperty(*runtime, "x").asNumber(), 1.5);
+  EXPECT_EQ(labelPoint.getProperty(*runtime, "y").asNumber(), 2);
+  EXPECT_EQ(labelPoint.getPropertyNames(*runtime).size(*runtime), 2);
+}
+
+TEST(JSIObjectShapeTest, createsObjectsWithoutCache) {
+  auto runtime = hermes::makeHermesRuntime();
+  EXPECT_EQ(JSIObjectShapeCache::get(*runtime), nullptr);
+
+  auto point = pointShape.createObject(*runtime, {1.5, 2});
+  EXPECT_EQ(point.getProperty(*runtime, "x").asNumber(), 1.5);
+  EXPECT_EQ(point.getProperty(*runtime, "y").asNumber(), 2);
+
+  auto object = jsi::Object(*runtime);
+  labelShape.setProperty(*runtime, object, 0, jsi::Value(3));
+  EXPECT_EQ(object.getProperty(*runtime, "text").asNumber(), 3);
+}
+
+TEST(JSIObjectShapeTest, propNameIDsAreCachedPerRuntime) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto anotherRuntime = hermes::makeHermesRuntime();
+  auto cache = JSIObjectShapeCache{*runtime};
+  auto anotherCache = JSIObjectShapeCache{*anotherRuntime};
+
+  EXPECT_EQ(JSIObjectShapeCache::get(*runtime), &cache);
+  EXPECT_EQ(JSIObjectShapeCache::get(*anotherRuntime), &anotherCache);
+  EXPECT_EQ(JSIObjectShapeCache::get(*runtime), &cache);
+
+  const auto& propNameIDs = cache.getPropNameIDs(pointShape);
+  EXPECT_EQ(&cache.getPropNameIDs(pointShape), &propNameIDs);
+  ASSERT_EQ(propNameIDs.size(), 2);
+  EXPECT_EQ(propNameIDs[0].utf8(*runtime), "x");
+  EXPECT_EQ(propNameIDs[1].utf8(*runtime), "y");
+
+  const auto& otherPropNameIDs = anotherCache.getPropNameIDs(pointShape);
+  EXPECT_NE(&otherPropNameIDs, &propNameIDs);
+  EXPECT_EQ(otherPropNameIDs[0].utf8(*anotherRuntime), "x");
+
+  auto point = pointShape.createObject(*anotherRuntime, {3, 4});
+  EXPECT_EQ(point.getProperty(*anotherRuntime, "y").asNumber(), 4);
+}
+
+TEST(JSIObjectShapeTest, cacheIsRemovedWhenDestroyed) {
+  for (int i = 0; i < 3; i++) {
+    auto runtime = hermes::makeHermesRuntime();
+    {
+      auto cache = JSIObjectShapeCache{*runtime};
+      EXPECT_EQ(JSIObjectShapeCache::get(*runtime), &cache);
+      auto point = pointShape.createObject(*runtime, {i, i});
+      EXPECT_EQ(point.getProperty(*runtime, "x").asNumber(), i);
+    }
+    EXPECT_EQ(JSIObjectShapeCache::get(*runtime), nullptr);
+    auto point = pointShape.createObject(*runtime, {i, i});
+    EXPECT_EQ(point.getProperty(*runtime, "y").asNumber(), i);
+  }
+}
+
+TEST(JSIObjectShapeTest, cacheIsNotVisibleToJavaScript) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto globalPropertyCount = countGlobalProperties(*runtime);
+
+  auto cache = JSIObjectShapeCache{*runtime};
+  pointShape.createObject(*runtime, {1, 2});
+
+  EXPECT_EQ(countGlobalProperties(*runtime), globalPropertyCount);
+}
+
+TEST(JSIObjectShapeTest, propNameIDsStayValidWhenShapesAreAdded) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto cache = JSIObjectShapeCache{*runtime};
+
+  // Creating an object of a shape used for the first time with a runtime
+  // adds its property names to the cache of the runtime.
+  auto point = pointShape.createObject(*runtime, {1, 2});
+  const auto& propNameIDs = cache.getPropNameIDs(pointShape);
+  static auto laterShapes = std::vector<std::unique_ptr<JSIObjectShape>>{};
+  for (int i = 0; i < 64; i++) {
+    laterShapes.push_back(std::make_unique<JSIObjectShape>(
+        std::initializer_list<const char*>{"z"}));
+    laterShapes.back()->createObject(*runtime, {i});
+  }
+
+  EXPECT_EQ(&cache.getPropNameIDs(pointShape), &propNameIDs);
+  EXPECT_EQ(propNameIDs[0].utf8(*runtime), "x");
+  EXPECT_EQ(
+      pointShape.createObject(*runtime, {3, 4})
+          .getProperty(*runtime, "y")
+          .asNumber(),
+      4);
+}
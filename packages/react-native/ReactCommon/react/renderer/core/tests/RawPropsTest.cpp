@@ -11,6 +11,7 @@
 #include <hermes/hermes.h>
 #include <react/debug/flags.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
+#include <react/renderer/core/LazyProp.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/propsConversions.h>
@@ -149,6 +150,23 @@ class PropsMultiLookup : public Props {
   const float derivedFloatValue{40};
 };
 
+class PropsLazyString : public Props {
+ public:
+  PropsLazyString() = default;
+  PropsLazyString(
+      const PropsParserContext& context,
+      const PropsLazyString& sourceProps,
+      const RawProps& rawProps)
+      : stringValue(convertRawProp(
+            context,
+            rawProps,
+            "stringValue",
+            sourceProps.stringValue,
+            {})) {}
+
+  LazyProp<std::string> stringValue{};
+};
+
 TEST(RawPropsTest, handleProps) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -500,3 +518,33 @@ TEST(RawPropsTest, filterYogaRawProps) {
   EXPECT_EQ(dynamicPropsFromCopy["floatValue"], 10.0);
   EXPECT_EQ(dynamicPropsFromCopy["flex"], nullptr);
 }
+
+TEST(RawPropsTest, handleLazyProps) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto raw = RawProps(folly::dynamic::object("stringValue", "abc"));
+  auto parser = RawPropsParser();
+  parser.prepare<PropsLazyString>();
+  raw.parse(parser);
+
+  auto props = PropsLazyString(parserContext, PropsLazyString(), raw);
+
+  // The value is kept in raw form until it is read.
+  EXPECT_TRUE(props.stringValue.isPending());
+  EXPECT_STREQ(props.stringValue.get().c_str(), "abc");
+  EXPECT_FALSE(props.stringValue.isPending());
+
+  // Unchanged values are shared with the source props.
+  auto emptyRaw = RawProps(folly::dynamic::object());
+  emptyRaw.parse(parser);
+  auto clonedProps = PropsLazyString(parserContext, props, emptyRaw);
+  EXPECT_EQ(&clonedProps.stringValue.get(), &props.stringValue.get());
+
+  // `null` resets the value to its default.
+  auto nullRaw = RawProps(folly::dynamic::object("stringValue", nullptr));
+  nullRaw.parse(parser);
+  auto resetProps = PropsLazyString(parserContext, props, nullRaw);
+  EXPECT_FALSE(resetProps.stringValue.isPending());
+  EXPECT_STREQ(resetProps.stringValue.get().c_str(), "");
+}
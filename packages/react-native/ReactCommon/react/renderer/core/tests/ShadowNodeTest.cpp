@@ -317,3 +317,47 @@ TEST_F(ShadowNodeTest, testCloneTree) {
   EXPECT_TRUE(secondLevelchild.getTraits().check(
       ShadowNodeTraits::Trait::ClonedByNativeStateUpdate));
 }
+
+TEST_F(ShadowNodeTest, testCloneMultiple) {
+  auto familiesToUpdate = std::unordered_set<const ShadowNodeFamily*>{
+      &nodeABA_->getFamily(),
+      &nodeABB_->getFamily(),
+      &nodeAC_->getFamily(),
+      &nodeZ_->getFamily(),
+  };
+  auto callbackCount = 0;
+  auto rootNode = nodeA_->cloneMultiple(
+      familiesToUpdate,
+      [&](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        callbackCount++;
+        EXPECT_NE(&oldShadowNode, nodeZ_.get());
+        return oldShadowNode.clone(fragment);
+      });
+
+  EXPECT_EQ(callbackCount, 3);
+  EXPECT_NE(rootNode.get(), nodeA_.get());
+
+  const auto& children = rootNode->getChildren();
+  EXPECT_EQ(children.size(), 3);
+  EXPECT_EQ(children[0], nodeAA_);
+  EXPECT_NE(children[1], nodeAB_);
+  EXPECT_NE(children[2], nodeAC_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*children[2], *nodeAC_));
+
+  const auto& grandchildren = children[1]->getChildren();
+  EXPECT_EQ(grandchildren.size(), 2);
+  EXPECT_NE(grandchildren[0], nodeABA_);
+  EXPECT_NE(grandchildren[1], nodeABB_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*grandchildren[0], *nodeABA_));
+  EXPECT_TRUE(ShadowNode::sameFamily(*grandchildren[1], *nodeABB_));
+}
+
+TEST_F(ShadowNodeTest, testCloneMultipleWithoutNodesInTree) {
+  auto rootNode = nodeA_->cloneMultiple(
+      {&nodeZ_->getFamily()},
+      [](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        return oldShadowNode.clone(fragment);
+      });
+
+  EXPECT_EQ(rootNode, nullptr);
+}
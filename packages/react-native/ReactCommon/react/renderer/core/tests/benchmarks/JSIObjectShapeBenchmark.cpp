@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/JSIObjectShape.h>
+
+namespace facebook::react {
+
+/*
+ * Objects with the size of a layout result (e.g. `getRelativeLayoutMetrics`)
+ * and of a pointer event payload.
+ */
+static constexpr auto kSmallPropertyCount = 4;
+static constexpr auto kLargePropertyCount = 25;
+
+static const char* const kPropertyNames[kLargePropertyCount] = {
+    "left",      "top",      "width",       "height",  "pointerId",
+    "pressure",  "clientX",  "clientY",     "pageX",   "pageY",
+    "screenX",   "screenY",  "offsetX",     "offsetY", "tiltX",
+    "tiltY",     "detail",   "buttons",     "twist",   "ctrlKey",
+    "shiftKey",  "altKey",   "metaKey",     "button",  "isPrimary",
+};
+
+static const auto smallShape =
+    JSIObjectShape{"left", "top", "width", "height"};
+
+static const auto largeShape = JSIObjectShape{
+    "left",     "top",     "width",   "height",  "pointerId",
+    "pressure", "clientX", "clientY", "pageX",   "pageY",
+    "screenX",  "screenY", "offsetX", "offsetY", "tiltX",
+    "tiltY",    "detail",  "buttons", "twist",   "ctrlKey",
+    "shiftKey", "altKey",  "metaKey", "button",  "isPrimary",
+};
+
+/*
+ * The way payloads used to be built: one `setProperty` per property, with a
+ * `jsi::PropNameID` created from the name every time.
+ */
+static void setPropertiesOneByOne(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto propertyCount = static_cast<size_t>(state.range(0));
+
+  for (auto _ : state) {
+    auto object = jsi::Object(*runtime);
+    for (size_t i = 0; i < propertyCount; i++) {
+      object.setProperty(*runtime, kPropertyNames[i], static_cast<double>(i));
+    }
+    benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(setPropertiesOneByOne)
+    ->Arg(kSmallPropertyCount)
+    ->Arg(kLargePropertyCount);
+
+static void createObjectFromShape(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto propertyCount = static_cast<size_t>(state.range(0));
+  const auto& shape =
+      propertyCount == kSmallPropertyCount ? smallShape : largeShape;
+
+  for (auto _ : state) {
+    jsi::Value values[kLargePropertyCount];
+    for (size_t i = 0; i < propertyCount; i++) {
+      values[i] = jsi::Value(static_cast<double>(i));
+    }
+    auto object = shape.createObject(*runtime, values);
+    benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(createObjectFromShape)
+    ->Arg(kSmallPropertyCount)
+    ->Arg(kLargePropertyCount);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/utils/ContextContainer.h>
+#include <react/utils/CoreFeatures.h>
+#include <react/utils/PoolAllocator.h>
+
+#include <fstream>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace facebook::react {
+
+static auto contextContainer = std::make_shared<const ContextContainer>();
+static auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+static auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+/*
+ * Resident set size of the process in bytes, or 0 where it can't be read.
+ */
+static size_t residentSetSize() {
+#if defined(__linux__)
+  auto statm = std::ifstream("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  statm >> size >> resident;
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+static std::vector<ShadowNode::Shared> createNodes(int count) {
+  auto nodes = std::vector<ShadowNode::Shared>{};
+  nodes.reserve(count);
+  for (auto tag = Tag{1}; tag <= count; tag++) {
+    auto family = viewComponentDescriptor.createFamily(
+        ShadowNodeFamilyFragment{tag, SurfaceId{1}, nullptr});
+    nodes.push_back(viewComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{ViewShadowNode::defaultSharedProps()}, family));
+  }
+  return nodes;
+}
+
+/*
+ * Clones every node of a commit-sized set and drops the previous clones, as
+ * consecutive commits do.
+ */
+static void cloneShadowNodes(benchmark::State& state) {
+  CoreFeatures::enablePooledShadowNodes = state.range(0) != 0;
+  auto nodes = createNodes(static_cast<int>(state.range(1)));
+
+  auto clones = std::vector<ShadowNode::Shared>{};
+  clones.reserve(nodes.size());
+  for (auto _ : state) {
+    clones.clear();
+    for (const auto& node : nodes) {
+      clones.push_back(node->clone({}));
+    }
+    benchmark::DoNotOptimize(clones.data());
+  }
+
+  CoreFeatures::enablePooledShadowNodes = false;
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(cloneShadowNodes)
+    ->ArgNames({"pooled", "nodes"})
+    ->Args({0, 500})
+    ->Args({1, 500});
+
+/*
+ * Keeps many nodes alive and reports how much memory they take.
+ */
+static void retainShadowNodes(benchmark::State& state) {
+  CoreFeatures::enablePooledShadowNodes = state.range(0) != 0;
+
+  auto residentSizeDelta = 0.0;
+  for (auto _ : state) {
+    auto residentSizeBefore = residentSetSize();
+    auto nodes = createNodes(static_cast<int>(state.range(1)));
+    residentSizeDelta = static_cast<double>(residentSetSize()) -
+        static_cast<double>(residentSizeBefore);
+    benchmark::DoNotOptimize(nodes.data());
+  }
+
+  CoreFeatures::enablePooledShadowNodes = false;
+  state.counters["rssDeltaKB"] = residentSizeDelta / 1024;
+  state.counters["poolReservedKB"] =
+      static_cast<double>(SlabPool::getReservedSize()) / 1024;
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(retainShadowNodes)
+    ->ArgNames({"pooled", "nodes"})
+    ->Args({0, 100000})
+    ->Args({1, 100000})
+    ->Iterations(1);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <utility>
+
+#include <react/renderer/css/CSSDeclaredStyle.h>
+#include <react/renderer/css/CSSPropertyNames.h>
+
+namespace facebook::react {
+
+namespace detail {
+
+using CSSPropSetter = void (*)(CSSDeclaredStyle&, std::string_view);
+
+template <size_t... PropIndices>
+constexpr std::array<CSSPropSetter, sizeof...(PropIndices)> makeCSSPropSetters(
+    std::index_sequence<PropIndices...> /*propIndices*/) {
+  return {[](CSSDeclaredStyle& style, std::string_view value) {
+    style.set<static_cast<CSSProp>(PropIndices)>(value);
+  }...};
+}
+
+constexpr std::string_view trimCSSWhitespace(std::string_view css) {
+  constexpr std::string_view whitespace = " \t\n\r\f";
+  auto begin = css.find_first_not_of(whitespace);
+  if (begin == std::string_view::npos) {
+    return {};
+  }
+  auto end = css.find_last_not_of(whitespace);
+  return css.substr(begin, end - begin + 1);
+}
+
+} // namespace detail
+
+/**
+ * Sets the value of a property which is only known at runtime, parsing it from
+ * its CSS text.
+ */
+inline void
+setCSSProperty(CSSDeclaredStyle& style, CSSProp prop, std::string_view value) {
+  static constexpr auto setters = detail::makeCSSPropSetters(
+      std::make_index_sequence<static_cast<size_t>(kCSSPropCount)>{});
+  setters[to_underlying(prop)](style, value);
+}
+
+/**
+ * Parses a list of declarations, e.g. "display: flex; width: 50%", into a
+ * CSSDeclaredStyle. Declarations of unknown properties are ignored, and later
+ * declarations override earlier ones.
+ * https://www.w3.org/TR/css-syntax-3/#parse-list-of-declarations
+ */
+inline CSSDeclaredStyle parseCSSDeclarationBlock(std::string_view css) {
+  auto style = CSSDeclaredStyle{};
+
+  while (!css.empty()) {
+    auto end = css.find(';');
+    auto declaration = css.substr(0, end);
+    css = end == std::string_view::npos ? std::string_view{}
+                                        : css.substr(end + 1);
+
+    auto colon = declaration.find(':');
+    if (colon == std::string_view::npos) {
+      continue;
+    }
+
+    auto name = detail::trimCSSWhitespace(declaration.substr(0, colon));
+    if (auto prop = parseCSSProperty(name)) {
+      setCSSProperty(style, *prop, declaration.substr(colon + 1));
+    }
+  }
+
+  return style;
+}
+
+} // namespace facebook::react
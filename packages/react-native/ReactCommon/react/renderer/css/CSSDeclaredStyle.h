@@ -8,12 +8,13 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
-#include <react/debug/react_native_assert.h>
 #include <react/renderer/css/CSSParser.h>
 #include <react/renderer/css/CSSProperties.h>
 
@@ -29,23 +30,16 @@ class CSSDeclaredStyle {
   template <CSSProp Prop>
   void set(const CSSDeclaredValue<Prop>& value) {
     using DeclaredValueT = std::remove_cvref_t<CSSDeclaredValue<Prop>>;
-    static_assert(sizeof(value) <= sizeof(PropMapping::value));
+    static_assert(sizeof(value) <= sizeof(ValueStorage));
     static_assert(std::is_trivially_destructible_v<DeclaredValueT>);
 
-    if (specifiedProperties_.test(to_underlying(Prop))) {
-      auto it = std::lower_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      react_native_assert(it->prop == Prop);
-      std::construct_at(
-          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
-    } else {
-      auto it = std::upper_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      it = properties_.insert(it, {Prop, {}});
-      std::construct_at(
-          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
+    auto index = indexOf(Prop);
+    if (!specifiedProperties_.test(to_underlying(Prop))) {
+      insertAt(index);
       specifiedProperties_.set(to_underlying(Prop));
     }
+    std::construct_at(
+        reinterpret_cast<DeclaredValueT*>(values()[index].data()), value);
   }
 
   template <CSSProp Prop>
@@ -61,12 +55,7 @@ class CSSDeclaredStyle {
   template <CSSProp Prop, CSSProp... ShorthandsT>
   CSSDeclaredValue<Prop> get() const {
     if (specifiedProperties_.test(to_underlying(Prop))) {
-      auto it = std::lower_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      react_native_assert(it->prop == Prop);
-
-      CSSDeclaredValue<Prop> value{*std::launder(
-          reinterpret_cast<const CSSDeclaredValue<Prop>*>(it->value.data()))};
+      auto value = valueAt<Prop>(values()[indexOf(Prop)]);
 
       if (value) {
         return value;
@@ -80,29 +69,131 @@ class CSSDeclaredStyle {
     }
   }
 
-  bool operator==(const CSSDeclaredStyle& rhs) const = default;
+  /**
+   * Returns whether a value was ever set for the given property.
+   */
+  bool isSpecified(CSSProp prop) const {
+    return specifiedProperties_.test(to_underlying(prop));
+  }
+
+  /**
+   * Calls `callback` with every specified property, in `CSSProp` order.
+   */
+  template <typename CallbackT>
+  void forEachSpecifiedProp(CallbackT&& callback) const {
+    for (size_t i = 0; i < kCSSPropCount; i++) {
+      if (specifiedProperties_.test(i)) {
+        callback(static_cast<CSSProp>(i));
+      }
+    }
+  }
+
+  bool operator==(const CSSDeclaredStyle& rhs) const {
+    if (specifiedProperties_ != rhs.specifiedProperties_) {
+      return false;
+    }
+
+    size_t index = 0;
+    for (size_t i = 0; i < kCSSPropCount; i++) {
+      if (specifiedProperties_.test(i)) {
+        if (!kValueComparators[i](values()[index], rhs.values()[index])) {
+          return false;
+        }
+        index++;
+      }
+    }
+    return true;
+  }
 
  private:
-  struct PropMapping {
-    CSSProp prop;
-    std::array<
-        std::byte,
-        sizeof(CSSValueVariant<
-               CSSWideKeyword,
-               CSSKeyword,
-               CSSLength,
-               CSSNumber,
-               CSSPercentage,
-               CSSRatio>)>
-        value;
-
-    constexpr bool operator<(const PropMapping& rhs) const {
-      return to_underlying(prop) < to_underlying(rhs.prop);
+  using ValueStorage = std::array<
+      std::byte,
+      sizeof(CSSValueVariant<
+             CSSWideKeyword,
+             CSSKeyword,
+             CSSLength,
+             CSSNumber,
+             CSSPercentage,
+             CSSRatio>)>;
+
+  template <CSSProp Prop>
+  static CSSDeclaredValue<Prop> valueAt(const ValueStorage& storage) {
+    return *std::launder(
+        reinterpret_cast<const CSSDeclaredValue<Prop>*>(storage.data()));
+  }
+
+  /**
+   * Values are compared by their type, as storage may contain padding or
+   * bytes of a previous, larger value.
+   */
+  using ValueComparator = bool (*)(const ValueStorage&, const ValueStorage&);
+
+  template <size_t... PropIndices>
+  static constexpr std::array<ValueComparator, sizeof...(PropIndices)>
+  makeValueComparators(std::index_sequence<PropIndices...> /*propIndices*/) {
+    return {[](const ValueStorage& lhs, const ValueStorage& rhs) {
+      constexpr auto prop = static_cast<CSSProp>(PropIndices);
+      return valueAt<prop>(lhs) == valueAt<prop>(rhs);
+    }...};
+  }
+
+  static const std::array<ValueComparator, kCSSPropCount> kValueComparators;
+
+  /**
+   * Number of declarations stored without a heap allocation. Styles of most
+   * elements fit into it.
+   */
+  static constexpr size_t kInlineCapacity = 8;
+
+  /**
+   * Values are stored densely in `CSSProp` order, so the position of a value
+   * is the number of specified properties which precede it.
+   */
+  size_t indexOf(CSSProp prop) const {
+    return (specifiedProperties_ << (kCSSPropCount - to_underlying(prop)))
+        .count();
+  }
+
+  const ValueStorage* values() const {
+    return specifiedProperties_.count() <= kInlineCapacity
+        ? inlineValues_.data()
+        : outOfLineValues_.data();
+  }
+
+  ValueStorage* values() {
+    return const_cast<ValueStorage*>(std::as_const(*this).values());
+  }
+
+  /**
+   * Makes room for a new value at `index`. Must be called before the
+   * corresponding bit in `specifiedProperties_` is set.
+   */
+  void insertAt(size_t index) {
+    auto size = specifiedProperties_.count();
+    if (size < kInlineCapacity) {
+      std::copy_backward(
+          inlineValues_.begin() + index,
+          inlineValues_.begin() + size,
+          inlineValues_.begin() + size + 1);
+    } else {
+      if (size == kInlineCapacity) {
+        outOfLineValues_.assign(inlineValues_.begin(), inlineValues_.end());
+      }
+      outOfLineValues_.insert(
+          outOfLineValues_.begin() + static_cast<std::ptrdiff_t>(index),
+          ValueStorage{});
     }
-  };
+  }
 
-  std::vector<PropMapping> properties_;
   std::bitset<kCSSPropCount> specifiedProperties_;
+  std::array<ValueStorage, kInlineCapacity> inlineValues_{};
+  std::vector<ValueStorage> outOfLineValues_;
 };
 
+inline const std::array<
+    CSSDeclaredStyle::ValueComparator,
+    kCSSPropCount>
+    CSSDeclaredStyle::kValueComparators = makeValueComparators(
+        std::make_index_sequence<static_cast<size_t>(kCSSPropCount)>{});
+
 } // namespace facebook::react
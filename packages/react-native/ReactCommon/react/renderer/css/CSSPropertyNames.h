@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include <react/renderer/css/CSSProperties.h>
+#include <react/utils/fnv1a.h>
+
+namespace facebook::react {
+
+/**
+ * Parses the name of a CSS property, either in its CSS form (e.g.
+ * "flex-direction") or as a React Native style key (e.g. "flexDirection").
+ * Names are matched case-insensitively.
+ */
+constexpr std::optional<CSSProp> parseCSSProperty(std::string_view name) {
+  struct LowerCaseTransform {
+    constexpr char operator()(char c) const {
+      if (c >= 'A' && c <= 'Z') {
+        return c + static_cast<char>('a' - 'A');
+      }
+      return c;
+    }
+  };
+
+  switch (fnv1a<LowerCaseTransform>(name)) {
+    case fnv1a("align-content"):
+    case fnv1a("aligncontent"):
+      return CSSProp::AlignContent;
+    case fnv1a("align-items"):
+    case fnv1a("alignitems"):
+      return CSSProp::AlignItems;
+    case fnv1a("align-self"):
+    case fnv1a("alignself"):
+      return CSSProp::AlignSelf;
+    case fnv1a("aspect-ratio"):
+    case fnv1a("aspectratio"):
+      return CSSProp::AspectRatio;
+    case fnv1a("border-block-end-style"):
+    case fnv1a("borderblockendstyle"):
+      return CSSProp::BorderBlockEndStyle;
+    case fnv1a("border-block-end-width"):
+    case fnv1a("borderblockendwidth"):
+      return CSSProp::BorderBlockEndWidth;
+    case fnv1a("border-block-start-style"):
+    case fnv1a("borderblockstartstyle"):
+      return CSSProp::BorderBlockStartStyle;
+    case fnv1a("border-block-start-width"):
+    case fnv1a("borderblockstartwidth"):
+      return CSSProp::BorderBlockStartWidth;
+    case fnv1a("border-block-style"):
+    case fnv1a("borderblockstyle"):
+      return CSSProp::BorderBlockStyle;
+    case fnv1a("border-block-width"):
+    case fnv1a("borderblockwidth"):
+      return CSSProp::BorderBlockWidth;
+    case fnv1a("border-bottom-left-radius"):
+    case fnv1a("borderbottomleftradius"):
+      return CSSProp::BorderBottomLeftRadius;
+    case fnv1a("border-bottom-right-radius"):
+    case fnv1a("borderbottomrightradius"):
+      return CSSProp::BorderBottomRightRadius;
+    case fnv1a("border-bottom-style"):
+    case fnv1a("borderbottomstyle"):
+      return CSSProp::BorderBottomStyle;
+    case fnv1a("border-bottom-width"):
+    case fnv1a("borderbottomwidth"):
+      return CSSProp::BorderBottomWidth;
+    case fnv1a("border-end-end-radius"):
+    case fnv1a("borderendendradius"):
+      return CSSProp::BorderEndEndRadius;
+    case fnv1a("border-end-start-radius"):
+    case fnv1a("borderendstartradius"):
+      return CSSProp::BorderEndStartRadius;
+    case fnv1a("border-end-width"):
+    case fnv1a("borderendwidth"):
+      return CSSProp::BorderEndWidth;
+    case fnv1a("border-horizontal-width"):
+    case fnv1a("borderhorizontalwidth"):
+      return CSSProp::BorderHorizontalWidth;
+    case fnv1a("border-inline-end-style"):
+    case fnv1a("borderinlineendstyle"):
+      return CSSProp::BorderInlineEndStyle;
+    case fnv1a("border-inline-end-width"):
+    case fnv1a("borderinlineendwidth"):
+      return CSSProp::BorderInlineEndWidth;
+    case fnv1a("border-inline-start-style"):
+    case fnv1a("borderinlinestartstyle"):
+      return CSSProp::BorderInlineStartStyle;
+    case fnv1a("border-inline-start-width"):
+    case fnv1a("borderinlinestartwidth"):
+      return CSSProp::BorderInlineStartWidth;
+    case fnv1a("border-inline-style"):
+    case fnv1a("borderinlinestyle"):
+      return CSSProp::BorderInlineStyle;
+    case fnv1a("border-inline-width"):
+    case fnv1a("borderinlinewidth"):
+      return CSSProp::BorderInlineWidth;
+    case fnv1a("border-left-style"):
+    case fnv1a("borderleftstyle"):
+      return CSSProp::BorderLeftStyle;
+    case fnv1a("border-left-width"):
+    case fnv1a("borderleftwidth"):
+      return CSSProp::BorderLeftWidth;
+    case fnv1a("border-radius"):
+    case fnv1a("borderradius"):
+      return CSSProp::BorderRadius;
+    case fnv1a("border-right-style"):
+    case fnv1a("borderrightstyle"):
+      return CSSProp::BorderRightStyle;
+    case fnv1a("border-right-width"):
+    case fnv1a("borderrightwidth"):
+      return CSSProp::BorderRightWidth;
+    case fnv1a("border-start-end-radius"):
+    case fnv1a("borderstartendradius"):
+      return CSSProp::BorderStartEndRadius;
+    case fnv1a("border-start-start-radius"):
+    case fnv1a("borderstartstartradius"):
+      return CSSProp::BorderStartStartRadius;
+    case fnv1a("border-start-width"):
+    case fnv1a("borderstartwidth"):
+      return CSSProp::BorderStartWidth;
+    case fnv1a("border-style"):
+    case fnv1a("borderstyle"):
+      return CSSProp::BorderStyle;
+    case fnv1a("border-top-left-radius"):
+    case fnv1a("bordertopleftradius"):
+      return CSSProp::BorderTopLeftRadius;
+    case fnv1a("border-top-right-radius"):
+    case fnv1a("bordertoprightradius"):
+      return CSSProp::BorderTopRightRadius;
+    case fnv1a("border-top-style"):
+    case fnv1a("bordertopstyle"):
+      return CSSProp::BorderTopStyle;
+    case fnv1a("border-top-width"):
+    case fnv1a("bordertopwidth"):
+      return CSSProp::BorderTopWidth;
+    case fnv1a("border-vertical-width"):
+    case fnv1a("borderverticalwidth"):
+      return CSSProp::BorderVerticalWidth;
+    case fnv1a("border-width"):
+    case fnv1a("borderwidth"):
+      return CSSProp::BorderWidth;
+    case fnv1a("bottom"):
+      return CSSProp::Bottom;
+    case fnv1a("column-gap"):
+    case fnv1a("columngap"):
+      return CSSProp::ColumnGap;
+    case fnv1a("direction"):
+      return CSSProp::Direction;
+    case fnv1a("display"):
+      return CSSProp::Display;
+    case fnv1a("end"):
+      return CSSProp::End;
+    case fnv1a("flex"):
+      return CSSProp::Flex;
+    case fnv1a("flex-basis"):
+    case fnv1a("flexbasis"):
+      return CSSProp::FlexBasis;
+    case fnv1a("flex-direction"):
+    case fnv1a("flexdirection"):
+      return CSSProp::FlexDirection;
+    case fnv1a("flex-grow"):
+    case fnv1a("flexgrow"):
+      return CSSProp::FlexGrow;
+    case fnv1a("flex-shrink"):
+    case fnv1a("flexshrink"):
+      return CSSProp::FlexShrink;
+    case fnv1a("flex-wrap"):
+    case fnv1a("flexwrap"):
+      return CSSProp::FlexWrap;
+    case fnv1a("gap"):
+      return CSSProp::Gap;
+    case fnv1a("height"):
+      return CSSProp::Height;
+    case fnv1a("inset"):
+      return CSSProp::Inset;
+    case fnv1a("inset-block"):
+    case fnv1a("insetblock"):
+      return CSSProp::InsetBlock;
+    case fnv1a("inset-block-end"):
+    case fnv1a("insetblockend"):
+      return CSSProp::InsetBlockEnd;
+    case fnv1a("inset-block-start"):
+    case fnv1a("insetblockstart"):
+      return CSSProp::InsetBlockStart;
+    case fnv1a("inset-inline"):
+    case fnv1a("insetinline"):
+      return CSSProp::InsetInline;
+    case fnv1a("inset-inline-end"):
+    case fnv1a("insetinlineend"):
+      return CSSProp::InsetInlineEnd;
+    case fnv1a("inset-inline-start"):
+    case fnv1a("insetinlinestart"):
+      return CSSProp::InsetInlineStart;
+    case fnv1a("justify-content"):
+    case fnv1a("justifycontent"):
+      return CSSProp::JustifyContent;
+    case fnv1a("left"):
+      return CSSProp::Left;
+    case fnv1a("margin"):
+      return CSSProp::Margin;
+    case fnv1a("margin-block"):
+    case fnv1a("marginblock"):
+      return CSSProp::MarginBlock;
+    case fnv1a("margin-block-end"):
+    case fnv1a("marginblockend"):
+      return CSSProp::MarginBlockEnd;
+    case fnv1a("margin-block-start"):
+    case fnv1a("marginblockstart"):
+      return CSSProp::MarginBlockStart;
+    case fnv1a("margin-bottom"):
+    case fnv1a("marginbottom"):
+      return CSSProp::MarginBottom;
+    case fnv1a("margin-end"):
+    case fnv1a("marginend"):
+      return CSSProp::MarginEnd;
+    case fnv1a("margin-horizontal"):
+    case fnv1a("marginhorizontal"):
+      return CSSProp::MarginHorizontal;
+    case fnv1a("margin-inline"):
+    case fnv1a("margininline"):
+      return CSSProp::MarginInline;
+    case fnv1a("margin-inline-end"):
+    case fnv1a("margininlineend"):
+      return CSSProp::MarginInlineEnd;
+    case fnv1a("margin-inline-start"):
+    case fnv1a("margininlinestart"):
+      return CSSProp::MarginInlineStart;
+    case fnv1a("margin-left"):
+    case fnv1a("marginleft"):
+      return CSSProp::MarginLeft;
+    case fnv1a("margin-right"):
+    case fnv1a("marginright"):
+      return CSSProp::MarginRight;
+    case fnv1a("margin-start"):
+    case fnv1a("marginstart"):
+      return CSSProp::MarginStart;
+    case fnv1a("margin-top"):
+    case fnv1a("margintop"):
+      return CSSProp::MarginTop;
+    case fnv1a("margin-vertical"):
+    case fnv1a("marginvertical"):
+      return CSSProp::MarginVertical;
+    case fnv1a("max-height"):
+    case fnv1a("maxheight"):
+      return CSSProp::MaxHeight;
+    case fnv1a("max-width"):
+    case fnv1a("maxwidth"):
+      return CSSProp::MaxWidth;
+    case fnv1a("min-height"):
+    case fnv1a("minheight"):
+      return CSSProp::MinHeight;
+    case fnv1a("min-width"):
+    case fnv1a("minwidth"):
+      return CSSProp::MinWidth;
+    case fnv1a("opacity"):
+      return CSSProp::Opacity;
+    case fnv1a("overflow"):
+      return CSSProp::Overflow;
+    case fnv1a("padding"):
+      return CSSProp::Padding;
+    case fnv1a("padding-block"):
+    case fnv1a("paddingblock"):
+      return CSSProp::PaddingBlock;
+    case fnv1a("padding-block-end"):
+    case fnv1a("paddingblockend"):
+      return CSSProp::PaddingBlockEnd;
+    case fnv1a("padding-block-start"):
+    case fnv1a("paddingblockstart"):
+      return CSSProp::PaddingBlockStart;
+    case fnv1a("padding-bottom"):
+    case fnv1a("paddingbottom"):
+      return CSSProp::PaddingBottom;
+    case fnv1a("padding-end"):
+    case fnv1a("paddingend"):
+      return CSSProp::PaddingEnd;
+    case fnv1a("padding-horizontal"):
+    case fnv1a("paddinghorizontal"):
+      return CSSProp::PaddingHorizontal;
+    case fnv1a("padding-inline"):
+    case fnv1a("paddinginline"):
+      return CSSProp::PaddingInline;
+    case fnv1a("padding-inline-end"):
+    case fnv1a("paddinginlineend"):
+      return CSSProp::PaddingInlineEnd;
+    case fnv1a("padding-inline-start"):
+    case fnv1a("paddinginlinestart"):
+      return CSSProp::PaddingInlineStart;
+    case fnv1a("padding-left"):
+    case fnv1a("paddingleft"):
+      return CSSProp::PaddingLeft;
+    case fnv1a("padding-right"):
+    case fnv1a("paddingright"):
+      return CSSProp::PaddingRight;
+    case fnv1a("padding-start"):
+    case fnv1a("paddingstart"):
+      return CSSProp::PaddingStart;
+    case fnv1a("padding-top"):
+    case fnv1a("paddingtop"):
+      return CSSProp::PaddingTop;
+    case fnv1a("padding-vertical"):
+    case fnv1a("paddingvertical"):
+      return CSSProp::PaddingVertical;
+    case fnv1a("position"):
+      return CSSProp::Position;
+    case fnv1a("right"):
+      return CSSProp::Right;
+    case fnv1a("row-gap"):
+    case fnv1a("rowgap"):
+      return CSSProp::RowGap;
+    case fnv1a("start"):
+      return CSSProp::Start;
+    case fnv1a("top"):
+      return CSSProp::Top;
+    case fnv1a("width"):
+      return CSSProp::Width;
+    default:
+      return std::nullopt;
+  }
+}
+
+} // namespace facebook::react
@@ -46,6 +46,7 @@ concept CSSDataType = std::is_trivially_destructible_v<T> &&
 struct CSSLength {
   float value{};
   CSSLengthUnit unit{CSSLengthUnit::Px};
+  constexpr bool operator==(const CSSLength&) const = default;
 };
 #pragma pack(pop)
 
@@ -55,6 +56,7 @@ struct CSSLength {
  */
 struct CSSPercentage {
   float value{};
+  constexpr bool operator==(const CSSPercentage&) const = default;
 };
 
 /**
@@ -63,6 +65,7 @@ struct CSSPercentage {
  */
 struct CSSNumber {
   float value{};
+  constexpr bool operator==(const CSSNumber&) const = default;
 };
 
 /**
@@ -72,6 +75,7 @@ struct CSSNumber {
 struct CSSRatio {
   float numerator{};
   float denominator{};
+  constexpr bool operator==(const CSSRatio&) const = default;
 };
 
 /**
@@ -214,17 +218,35 @@ class CSSValueVariant {
     }
     switch (type()) {
       case CSSValueType::CSSWideKeyword:
-        return getCSSWideKeyword() == other.getCSSWideKeyword();
+        if constexpr (canRepresent<CSSWideKeyword>()) {
+          return getCSSWideKeyword() == other.getCSSWideKeyword();
+        }
+        break;
       case CSSValueType::Keyword:
-        return getKeyword() == other.getKeyword();
+        if constexpr (hasKeywordSet<AllowedTypesT...>()) {
+          return getKeyword() == other.getKeyword();
+        }
+        break;
       case CSSValueType::Length:
-        return getLength() == other.getLength();
+        if constexpr (canRepresent<CSSLength>()) {
+          return getLength() == other.getLength();
+        }
+        break;
       case CSSValueType::Number:
-        return getNumber() == other.getNumber();
+        if constexpr (canRepresent<CSSNumber>()) {
+          return getNumber() == other.getNumber();
+        }
+        break;
       case CSSValueType::Percentage:
-        return getPercentage() == other.getPercentage();
+        if constexpr (canRepresent<CSSPercentage>()) {
+          return getPercentage() == other.getPercentage();
+        }
+        break;
       case CSSValueType::Ratio:
-        return getRatio() == other.getRatio();
+        if constexpr (canRepresent<CSSRatio>()) {
+          return getRatio() == other.getRatio();
+        }
+        break;
     }
 
     return false;
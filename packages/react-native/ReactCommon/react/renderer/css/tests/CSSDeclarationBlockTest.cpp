@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/css/CSSDeclarationBlock.h>
+
+namespace facebook::react {
+
+TEST(CSSDeclarationBlock, property_names) {
+  EXPECT_EQ(parseCSSProperty("flex-direction"), CSSProp::FlexDirection);
+  EXPECT_EQ(parseCSSProperty("flexDirection"), CSSProp::FlexDirection);
+  EXPECT_EQ(parseCSSProperty("FLEX-DIRECTION"), CSSProp::FlexDirection);
+  EXPECT_EQ(parseCSSProperty("width"), CSSProp::Width);
+  EXPECT_EQ(parseCSSProperty("marginHorizontal"), CSSProp::MarginHorizontal);
+  EXPECT_EQ(parseCSSProperty("border-top-width"), CSSProp::BorderTopWidth);
+  EXPECT_EQ(parseCSSProperty("color"), std::nullopt);
+}
+
+TEST(CSSDeclarationBlock, empty) {
+  auto style = parseCSSDeclarationBlock("");
+  EXPECT_EQ(style, CSSDeclaredStyle{});
+
+  style = parseCSSDeclarationBlock(" ; ;");
+  EXPECT_EQ(style, CSSDeclaredStyle{});
+}
+
+TEST(CSSDeclarationBlock, declarations) {
+  auto style = parseCSSDeclarationBlock(
+      "display: flex; flex-direction:row;width: 50%;\n"
+      "  aspectRatio : 16 / 9 ;margin-top: 4px");
+
+  EXPECT_EQ(
+      style.get<CSSProp::Display>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::Display>::Flex);
+  EXPECT_EQ(
+      style.get<CSSProp::FlexDirection>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::FlexDirection>::Row);
+  EXPECT_EQ(style.get<CSSProp::Width>().getPercentage().value, 50.0f);
+  EXPECT_EQ(style.get<CSSProp::AspectRatio>().getRatio().numerator, 16.0f);
+  EXPECT_EQ(style.get<CSSProp::AspectRatio>().getRatio().denominator, 9.0f);
+  EXPECT_EQ(style.get<CSSProp::MarginTop>().getLength().value, 4.0f);
+}
+
+TEST(CSSDeclarationBlock, unknown_and_repeated_declarations) {
+  auto style = parseCSSDeclarationBlock(
+      "color: red; width: 1px; bogus; width: 2px");
+
+  EXPECT_EQ(style.get<CSSProp::Width>().getLength().value, 2.0f);
+
+  auto expected = CSSDeclaredStyle{};
+  expected.set<CSSProp::Width>("2px");
+  EXPECT_EQ(style, expected);
+}
+
+} // namespace facebook::react
@@ -148,4 +148,74 @@ TEST(CSSDeclaredStyle, get_with_precedence) {
   EXPECT_EQ(margin2.getLength().unit, CSSLengthUnit::Px);
 }
 
+TEST(CSSDeclaredStyle, many_properties) {
+  CSSDeclaredStyle style;
+
+  // Set in reverse order, and more than fits into the inline storage.
+  style.set<CSSProp::Width>("10px");
+  style.set<CSSProp::Top>("20%");
+  style.set<CSSProp::PaddingTop>("3px");
+  style.set<CSSProp::Opacity>("0.5");
+  style.set<CSSProp::MarginTop>("auto");
+  style.set<CSSProp::Height>("5px");
+  style.set<CSSProp::FlexGrow>("2");
+  style.set<CSSProp::FlexDirection>("row");
+  style.set<CSSProp::Display>("none");
+  style.set<CSSProp::AspectRatio>("16 / 9");
+  style.set<CSSProp::AlignItems>("center");
+
+  EXPECT_EQ(style.get<CSSProp::Width>().getLength().value, 10.0f);
+  EXPECT_EQ(style.get<CSSProp::Top>().getPercentage().value, 20.0f);
+  EXPECT_EQ(style.get<CSSProp::PaddingTop>().getLength().value, 3.0f);
+  EXPECT_EQ(style.get<CSSProp::Opacity>().getNumber().value, 0.5f);
+  EXPECT_EQ(
+      style.get<CSSProp::MarginTop>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::MarginTop>::Auto);
+  EXPECT_EQ(style.get<CSSProp::Height>().getLength().value, 5.0f);
+  EXPECT_EQ(style.get<CSSProp::FlexGrow>().getNumber().value, 2.0f);
+  EXPECT_EQ(
+      style.get<CSSProp::FlexDirection>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::FlexDirection>::Row);
+  EXPECT_EQ(
+      style.get<CSSProp::Display>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::Display>::None);
+  EXPECT_EQ(style.get<CSSProp::AspectRatio>().getRatio().numerator, 16.0f);
+  EXPECT_EQ(
+      style.get<CSSProp::AlignItems>().getKeyword(),
+      CSSAllowedKeywords<CSSProp::AlignItems>::Center);
+
+  EXPECT_EQ(
+      style.get<CSSProp::MinWidth>().type(), CSSValueType::CSSWideKeyword);
+
+  auto copy = style;
+  EXPECT_EQ(copy, style);
+  copy.set<CSSProp::Width>("11px");
+  EXPECT_NE(copy, style);
+}
+
+TEST(CSSDeclaredStyle, for_each_specified_prop) {
+  CSSDeclaredStyle style;
+
+  style.set<CSSProp::Width>("10px");
+  style.set<CSSProp::AlignItems>("center");
+
+  std::vector<CSSProp> props;
+  style.forEachSpecifiedProp([&](CSSProp prop) { props.push_back(prop); });
+
+  EXPECT_EQ(props, (std::vector{CSSProp::AlignItems, CSSProp::Width}));
+  EXPECT_TRUE(style.isSpecified(CSSProp::Width));
+  EXPECT_FALSE(style.isSpecified(CSSProp::Height));
+}
+
+TEST(CSSDeclaredStyle, equality_ignores_stale_storage) {
+  CSSDeclaredStyle style;
+  style.set<CSSProp::Width>("10px");
+  style.set<CSSProp::Width>("auto");
+
+  CSSDeclaredStyle other;
+  other.set<CSSProp::Width>("auto");
+
+  EXPECT_EQ(style, other);
+}
+
 } // namespace facebook::react
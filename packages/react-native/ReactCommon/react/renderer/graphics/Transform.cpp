@@ -12,8 +12,200 @@
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RN_TRANSFORM_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RN_TRANSFORM_NEON 1
+#endif
+
+// Compilers contract `a * b + c` into a fused multiply-add by default on
+// arm64, which the SIMD kernels below don't do. Contraction is disabled so
+// that every path rounds each multiplication and addition separately.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
 namespace facebook::react {
 
+/*
+ * Thin wrappers around SIMD registers holding several matrix elements.
+ * Only separately rounded multiplications and additions are used (never
+ * fused ones), so the vectorized kernels below produce bit-identical results
+ * with the scalar ones.
+ */
+template <typename T>
+struct SimdLanes {
+  static constexpr bool available = false;
+};
+
+#if RN_TRANSFORM_SSE
+template <>
+struct SimdLanes<float> {
+  static constexpr bool available = true;
+  static constexpr int width = 4;
+  using Register = __m128;
+  static Register load(const float* p) {
+    return _mm_loadu_ps(p);
+  }
+  static Register splat(float value) {
+    return _mm_set1_ps(value);
+  }
+  static Register mul(Register a, Register b) {
+    return _mm_mul_ps(a, b);
+  }
+  static Register add(Register a, Register b) {
+    return _mm_add_ps(a, b);
+  }
+  static void store(float* p, Register value) {
+    _mm_storeu_ps(p, value);
+  }
+};
+
+template <>
+struct SimdLanes<double> {
+  static constexpr bool available = true;
+  static constexpr int width = 2;
+  using Register = __m128d;
+  static Register load(const double* p) {
+    return _mm_loadu_pd(p);
+  }
+  static Register splat(double value) {
+    return _mm_set1_pd(value);
+  }
+  static Register mul(Register a, Register b) {
+    return _mm_mul_pd(a, b);
+  }
+  static Register add(Register a, Register b) {
+    return _mm_add_pd(a, b);
+  }
+  static void store(double* p, Register value) {
+    _mm_storeu_pd(p, value);
+  }
+};
+#endif
+
+#if RN_TRANSFORM_NEON
+template <>
+struct SimdLanes<float> {
+  static constexpr bool available = true;
+  static constexpr int width = 4;
+  using Register = float32x4_t;
+  static Register load(const float* p) {
+    return vld1q_f32(p);
+  }
+  static Register splat(float value) {
+    return vdupq_n_f32(value);
+  }
+  static Register mul(Register a, Register b) {
+    return vmulq_f32(a, b);
+  }
+  static Register add(Register a, Register b) {
+    return vaddq_f32(a, b);
+  }
+  static void store(float* p, Register value) {
+    vst1q_f32(p, value);
+  }
+};
+
+#if defined(__aarch64__)
+template <>
+struct SimdLanes<double> {
+  static constexpr bool available = true;
+  static constexpr int width = 2;
+  using Register = float64x2_t;
+  static Register load(const double* p) {
+    return vld1q_f64(p);
+  }
+  static Register splat(double value) {
+    return vdupq_n_f64(value);
+  }
+  static Register mul(Register a, Register b) {
+    return vmulq_f64(a, b);
+  }
+  static Register add(Register a, Register b) {
+    return vaddq_f64(a, b);
+  }
+  static void store(double* p, Register value) {
+    vst1q_f64(p, value);
+  }
+};
+#endif
+#endif
+
+/*
+ * Computes `result = c[0] * rows[0] + c[1] * rows[1] + c[2] * rows[2] +
+ * c[3] * rows[3]` where `rows` is a row-major 4x4 matrix. Every row of a
+ * matrix product, as well as a product of a vector and a matrix, is such a
+ * combination.
+ */
+static inline void combineRows(
+    const Float* rows,
+    const Float* c,
+    Float* result) {
+  if constexpr (SimdLanes<Float>::available) {
+    using Lanes = SimdLanes<Float>;
+    typename Lanes::Register values[4 / Lanes::width];
+    for (int j = 0; j < 4; j += Lanes::width) {
+      auto value = Lanes::mul(Lanes::splat(c[0]), Lanes::load(rows + j));
+      value = Lanes::add(
+          value, Lanes::mul(Lanes::splat(c[1]), Lanes::load(rows + 4 + j)));
+      value = Lanes::add(
+          value, Lanes::mul(Lanes::splat(c[2]), Lanes::load(rows + 8 + j)));
+      value = Lanes::add(
+          value, Lanes::mul(Lanes::splat(c[3]), Lanes::load(rows + 12 + j)));
+      values[j / Lanes::width] = value;
+    }
+    // Storing only after all loads keeps the function safe for aliased
+    // arguments.
+    for (int j = 0; j < 4; j += Lanes::width) {
+      Lanes::store(result + j, values[j / Lanes::width]);
+    }
+  } else {
+    Float values[4];
+    for (int j = 0; j < 4; j++) {
+      values[j] = c[0] * rows[j] + c[1] * rows[4 + j] + c[2] * rows[8 + j] +
+          c[3] * rows[12 + j];
+    }
+    for (int j = 0; j < 4; j++) {
+      result[j] = values[j];
+    }
+  }
+}
+
+/*
+ * Computes `result = rhs x lhs`, which is how `Transform::operator*`
+ * concatenates matrices. `result` must not alias any of the arguments.
+ */
+static inline void multiplyMatrices(
+    const Float* lhs,
+    const Float* rhs,
+    Float* result) {
+  if constexpr (SimdLanes<Float>::available) {
+    using Lanes = SimdLanes<Float>;
+    for (int j = 0; j < 4; j += Lanes::width) {
+      auto row0 = Lanes::load(lhs + j);
+      auto row1 = Lanes::load(lhs + 4 + j);
+      auto row2 = Lanes::load(lhs + 8 + j);
+      auto row3 = Lanes::load(lhs + 12 + j);
+      for (int i = 0; i < 16; i += 4) {
+        auto value = Lanes::mul(Lanes::splat(rhs[i]), row0);
+        value = Lanes::add(value, Lanes::mul(Lanes::splat(rhs[i + 1]), row1));
+        value = Lanes::add(value, Lanes::mul(Lanes::splat(rhs[i + 2]), row2));
+        value = Lanes::add(value, Lanes::mul(Lanes::splat(rhs[i + 3]), row3));
+        Lanes::store(result + i + j, value);
+      }
+    }
+  } else {
+    for (int i = 0; i < 16; i += 4) {
+      combineRows(lhs, rhs + i, result + i);
+    }
+  }
+}
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 void Transform::print(const Transform& t, std::string prefix) {
   LOG(ERROR) << prefix << "[ " << t.matrix[0] << " " << t.matrix[1] << " "
@@ -205,7 +397,7 @@ Transform Transform::Interpolate(
     if ((haveLHS &&
          lhs.operations[i].type == TransformOperationType::Arbitrary) ||
         (haveRHS &&
-         rhs.operations[i].type == TransformOperationType::Arbitrary)) {
+         rhs.operations[j].type == TransformOperationType::Arbitrary)) {
       return result;
     }
     if (haveLHS && lhs.operations[i].type == TransformOperationType::Identity) {
@@ -291,58 +483,8 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  multiplyMatrices(
+      lhs.matrix.data(), rhs.matrix.data(), result.matrix.data());
 
   return result;
 }
@@ -399,16 +541,10 @@ EdgeInsets operator*(const EdgeInsets& edgeInsets, const Transform& transform) {
 }
 
 Vector operator*(const Transform& transform, const Vector& vector) {
-  return {
-      vector.x * transform.at(0, 0) + vector.y * transform.at(1, 0) +
-          vector.z * transform.at(2, 0) + vector.w * transform.at(3, 0),
-      vector.x * transform.at(0, 1) + vector.y * transform.at(1, 1) +
-          vector.z * transform.at(2, 1) + vector.w * transform.at(3, 1),
-      vector.x * transform.at(0, 2) + vector.y * transform.at(1, 2) +
-          vector.z * transform.at(2, 2) + vector.w * transform.at(3, 2),
-      vector.x * transform.at(0, 3) + vector.y * transform.at(1, 3) +
-          vector.z * transform.at(2, 3) + vector.w * transform.at(3, 3),
-  };
+  Float coefficients[4] = {vector.x, vector.y, vector.z, vector.w};
+  Float result[4];
+  combineRows(transform.matrix.data(), coefficients, result);
+  return {result[0], result[1], result[2], result[3]};
 }
 
 Size operator*(const Size& size, const Transform& transform) {
@@ -10,6 +10,7 @@
 #include <array>
 #include <vector>
 
+#include <folly/small_vector.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Point.h>
 #include <react/renderer/graphics/RectangleEdges.h>
@@ -52,6 +53,12 @@ struct TransformOperation {
   Float z;
 };
 
+/*
+ * The vast majority of transforms consist of just a few operations, which
+ * are stored inline to keep composition and interpolation allocation-free.
+ */
+using TransformOperations = folly::small_vector<TransformOperation, 4>;
+
 struct TransformOrigin {
   std::array<ValueUnit, 2> xy;
   float z = 0.0f;
@@ -72,7 +79,7 @@ struct TransformOrigin {
  * Defines transform matrix to apply affine transformations.
  */
 struct Transform {
-  std::vector<TransformOperation> operations{};
+  TransformOperations operations{};
 
   std::array<Float, 16> matrix{
       {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
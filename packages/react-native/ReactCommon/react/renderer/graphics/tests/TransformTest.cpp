@@ -8,10 +8,73 @@
 #include <react/renderer/graphics/Transform.h>
 
 #include <gtest/gtest.h>
+#include <array>
 #include <cmath>
+#include <vector>
 
 using namespace facebook::react;
 
+// Evaluated like Transform.cpp, without contraction into fused multiply-adds.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace {
+
+// `Transform::operator*` before it was vectorized.
+std::array<Float, 16> baselineMultiply(
+    const Transform& lhs,
+    const Transform& rhs) {
+  auto result = std::array<Float, 16>{};
+
+  auto lhs00 = lhs.matrix[0];
+  auto lhs01 = lhs.matrix[1];
+  auto lhs02 = lhs.matrix[2];
+  auto lhs03 = lhs.matrix[3];
+  auto lhs10 = lhs.matrix[4];
+  auto lhs11 = lhs.matrix[5];
+  auto lhs12 = lhs.matrix[6];
+  auto lhs13 = lhs.matrix[7];
+  auto lhs20 = lhs.matrix[8];
+  auto lhs21 = lhs.matrix[9];
+  auto lhs22 = lhs.matrix[10];
+  auto lhs23 = lhs.matrix[11];
+  auto lhs30 = lhs.matrix[12];
+  auto lhs31 = lhs.matrix[13];
+  auto lhs32 = lhs.matrix[14];
+  auto lhs33 = lhs.matrix[15];
+
+  for (int i = 0; i < 16; i += 4) {
+    auto rhs0 = rhs.matrix[i];
+    auto rhs1 = rhs.matrix[i + 1];
+    auto rhs2 = rhs.matrix[i + 2];
+    auto rhs3 = rhs.matrix[i + 3];
+    result[i] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
+    result[i + 1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
+    result[i + 2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
+    result[i + 3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  }
+  return result;
+}
+
+// `operator*(const Transform&, const Vector&)` before it was vectorized.
+Vector baselineApply(const Transform& transform, const Vector& vector) {
+  return {
+      vector.x * transform.at(0, 0) + vector.y * transform.at(1, 0) +
+          vector.z * transform.at(2, 0) + vector.w * transform.at(3, 0),
+      vector.x * transform.at(0, 1) + vector.y * transform.at(1, 1) +
+          vector.z * transform.at(2, 1) + vector.w * transform.at(3, 1),
+      vector.x * transform.at(0, 2) + vector.y * transform.at(1, 2) +
+          vector.z * transform.at(2, 2) + vector.w * transform.at(3, 2),
+      vector.x * transform.at(0, 3) + vector.y * transform.at(1, 3) +
+          vector.z * transform.at(2, 3) + vector.w * transform.at(3, 3),
+  };
+}
+
+} // namespace
+
 TEST(TransformTest, transformingSize) {
   auto size = facebook::react::Size{100, 200};
   auto scaledSize = size * Transform::Scale(0.5, 0.5, 1);
@@ -90,3 +153,59 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, concatenatingMatchesScalarMultiplication) {
+  auto transforms = std::vector<Transform>{
+      Transform::Perspective(500) * Transform::RotateX(0.3) *
+          Transform::Skew(0.2, 0.1),
+      Transform::Translate(10, -20, 3) * Transform::RotateZ(1.1) *
+          Transform::Scale(1.5, 0.5, 2),
+      Transform::RotateY(0.7) * Transform::Translate(0.1, 0.2, 0.3),
+      Transform::Skew(-0.4, 0.9) * Transform::Perspective(123.456),
+  };
+  auto vectors = std::vector<Vector>{
+      {3, -7, 11, 1}, {0.1, 0.2, 0.3, 1}, {-1e3, 7.77, 1.0 / 3, 0.5}};
+
+  // Vectorized kernels must give the same bits as the scalar code they
+  // replaced.
+  for (const auto& lhs : transforms) {
+    for (const auto& rhs : transforms) {
+      auto result = lhs * rhs;
+      auto expected = baselineMultiply(lhs, rhs);
+      for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(result.matrix[i], expected[i]);
+      }
+
+      for (const auto& vector : vectors) {
+        auto transformedVector = result * vector;
+        auto expectedVector = baselineApply(result, vector);
+        EXPECT_EQ(transformedVector.x, expectedVector.x);
+        EXPECT_EQ(transformedVector.y, expectedVector.y);
+        EXPECT_EQ(transformedVector.z, expectedVector.z);
+        EXPECT_EQ(transformedVector.w, expectedVector.w);
+      }
+    }
+  }
+}
+
+TEST(TransformTest, interpolatingOperations) {
+  auto lhs = Transform::Translate(0, 0, 0) * Transform::Scale(1, 1, 1);
+  auto rhs = Transform::Translate(100, 50, 0) * Transform::Scale(2, 3, 1) *
+      Transform::RotateZ(M_PI_2);
+  EXPECT_EQ(rhs.operations.size(), 3u);
+
+  auto start = Transform::Interpolate(0, lhs, rhs);
+  EXPECT_EQ(start, Transform::Identity());
+
+  auto end = Transform::Interpolate(1, lhs, rhs);
+  for (int i = 0; i < 16; i++) {
+    ASSERT_NEAR(end.matrix[i], rhs.matrix[i], 0.0001);
+  }
+
+  auto middle = Transform::Interpolate(0.5, lhs, rhs);
+  auto expected = Transform::Translate(50, 25, 0) *
+      Transform::Scale(1.5, 2, 1) * Transform::RotateZ(M_PI_4);
+  for (int i = 0; i < 16; i++) {
+    ASSERT_NEAR(middle.matrix[i], expected.matrix[i], 0.0001);
+  }
+}
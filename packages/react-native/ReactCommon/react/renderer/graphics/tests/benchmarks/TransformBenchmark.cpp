@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Pairs of transforms similar to what LayoutAnimations interpolates for
+ * every animated view on every frame.
+ */
+static std::vector<std::pair<Transform, Transform>> generateTransformPairs(
+    size_t count) {
+  auto pairs = std::vector<std::pair<Transform, Transform>>{};
+  pairs.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto f = static_cast<Float>(i % 100) / 100;
+    pairs.emplace_back(
+        Transform::Translate(0, 10 * f, 0) * Transform::Scale(1, 1, 1),
+        Transform::Translate(100 * f, 0, 0) *
+            Transform::Scale(1 + f, 1 + f, 1) * Transform::RotateZ(f));
+  }
+  return pairs;
+}
+
+static void interpolateTransforms(benchmark::State& state) {
+  auto pairs = generateTransformPairs(static_cast<size_t>(state.range(0)));
+  auto progress = Float{0};
+  for (auto _ : state) {
+    progress = progress >= 1 ? 0 : progress + Float{0.016};
+    for (const auto& [lhs, rhs] : pairs) {
+      auto transform = Transform::Interpolate(progress, lhs, rhs);
+      benchmark::DoNotOptimize(transform);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(interpolateTransforms)->Arg(10000);
+
+static void concatenateTransforms(benchmark::State& state) {
+  auto pairs = generateTransformPairs(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const auto& [lhs, rhs] : pairs) {
+      auto transform = lhs * rhs;
+      benchmark::DoNotOptimize(transform);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(concatenateTransforms)->Arg(10000);
+
+static void applyTransformToRect(benchmark::State& state) {
+  auto pairs = generateTransformPairs(static_cast<size_t>(state.range(0)));
+  auto rect = Rect{{10, 20}, {100, 50}};
+  for (auto _ : state) {
+    for (const auto& [lhs, rhs] : pairs) {
+      auto transformedRect = rect * rhs;
+      benchmark::DoNotOptimize(transformedRect);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(applyTransformToRect)->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -19,6 +19,16 @@ ImageRequest::ImageRequest(
   coordinator_ = std::make_shared<ImageResponseObserverCoordinator>();
 }
 
+ImageRequest::ImageRequest(
+    ImageSource imageSource,
+    std::shared_ptr<const ImageTelemetry> telemetry,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator,
+    SharedFunction<> cancelationFunction)
+    : imageSource_(std::move(imageSource)),
+      telemetry_(std::move(telemetry)),
+      coordinator_(std::move(coordinator)),
+      cancelRequest_(std::move(cancelationFunction)) {}
+
 void ImageRequest::cancel() const {
   cancelRequest_();
 }
@@ -33,6 +33,17 @@ class ImageRequest final {
       std::shared_ptr<const ImageTelemetry> telemetry,
       SharedFunction<> cancelationFunction);
 
+  /*
+   * Creates a request which shares the response (and the observer
+   * coordinator) of other requests for the same image, e.g. when an image
+   * manager deduplicates identical loads.
+   */
+  ImageRequest(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator,
+      SharedFunction<> cancelationFunction);
+
   /*
    * The move constructor.
    */
@@ -19,7 +19,12 @@ void ImageResponseObserverCoordinator::addObserver(
   switch (status_) {
     case ImageResponse::Status::Loading: {
       observers_.push_back(&observer);
+      auto observationCallback =
+          observers_.size() == 1 ? observationCallback_ : nullptr;
       mutex_.unlock();
+      if (observationCallback) {
+        observationCallback(true);
+      }
       break;
     }
     case ImageResponse::Status::Completed: {
@@ -40,15 +45,35 @@ void ImageResponseObserverCoordinator::addObserver(
 
 void ImageResponseObserverCoordinator::removeObserver(
     const ImageResponseObserver& observer) const {
-  std::scoped_lock lock(mutex_);
+  std::function<void(bool isObserved)> observationCallback;
+
+  {
+    std::scoped_lock lock(mutex_);
+
+    // We remove only one element to maintain a balance between add/remove
+    // calls.
+    auto position = std::find(observers_.begin(), observers_.end(), &observer);
+    if (position == observers_.end()) {
+      return;
+    }
+    observers_.erase(position);
 
-  // We remove only one element to maintain a balance between add/remove calls.
-  auto position = std::find(observers_.begin(), observers_.end(), &observer);
-  if (position != observers_.end()) {
-    observers_.erase(position, observers_.end());
+    if (observers_.empty() && status_ == ImageResponse::Status::Loading) {
+      observationCallback = observationCallback_;
+    }
+  }
+
+  if (observationCallback) {
+    observationCallback(false);
   }
 }
 
+void ImageResponseObserverCoordinator::setObservationCallback(
+    std::function<void(bool isObserved)> observationCallback) const {
+  std::scoped_lock lock(mutex_);
+  observationCallback_ = std::move(observationCallback);
+}
+
 void ImageResponseObserverCoordinator::nativeImageResponseProgress(
     float progress,
     int64_t loaded,
@@ -71,9 +96,10 @@ void ImageResponseObserverCoordinator::nativeImageResponseComplete(
   react_native_assert(status_ == ImageResponse::Status::Loading);
   status_ = ImageResponse::Status::Completed;
   auto observers = observers_;
+  observationCallback_ = nullptr;
   mutex_.unlock();
 
-  for (auto observer : observers_) {
+  for (auto observer : observers) {
     observer->didReceiveImage(imageResponse);
   }
 }
@@ -85,6 +111,7 @@ void ImageResponseObserverCoordinator::nativeImageResponseFailed(
   status_ = ImageResponse::Status::Failed;
   imageErrorData_ = loadError.getError();
   auto observers = observers_;
+  observationCallback_ = nullptr;
   mutex_.unlock();
 
   for (auto observer : observers) {
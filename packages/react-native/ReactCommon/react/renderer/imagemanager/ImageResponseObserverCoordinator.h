@@ -10,6 +10,7 @@
 #include <react/renderer/imagemanager/ImageResponse.h>
 #include <react/renderer/imagemanager/ImageResponseObserver.h>
 
+#include <functional>
 #include <mutex>
 #include <vector>
 
@@ -35,6 +36,16 @@ class ImageResponseObserverCoordinator {
    */
   void removeObserver(const ImageResponseObserver& observer) const;
 
+  /*
+   * Sets a function which is called with `false` when the last observer is
+   * removed while the image is loading, and with `true` when an observer is
+   * added again. Image loaders may use it to cancel (and resume) loads which
+   * nobody waits for. Called outside of the lock, on the thread which adds or
+   * removes the observer.
+   */
+  void setObservationCallback(
+      std::function<void(bool isObserved)> observationCallback) const;
+
   /*
    * Platform-specific image loader will call this method with progress updates.
    */
@@ -86,6 +97,12 @@ class ImageResponseObserverCoordinator {
    */
   mutable std::shared_ptr<void> imageErrorData_;
 
+  /*
+   * Called when the response stops or starts being observed while loading.
+   * Mutable: protected by mutex_.
+   */
+  mutable std::function<void(bool isObserved)> observationCallback_;
+
   /*
    * Observer and data mutex.
    */
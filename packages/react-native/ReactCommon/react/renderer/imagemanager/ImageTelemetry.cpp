@@ -17,4 +17,31 @@ TelemetryTimePoint ImageTelemetry::getWillRequestUrlTime() const {
   return willRequestUrlTime_;
 }
 
+void ImageTelemetry::didCompleteRequest(
+    ResponseSource responseSource,
+    TelemetryTimePoint didLoadTime,
+    TelemetryTimePoint didDecodeTime,
+    size_t imageByteSize) {
+  responseSource_ = responseSource;
+  didLoadTime_ = didLoadTime;
+  didDecodeTime_ = didDecodeTime;
+  imageByteSize_ = imageByteSize;
+}
+
+TelemetryTimePoint ImageTelemetry::getDidLoadTime() const {
+  return didLoadTime_;
+}
+
+TelemetryTimePoint ImageTelemetry::getDidDecodeTime() const {
+  return didDecodeTime_;
+}
+
+ImageTelemetry::ResponseSource ImageTelemetry::getResponseSource() const {
+  return responseSource_;
+}
+
+size_t ImageTelemetry::getImageByteSize() const {
+  return imageByteSize_;
+}
+
 } // namespace facebook::react
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/utils/Telemetry.h>
 
@@ -18,16 +20,60 @@ namespace facebook::react {
  */
 class ImageTelemetry final {
  public:
+  /*
+   * Describes where the image of a completed request came from.
+   */
+  enum class ResponseSource {
+    Unknown, // The request isn't completed or the loader doesn't report it.
+    Loader, // The request loaded and decoded the image.
+    SharedRequest, // The request waited for another request of the same image.
+    MemoryCache, // The image was already decoded.
+  };
+
   ImageTelemetry(const SurfaceId surfaceId) : surfaceId_(surfaceId) {
     willRequestUrlTime_ = telemetryTimePointNow();
   }
 
+  /*
+   * Records the completion of the request. Image managers call this before
+   * notifying observers about the response, so it's safe to read the values
+   * below when a response is received.
+   */
+  void didCompleteRequest(
+      ResponseSource responseSource,
+      TelemetryTimePoint didLoadTime,
+      TelemetryTimePoint didDecodeTime,
+      size_t imageByteSize);
+
   TelemetryTimePoint getWillRequestUrlTime() const;
 
+  /*
+   * Time at which the encoded image was received, or
+   * `kTelemetryUndefinedTimePoint` if it wasn't reported.
+   */
+  TelemetryTimePoint getDidLoadTime() const;
+
+  /*
+   * Time at which the image was decoded and ready to be displayed, or
+   * `kTelemetryUndefinedTimePoint` if it wasn't reported.
+   */
+  TelemetryTimePoint getDidDecodeTime() const;
+
+  ResponseSource getResponseSource() const;
+
+  /*
+   * Number of bytes the decoded image takes in memory.
+   */
+  size_t getImageByteSize() const;
+
   SurfaceId getSurfaceId() const;
 
  private:
   TelemetryTimePoint willRequestUrlTime_;
+  TelemetryTimePoint didLoadTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint didDecodeTime_{kTelemetryUndefinedTimePoint};
+  ResponseSource responseSource_{ResponseSource::Unknown};
+  size_t imageByteSize_{0};
 
   const SurfaceId surfaceId_;
 };
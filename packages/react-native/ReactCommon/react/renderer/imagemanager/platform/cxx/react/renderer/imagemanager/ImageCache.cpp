@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageCache.h"
+
+namespace facebook::react {
+
+ImageCache::ImageCache(size_t byteLimit) : byteLimit_(byteLimit) {}
+
+std::optional<LoadedImage> ImageCache::get(const std::string& key) const {
+  std::scoped_lock lock(mutex_);
+  auto iterator = index_.find(key);
+  if (iterator == index_.end()) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, iterator->second);
+  return iterator->second->second;
+}
+
+void ImageCache::put(const std::string& key, LoadedImage image) const {
+  if (image.byteSize > byteLimit_) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+  auto iterator = index_.find(key);
+  if (iterator != index_.end()) {
+    byteSize_ -= iterator->second->second.byteSize;
+    entries_.erase(iterator->second);
+    index_.erase(iterator);
+  }
+
+  evict(byteLimit_ - image.byteSize);
+  byteSize_ += image.byteSize;
+  entries_.emplace_front(key, std::move(image));
+  index_.emplace(key, entries_.begin());
+}
+
+size_t ImageCache::getByteSize() const {
+  std::scoped_lock lock(mutex_);
+  return byteSize_;
+}
+
+void ImageCache::clear() const {
+  std::scoped_lock lock(mutex_);
+  evict(0);
+}
+
+void ImageCache::evict(size_t byteLimit) const {
+  while (byteSize_ > byteLimit && !entries_.empty()) {
+    auto& entry = entries_.back();
+    byteSize_ -= entry.second.byteSize;
+    index_.erase(entry.first);
+    entries_.pop_back();
+  }
+}
+
+} // namespace facebook::react
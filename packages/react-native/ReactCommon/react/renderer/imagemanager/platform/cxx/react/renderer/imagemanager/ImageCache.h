@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <react/renderer/imagemanager/ImageLoader.h>
+
+namespace facebook::react {
+
+/*
+ * Thread-safe memory cache of decoded images, which evicts the least recently
+ * used images when their total `byteSize` exceeds `byteLimit`. Images larger
+ * than the limit are never cached.
+ */
+class ImageCache final {
+ public:
+  explicit ImageCache(size_t byteLimit);
+
+  /*
+   * Returns the image stored for `key` and marks it as the most recently
+   * used one.
+   */
+  std::optional<LoadedImage> get(const std::string& key) const;
+
+  /*
+   * Stores `image` for `key`, replacing a previous image for the same key.
+   */
+  void put(const std::string& key, LoadedImage image) const;
+
+  /*
+   * Returns the total size of the cached images.
+   */
+  size_t getByteSize() const;
+
+  void clear() const;
+
+ private:
+  using Entry = std::pair<std::string, LoadedImage>;
+
+  void evict(size_t byteLimit) const;
+
+  const size_t byteLimit_;
+
+  /*
+   * Mutable: protected by mutex_.
+   * Sorted from the most to the least recently used entry.
+   */
+  mutable std::list<Entry> entries_;
+  mutable std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  mutable size_t byteSize_{0};
+
+  mutable std::mutex mutex_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageLoader.h"
+
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+namespace facebook::react {
+
+std::optional<LoadedImage> ImageLoader::decode(
+    const ImageSource& /*imageSource*/,
+    std::string data,
+    ImageErrorInfo& /*errorInfo*/) const {
+  auto byteSize = data.size();
+  return LoadedImage{
+      std::make_shared<std::string>(std::move(data)), nullptr, byteSize};
+}
+
+FileSystemImageLoader::FileSystemImageLoader(std::string rootPath)
+    : rootPath_(std::move(rootPath)) {}
+
+std::optional<std::string> FileSystemImageLoader::load(
+    const ImageSource& imageSource,
+    ImageErrorInfo& errorInfo) const {
+  constexpr std::string_view kFileScheme = "file://";
+
+  auto path = std::string_view{imageSource.uri};
+  if (path.substr(0, kFileScheme.size()) == kFileScheme) {
+    path.remove_prefix(kFileScheme.size());
+  } else if (path.find("://") != std::string_view::npos) {
+    errorInfo.error = "Unsupported URL: " + imageSource.uri;
+    return std::nullopt;
+  }
+
+  if (path.empty()) {
+    errorInfo.error = "Image source has no URI";
+    return std::nullopt;
+  }
+
+  auto resolvedPath = std::string{};
+  if (path.front() != '/' && !rootPath_.empty()) {
+    resolvedPath = rootPath_;
+    if (resolvedPath.back() != '/') {
+      resolvedPath += '/';
+    }
+  }
+  resolvedPath += path;
+
+  auto file = std::ifstream(resolvedPath, std::ios::binary);
+  if (!file) {
+    errorInfo.error = "Could not open " + resolvedPath;
+    return std::nullopt;
+  }
+
+  auto data = std::string{
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  if (file.bad()) {
+    errorInfo.error = "Could not read " + resolvedPath;
+    return std::nullopt;
+  }
+  return data;
+}
+
+} // namespace facebook::react
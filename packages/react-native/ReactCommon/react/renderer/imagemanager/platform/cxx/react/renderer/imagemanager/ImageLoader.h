@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <react/renderer/imagemanager/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * A decoded image and the number of bytes it takes in memory, which counts
+ * towards the budget of the image cache.
+ */
+struct LoadedImage {
+  std::shared_ptr<void> image{};
+  std::shared_ptr<void> metadata{};
+  size_t byteSize{0};
+};
+
+/*
+ * Loads and decodes images for the cxx `ImageManager`.
+ * Both methods are called on the worker threads of the image manager and may
+ * block; implementations must be thread-safe.
+ * Register an instance in the `ContextContainer` under the "ImageLoader" key
+ * (as `std::shared_ptr<const ImageLoader>`) to enable image loading.
+ */
+class ImageLoader {
+ public:
+  virtual ~ImageLoader() = default;
+
+  /*
+   * Returns the encoded data of `imageSource`, or `std::nullopt` after
+   * filling `errorInfo` if it can't be loaded.
+   */
+  virtual std::optional<std::string> load(
+      const ImageSource& imageSource,
+      ImageErrorInfo& errorInfo) const = 0;
+
+  /*
+   * Decodes `data` into an image, or returns `std::nullopt` after filling
+   * `errorInfo` if it isn't a supported image.
+   * The default implementation keeps the encoded data (as a `std::string`)
+   * as the image, which is enough for headless rendering.
+   */
+  virtual std::optional<LoadedImage> decode(
+      const ImageSource& imageSource,
+      std::string data,
+      ImageErrorInfo& errorInfo) const;
+};
+
+/*
+ * Loads images from the local file system. Accepts absolute paths, `file://`
+ * URLs, and paths relative to `rootPath` (if not empty).
+ */
+class FileSystemImageLoader : public ImageLoader {
+ public:
+  explicit FileSystemImageLoader(std::string rootPath = {});
+
+  std::optional<std::string> load(
+      const ImageSource& imageSource,
+      ImageErrorInfo& errorInfo) const override;
+
+ private:
+  std::string rootPath_;
+};
+
+} // namespace facebook::react
@@ -7,24 +7,41 @@
 
 #include "ImageManager.h"
 
+#include <react/renderer/imagemanager/ImagePipeline.h>
+
 namespace facebook::react {
 
-ImageManager::ImageManager(
-    const ContextContainer::Shared& /*contextContainer*/) {
-  // Silence unused-private-field warning.
-  (void)self_;
-  // Not implemented.
+/*
+ * Images are only loaded if the `ContextContainer` provides an `ImageLoader`
+ * (see `ImageLoader.h`); otherwise requests never complete, leaving image
+ * loading to the host platform.
+ */
+ImageManager::ImageManager(const ContextContainer::Shared& contextContainer) {
+  using SharedImageLoader = std::shared_ptr<const ImageLoader>;
+  auto imageLoader = SharedImageLoader{};
+  if (contextContainer) {
+    imageLoader = contextContainer->find<SharedImageLoader>("ImageLoader")
+                      .value_or(nullptr);
+  }
+  if (imageLoader) {
+    self_ = new std::shared_ptr<ImagePipeline>(
+        std::make_shared<ImagePipeline>(std::move(imageLoader)));
+  }
 }
 
 ImageManager::~ImageManager() {
-  // Not implemented.
+  delete static_cast<std::shared_ptr<ImagePipeline>*>(self_);
+  self_ = nullptr;
 }
 
 ImageRequest ImageManager::requestImage(
     const ImageSource& imageSource,
-    SurfaceId /*surfaceId*/) const {
-  // Not implemented.
-  return {imageSource, nullptr, {}};
+    SurfaceId surfaceId) const {
+  if (self_ == nullptr) {
+    return {imageSource, nullptr, {}};
+  }
+  auto& pipeline = *static_cast<std::shared_ptr<ImagePipeline>*>(self_);
+  return pipeline->requestImage(imageSource, surfaceId);
 }
 
 } // namespace facebook::react
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImagePipeline.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook::react {
+
+struct ImagePipeline::Load {
+  Load(std::string key, ImageSource imageSource)
+      : key(std::move(key)), imageSource(std::move(imageSource)) {}
+
+  const std::string key;
+  const ImageSource imageSource;
+
+  /*
+   * Owned by the requests sharing the load; once they are all gone, nobody
+   * can observe the response and the load is skipped.
+   */
+  std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+
+  /*
+   * Telemetry of every request sharing the load, filled in on completion.
+   * Protected by `ImagePipeline::mutex_`.
+   */
+  std::vector<std::pair<
+      std::shared_ptr<ImageTelemetry>,
+      ImageTelemetry::ResponseSource>>
+      telemetries;
+
+  /*
+   * Protected by `ImagePipeline::mutex_`.
+   */
+  bool isCanceled{false};
+  bool isQueued{false};
+};
+
+ImagePipeline::ImagePipeline(
+    std::shared_ptr<const ImageLoader> imageLoader,
+    size_t cacheByteLimit,
+    size_t workerCount)
+    : imageLoader_(std::move(imageLoader)), cache_(cacheByteLimit) {
+  workers_.reserve(workerCount);
+  for (size_t index = 0; index < std::max(workerCount, size_t{1}); index++) {
+    workers_.emplace_back([this]() { runWorker(); });
+  }
+}
+
+ImagePipeline::~ImagePipeline() {
+  {
+    std::scoped_lock lock(mutex_);
+    isStopping_ = true;
+  }
+  queueCondition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t ImagePipeline::getDefaultWorkerCount() {
+  return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+}
+
+const ImageCache& ImagePipeline::getCache() const {
+  return cache_;
+}
+
+ImageRequest ImagePipeline::requestImage(
+    const ImageSource& imageSource,
+    SurfaceId surfaceId) {
+  SystraceSection s("ImagePipeline::requestImage");
+
+  auto telemetry = std::make_shared<ImageTelemetry>(surfaceId);
+  const auto& key = imageSource.uri;
+
+  std::unique_lock lock(mutex_);
+
+  if (auto cachedImage = cache_.get(key)) {
+    lock.unlock();
+    auto request = ImageRequest{imageSource, telemetry, {}};
+    auto now = telemetryTimePointNow();
+    telemetry->didCompleteRequest(
+        ImageTelemetry::ResponseSource::MemoryCache,
+        now,
+        now,
+        cachedImage->byteSize);
+    request.getObserverCoordinator().nativeImageResponseComplete(
+        ImageResponse{cachedImage->image, cachedImage->metadata});
+    return request;
+  }
+
+  if (auto iterator = inFlightLoads_.find(key);
+      iterator != inFlightLoads_.end()) {
+    auto& load = iterator->second;
+    if (auto coordinator = load->coordinator.lock()) {
+      load->telemetries.emplace_back(
+          telemetry, ImageTelemetry::ResponseSource::SharedRequest);
+      return ImageRequest{imageSource, telemetry, std::move(coordinator), {}};
+    }
+  }
+
+  auto load = std::make_shared<Load>(key, imageSource);
+  auto request = ImageRequest{imageSource, telemetry, {}};
+  const auto& coordinator = request.getSharedObserverCoordinator();
+  load->coordinator = coordinator;
+  load->telemetries.emplace_back(
+      telemetry, ImageTelemetry::ResponseSource::Loader);
+  inFlightLoads_[key] = load;
+  enqueue(load);
+  lock.unlock();
+
+  // The coordinator owns the load (which only references the coordinator
+  // weakly), so a canceled load can be resumed.
+  coordinator->setObservationCallback(
+      [weakPipeline = weak_from_this(), load](bool isObserved) {
+        auto pipeline = weakPipeline.lock();
+        if (!pipeline) {
+          return;
+        }
+        if (isObserved) {
+          pipeline->resume(load);
+        } else {
+          pipeline->cancel(load);
+        }
+      });
+
+  queueCondition_.notify_one();
+  return request;
+}
+
+void ImagePipeline::cancel(const std::shared_ptr<Load>& load) {
+  std::scoped_lock lock(mutex_);
+  load->isCanceled = true;
+  auto iterator = inFlightLoads_.find(load->key);
+  if (iterator != inFlightLoads_.end() && iterator->second == load) {
+    inFlightLoads_.erase(iterator);
+  }
+}
+
+void ImagePipeline::resume(const std::shared_ptr<Load>& load) {
+  {
+    std::scoped_lock lock(mutex_);
+    if (!load->isCanceled) {
+      return;
+    }
+    load->isCanceled = false;
+    // Requests made in the meantime started another load, which can't be
+    // merged with this one.
+    inFlightLoads_.try_emplace(load->key, load);
+    if (load->isQueued) {
+      return;
+    }
+    enqueue(load);
+  }
+  queueCondition_.notify_one();
+}
+
+void ImagePipeline::enqueue(const std::shared_ptr<Load>& load) {
+  load->isQueued = true;
+  queue_.push_back(load);
+}
+
+void ImagePipeline::runWorker() {
+  while (true) {
+    auto load = std::shared_ptr<Load>{};
+    {
+      std::unique_lock lock(mutex_);
+      queueCondition_.wait(
+          lock, [this]() { return isStopping_ || !queue_.empty(); });
+      if (isStopping_) {
+        return;
+      }
+      load = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    perform(load);
+  }
+}
+
+void ImagePipeline::perform(const std::shared_ptr<Load>& load) {
+  SystraceSection s("ImagePipeline::perform");
+
+  auto coordinator = load->coordinator.lock();
+  auto shouldSkip = [&]() {
+    std::scoped_lock lock(mutex_);
+    if (!load->isCanceled && coordinator) {
+      return false;
+    }
+    load->isQueued = false;
+    auto iterator = inFlightLoads_.find(load->key);
+    if (!coordinator && iterator != inFlightLoads_.end() &&
+        iterator->second == load) {
+      inFlightLoads_.erase(iterator);
+    }
+    return true;
+  };
+
+  if (shouldSkip()) {
+    return;
+  }
+
+  // A canceled and resumed load may find the image it loaded before.
+  auto image = cache_.get(load->key);
+  auto errorInfo = ImageErrorInfo{};
+  auto didLoadTime = telemetryTimePointNow();
+  auto didDecodeTime = didLoadTime;
+
+  if (!image) {
+    auto data = imageLoader_->load(load->imageSource, errorInfo);
+    didLoadTime = telemetryTimePointNow();
+    if (data && !shouldSkip()) {
+      image = imageLoader_->decode(
+          load->imageSource, std::move(*data), errorInfo);
+    } else if (data) {
+      return;
+    }
+    didDecodeTime = telemetryTimePointNow();
+    if (image) {
+      cache_.put(load->key, *image);
+    }
+  }
+
+  decltype(load->telemetries) telemetries;
+  {
+    std::scoped_lock lock(mutex_);
+    load->isQueued = false;
+    if (load->isCanceled) {
+      return;
+    }
+    auto iterator = inFlightLoads_.find(load->key);
+    if (iterator != inFlightLoads_.end() && iterator->second == load) {
+      inFlightLoads_.erase(iterator);
+    }
+    telemetries = std::move(load->telemetries);
+  }
+
+  auto imageByteSize = image ? image->byteSize : 0;
+  for (auto& [telemetry, responseSource] : telemetries) {
+    telemetry->didCompleteRequest(
+        responseSource, didLoadTime, didDecodeTime, imageByteSize);
+  }
+
+  if (image) {
+    coordinator->nativeImageResponseComplete(
+        ImageResponse{image->image, image->metadata});
+  } else {
+    coordinator->nativeImageResponseFailed(
+        ImageLoadError{std::make_shared<ImageErrorInfo>(errorInfo)});
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/imagemanager/ImageCache.h>
+#include <react/renderer/imagemanager/ImageLoader.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+
+namespace facebook::react {
+
+/*
+ * Default budget of the memory cache of decoded images.
+ */
+constexpr size_t kDefaultImageCacheByteLimit = 64 * 1024 * 1024;
+
+/*
+ * Loads images for the cxx `ImageManager`:
+ * - Images are loaded and decoded by an `ImageLoader` on a fixed number of
+ *   worker threads.
+ * - Decoded images are kept in an `ImageCache`, so requesting a loaded image
+ *   completes immediately.
+ * - Requests for an image which is already loading share the load and the
+ *   observer coordinator of the first request.
+ * - A load is canceled when the last observer of its response is removed,
+ *   and resumed if an observer is added again.
+ * Must be owned by a `std::shared_ptr`.
+ */
+class ImagePipeline final : public std::enable_shared_from_this<ImagePipeline> {
+ public:
+  ImagePipeline(
+      std::shared_ptr<const ImageLoader> imageLoader,
+      size_t cacheByteLimit = kDefaultImageCacheByteLimit,
+      size_t workerCount = getDefaultWorkerCount());
+
+  /*
+   * Stops the worker threads, abandoning loads which didn't start yet.
+   */
+  ~ImagePipeline();
+
+  ImagePipeline(const ImagePipeline& other) = delete;
+  ImagePipeline& operator=(const ImagePipeline& other) = delete;
+
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      SurfaceId surfaceId);
+
+  const ImageCache& getCache() const;
+
+  /*
+   * Half of the hardware threads, between 1 and 4.
+   */
+  static size_t getDefaultWorkerCount();
+
+ private:
+  struct Load;
+
+  void cancel(const std::shared_ptr<Load>& load);
+  void resume(const std::shared_ptr<Load>& load);
+  void enqueue(const std::shared_ptr<Load>& load);
+  void runWorker();
+  void perform(const std::shared_ptr<Load>& load);
+
+  const std::shared_ptr<const ImageLoader> imageLoader_;
+  const ImageCache cache_;
+
+  /*
+   * Loads by the URI of their image which may still be joined.
+   * Protected by mutex_.
+   */
+  std::unordered_map<std::string, std::shared_ptr<Load>> inFlightLoads_;
+
+  /*
+   * Loads waiting for a worker.
+   * Protected by mutex_.
+   */
+  std::deque<std::shared_ptr<Load>> queue_;
+  bool isStopping_{false};
+
+  std::mutex mutex_;
+  std::condition_variable queueCondition_;
+  std::vector<std::thread> workers_;
+};
+
+} // namespace facebook::react
@@ -5,14 +5,285 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
 #include <react/renderer/imagemanager/ImageManager.h>
+#include <react/renderer/imagemanager/ImagePipeline.h>
 
 using namespace facebook::react;
 
-TEST(ImageManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+/*
+ * Loads the URI of the image source as its data, optionally waiting until
+ * it's unblocked.
+ */
+class TestImageLoader : public ImageLoader {
+ public:
+  std::optional<std::string> load(
+      const ImageSource& imageSource,
+      ImageErrorInfo& errorInfo) const override {
+    std::unique_lock lock(mutex_);
+    loadCount_++;
+    condition_.wait(lock, [this]() { return !isBlocked_; });
+    if (imageSource.uri.rfind("missing", 0) == 0) {
+      errorInfo.error = "Not found";
+      return std::nullopt;
+    }
+    return imageSource.uri;
+  }
+
+  void setBlocked(bool isBlocked) {
+    {
+      std::scoped_lock lock(mutex_);
+      isBlocked_ = isBlocked;
+    }
+    condition_.notify_all();
+  }
+
+  int getLoadCount() const {
+    std::scoped_lock lock(mutex_);
+    return loadCount_;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable int loadCount_{0};
+  bool isBlocked_{false};
+};
+
+class TestImageResponseObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& imageResponse) const override {
+    std::scoped_lock lock(mutex_);
+    image_ = std::static_pointer_cast<std::string>(imageResponse.getImage());
+    status_ = ImageResponse::Status::Completed;
+    condition_.notify_all();
+  }
+
+  void didReceiveFailure(const ImageLoadError& error) const override {
+    std::scoped_lock lock(mutex_);
+    error_ = std::static_pointer_cast<ImageErrorInfo>(error.getError());
+    status_ = ImageResponse::Status::Failed;
+    condition_.notify_all();
+  }
+
+  ImageResponse::Status waitForResponse() const {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [this]() {
+      return status_ != ImageResponse::Status::Loading;
+    });
+    return status_;
+  }
+
+  std::shared_ptr<std::string> getImage() const {
+    std::scoped_lock lock(mutex_);
+    return image_;
+  }
+
+  std::shared_ptr<ImageErrorInfo> getError() const {
+    std::scoped_lock lock(mutex_);
+    return error_;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable ImageResponse::Status status_{ImageResponse::Status::Loading};
+  mutable std::shared_ptr<std::string> image_;
+  mutable std::shared_ptr<ImageErrorInfo> error_;
+};
+
+ImageSource makeImageSource(std::string uri) {
+  auto imageSource = ImageSource{};
+  imageSource.type = ImageSource::Type::Local;
+  imageSource.uri = std::move(uri);
+  return imageSource;
+}
+
+} // namespace
+
+TEST(ImageManagerTest, requestsWithoutImageLoaderNeverComplete) {
+  auto imageManager =
+      ImageManager{std::make_shared<const ContextContainer>()};
+  auto request = imageManager.requestImage(makeImageSource("a.png"), 1);
+  EXPECT_EQ(request.getSharedTelemetry(), nullptr);
+}
+
+TEST(ImageManagerTest, loadsImagesWithLoaderOfContextContainer) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      "ImageLoader",
+      std::shared_ptr<const ImageLoader>{std::make_shared<TestImageLoader>()});
+  auto imageManager = ImageManager{contextContainer};
+
+  auto request = imageManager.requestImage(makeImageSource("a.png"), 1);
+  auto observer = TestImageResponseObserver{};
+  request.getObserverCoordinator().addObserver(observer);
+  EXPECT_EQ(observer.waitForResponse(), ImageResponse::Status::Completed);
+  EXPECT_EQ(*observer.getImage(), "a.png");
+  request.getObserverCoordinator().removeObserver(observer);
+}
+
+TEST(ImageManagerTest, deduplicatesRequestsOfTheSameImage) {
+  auto imageLoader = std::make_shared<TestImageLoader>();
+  imageLoader->setBlocked(true);
+  auto pipeline = std::make_shared<ImagePipeline>(imageLoader);
+
+  auto requests = std::vector<ImageRequest>{};
+  for (auto surfaceId = 0; surfaceId < 10; surfaceId++) {
+    requests.push_back(
+        pipeline->requestImage(makeImageSource("a.png"), surfaceId));
+  }
+  for (const auto& request : requests) {
+    EXPECT_EQ(
+        request.getSharedObserverCoordinator(),
+        requests.front().getSharedObserverCoordinator());
+  }
+
+  auto observer = TestImageResponseObserver{};
+  requests.back().getObserverCoordinator().addObserver(observer);
+  imageLoader->setBlocked(false);
+  EXPECT_EQ(observer.waitForResponse(), ImageResponse::Status::Completed);
+  EXPECT_EQ(imageLoader->getLoadCount(), 1);
+
+  EXPECT_EQ(
+      requests.front().getSharedTelemetry()->getResponseSource(),
+      ImageTelemetry::ResponseSource::Loader);
+  EXPECT_EQ(
+      requests.back().getSharedTelemetry()->getResponseSource(),
+      ImageTelemetry::ResponseSource::SharedRequest);
+  EXPECT_EQ(requests.back().getSharedTelemetry()->getImageByteSize(), 5);
+  EXPECT_NE(
+      requests.back().getSharedTelemetry()->getDidDecodeTime(),
+      kTelemetryUndefinedTimePoint);
+  requests.back().getObserverCoordinator().removeObserver(observer);
+}
+
+TEST(ImageManagerTest, completesRequestsOfCachedImagesImmediately) {
+  auto imageLoader = std::make_shared<TestImageLoader>();
+  auto pipeline = std::make_shared<ImagePipeline>(imageLoader);
+
+  auto firstRequest = pipeline->requestImage(makeImageSource("a.png"), 1);
+  auto firstObserver = TestImageResponseObserver{};
+  firstRequest.getObserverCoordinator().addObserver(firstObserver);
+  firstObserver.waitForResponse();
+  EXPECT_EQ(pipeline->getCache().getByteSize(), 5);
+
+  auto request = pipeline->requestImage(makeImageSource("a.png"), 1);
+  auto observer = TestImageResponseObserver{};
+  request.getObserverCoordinator().addObserver(observer);
+  EXPECT_EQ(*observer.getImage(), "a.png");
+  EXPECT_EQ(imageLoader->getLoadCount(), 1);
+  EXPECT_EQ(
+      request.getSharedTelemetry()->getResponseSource(),
+      ImageTelemetry::ResponseSource::MemoryCache);
+}
+
+TEST(ImageManagerTest, cancelsLoadsWhenLastObserverLeaves) {
+  auto imageLoader = std::make_shared<TestImageLoader>();
+  imageLoader->setBlocked(true);
+  auto pipeline = std::make_shared<ImagePipeline>(
+      imageLoader, kDefaultImageCacheByteLimit, 1);
+
+  // Occupies the only worker until the loader is unblocked.
+  auto blockingRequest = pipeline->requestImage(makeImageSource("a.png"), 1);
+  auto blockingObserver = TestImageResponseObserver{};
+  blockingRequest.getObserverCoordinator().addObserver(blockingObserver);
+
+  auto request = pipeline->requestImage(makeImageSource("b.png"), 1);
+  auto observer = TestImageResponseObserver{};
+  request.getObserverCoordinator().addObserver(observer);
+  request.getObserverCoordinator().removeObserver(observer);
+
+  imageLoader->setBlocked(false);
+  blockingObserver.waitForResponse();
+
+  // A new request doesn't join the canceled load.
+  auto otherRequest = pipeline->requestImage(makeImageSource("b.png"), 1);
+  EXPECT_NE(
+      otherRequest.getSharedObserverCoordinator(),
+      request.getSharedObserverCoordinator());
+  auto otherObserver = TestImageResponseObserver{};
+  otherRequest.getObserverCoordinator().addObserver(otherObserver);
+  otherObserver.waitForResponse();
+
+  // Observing the canceled load again resumes it.
+  request.getObserverCoordinator().addObserver(observer);
+  EXPECT_EQ(observer.waitForResponse(), ImageResponse::Status::Completed);
+  EXPECT_EQ(imageLoader->getLoadCount(), 2);
+
+  blockingRequest.getObserverCoordinator().removeObserver(blockingObserver);
+  otherRequest.getObserverCoordinator().removeObserver(otherObserver);
+  request.getObserverCoordinator().removeObserver(observer);
+}
+
+TEST(ImageManagerTest, reportsFailuresWithoutCachingThem) {
+  auto imageLoader = std::make_shared<TestImageLoader>();
+  auto pipeline = std::make_shared<ImagePipeline>(imageLoader);
+
+  for (auto attempt = 1; attempt <= 2; attempt++) {
+    auto request = pipeline->requestImage(makeImageSource("missing.png"), 1);
+    auto observer = TestImageResponseObserver{};
+    request.getObserverCoordinator().addObserver(observer);
+    EXPECT_EQ(observer.waitForResponse(), ImageResponse::Status::Failed);
+    EXPECT_EQ(observer.getError()->error, "Not found");
+    EXPECT_EQ(imageLoader->getLoadCount(), attempt);
+  }
+}
+
+TEST(ImageManagerTest, imageCacheEvictsLeastRecentlyUsedImages) {
+  auto cache = ImageCache{100};
+  cache.put("a", LoadedImage{nullptr, nullptr, 40});
+  cache.put("b", LoadedImage{nullptr, nullptr, 40});
+  EXPECT_TRUE(cache.get("a").has_value());
+
+  cache.put("c", LoadedImage{nullptr, nullptr, 40});
+  EXPECT_TRUE(cache.get("a").has_value());
+  EXPECT_FALSE(cache.get("b").has_value());
+  EXPECT_TRUE(cache.get("c").has_value());
+  EXPECT_EQ(cache.getByteSize(), 80);
+
+  // Images over the budget aren't cached.
+  cache.put("d", LoadedImage{nullptr, nullptr, 101});
+  EXPECT_FALSE(cache.get("d").has_value());
+  EXPECT_EQ(cache.getByteSize(), 80);
+}
+
+TEST(ImageManagerTest, fileSystemImageLoaderReadsFiles) {
+  auto directory = std::string{testing::TempDir()};
+  auto path = directory + "/ImageManagerTest.png";
+  std::ofstream(path, std::ios::binary) << "image";
+
+  auto errorInfo = ImageErrorInfo{};
+  auto imageLoader = FileSystemImageLoader{directory};
+  EXPECT_EQ(imageLoader.load(makeImageSource(path), errorInfo), "image");
+  EXPECT_EQ(
+      imageLoader.load(makeImageSource("file://" + path), errorInfo), "image");
+  EXPECT_EQ(
+      imageLoader.load(makeImageSource("ImageManagerTest.png"), errorInfo),
+      "image");
+
+  EXPECT_EQ(
+      imageLoader.load(makeImageSource("https://example.com/a.png"), errorInfo),
+      std::nullopt);
+  EXPECT_FALSE(errorInfo.error.empty());
+  EXPECT_EQ(
+      imageLoader.load(makeImageSource("missing.png"), errorInfo),
+      std::nullopt);
+
+  std::remove(path.c_str());
 }
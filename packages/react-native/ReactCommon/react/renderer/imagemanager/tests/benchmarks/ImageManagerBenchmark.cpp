@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/imagemanager/ImagePipeline.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+static constexpr size_t kCellCount = 1000;
+static constexpr size_t kImageCount = 50;
+static constexpr size_t kImageByteSize = 16 * 1024;
+
+/*
+ * Writes the images shown by the list to a temporary directory once.
+ */
+static const std::filesystem::path& imageDirectory() {
+  static const auto directory = []() {
+    auto directory = std::filesystem::temp_directory_path() /
+        "ImageManagerBenchmark";
+    std::filesystem::create_directories(directory);
+    for (size_t index = 0; index < kImageCount; index++) {
+      auto file = std::ofstream(
+          directory / (std::to_string(index) + ".png"), std::ios::binary);
+      file << std::string(kImageByteSize, static_cast<char>(index));
+    }
+    return directory;
+  }();
+  return directory;
+}
+
+class CountingImageLoader : public FileSystemImageLoader {
+ public:
+  using FileSystemImageLoader::FileSystemImageLoader;
+
+  std::optional<std::string> load(
+      const ImageSource& imageSource,
+      ImageErrorInfo& errorInfo) const override {
+    loadCount++;
+    return FileSystemImageLoader::load(imageSource, errorInfo);
+  }
+
+  mutable std::atomic<size_t> loadCount{0};
+};
+
+/*
+ * Counts down the cells waiting for their image.
+ */
+class CellObserver : public ImageResponseObserver {
+ public:
+  struct Latch {
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t remainingCount{0};
+
+    void countDown() {
+      std::scoped_lock lock(mutex);
+      if (--remainingCount == 0) {
+        condition.notify_all();
+      }
+    }
+
+    void wait() {
+      std::unique_lock lock(mutex);
+      condition.wait(lock, [this]() { return remainingCount == 0; });
+    }
+  };
+
+  explicit CellObserver(Latch& latch) : latch_(latch) {}
+
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    latch_.countDown();
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {
+    latch_.countDown();
+  }
+
+ private:
+  Latch& latch_;
+};
+
+/*
+ * Requests the images of every cell of a list and waits until they are all
+ * displayed, like mounting a list of `kCellCount` cells showing
+ * `kImageCount` distinct images.
+ */
+static void displayList(ImagePipeline& pipeline) {
+  auto latch = CellObserver::Latch{};
+  latch.remainingCount = kCellCount;
+  auto observers = std::vector<CellObserver>(kCellCount, CellObserver{latch});
+  auto requests = std::vector<ImageRequest>{};
+  requests.reserve(kCellCount);
+
+  for (size_t index = 0; index < kCellCount; index++) {
+    auto imageSource = ImageSource{};
+    imageSource.type = ImageSource::Type::Local;
+    imageSource.uri = std::to_string(index % kImageCount) + ".png";
+    requests.push_back(pipeline.requestImage(imageSource, 1));
+    requests.back().getObserverCoordinator().addObserver(observers[index]);
+  }
+
+  latch.wait();
+
+  for (size_t index = 0; index < kCellCount; index++) {
+    requests[index].getObserverCoordinator().removeObserver(observers[index]);
+  }
+}
+
+/*
+ * Every image is loaded from disk once, shared by the cells showing it.
+ */
+static void displayListWithColdCache(benchmark::State& state) {
+  auto imageLoader =
+      std::make_shared<CountingImageLoader>(imageDirectory().string());
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pipeline = std::make_shared<ImagePipeline>(imageLoader);
+    state.ResumeTiming();
+
+    displayList(*pipeline);
+
+    state.PauseTiming();
+    pipeline.reset();
+    state.ResumeTiming();
+  }
+
+  state.counters["loads_per_list"] = benchmark::Counter(
+      static_cast<double>(imageLoader->loadCount),
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(displayListWithColdCache)->UseRealTime();
+
+/*
+ * Every image comes from the memory cache.
+ */
+static void displayListWithWarmCache(benchmark::State& state) {
+  auto imageLoader =
+      std::make_shared<CountingImageLoader>(imageDirectory().string());
+  auto pipeline = std::make_shared<ImagePipeline>(imageLoader);
+  displayList(*pipeline);
+  imageLoader->loadCount = 0;
+
+  for (auto _ : state) {
+    displayList(*pipeline);
+  }
+
+  state.counters["loads_per_list"] = benchmark::Counter(
+      static_cast<double>(imageLoader->loadCount),
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(displayListWithWarmCache)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CommitPipeline.h"
+
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook::react {
+
+const CommitPipeline& CommitPipeline::shared() {
+  // Intentionally leaked to avoid joining the worker during static
+  // destruction.
+  static auto* pipeline = new CommitPipeline();
+  return *pipeline;
+}
+
+CommitPipeline::CommitPipeline() : thread_([this]() { loop(); }) {}
+
+CommitPipeline::~CommitPipeline() {
+  {
+    std::scoped_lock lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+void CommitPipeline::dispatch(std::function<void()>&& task) const {
+  {
+    std::scoped_lock lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void CommitPipeline::loop() {
+  while (true) {
+    auto task = std::function<void()>{};
+
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    SystraceSection s("CommitPipeline::task");
+    task();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace facebook::react {
+
+/*
+ * A dedicated worker thread that runs the second half of pipelined
+ * `ShadowTree` commits (layout, publishing of the new revision, layout events
+ * and diffing) off the thread that produced the new tree, which for React
+ * commits is the JavaScript thread.
+ * Tasks are executed one by one in the order they were dispatched.
+ */
+class CommitPipeline final {
+ public:
+  /*
+   * Returns the process-wide instance. The instance is never destroyed.
+   */
+  static const CommitPipeline& shared();
+
+  CommitPipeline();
+  ~CommitPipeline();
+
+  /*
+   * Not copyable, not movable.
+   */
+  CommitPipeline(const CommitPipeline& other) = delete;
+  CommitPipeline& operator=(const CommitPipeline& other) = delete;
+
+  /*
+   * Schedules `task` to be executed on the worker thread.
+   * Can be called from any thread.
+   */
+  void dispatch(std::function<void()>&& task) const;
+
+ private:
+  void loop();
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable std::deque<std::function<void()>> tasks_; // Protected by `mutex_`.
+  bool stopped_{false}; // Protected by `mutex_`.
+  std::thread thread_;
+};
+
+} // namespace facebook::react
@@ -6,6 +6,8 @@
  */
 
 #include "MountingCoordinator.h"
+#include "ReclamationQueue.h"
+#include "compactShadowViewMutations.h"
 #include "updateMountedFlag.h"
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
@@ -19,6 +21,7 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
@@ -44,6 +47,12 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
         !lastRevision_.has_value() || revision.number != lastRevision_->number);
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
+      if (lastRevision_.has_value() &&
+          CoreFeatures::enableDeferredReclamation) {
+        // The skipped revision is often the last owner of its nodes.
+        ReclamationQueue::shared().retire(
+            std::move(lastRevision_->rootShadowNode));
+      }
       lastRevision_ = std::move(revision);
     }
   }
@@ -51,6 +60,35 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
   signal_.notify_all();
 }
 
+void MountingCoordinator::precomputeMutations() const {
+  SystraceSection section("MountingCoordinator::precomputeMutations");
+
+  auto baseRootShadowNode = RootShadowNode::Shared{};
+  auto lastRootShadowNode = RootShadowNode::Shared{};
+
+  {
+    std::scoped_lock lock(mutex_);
+    if (!lastRevision_.has_value() || !baseRevision_.rootShadowNode) {
+      return;
+    }
+    baseRootShadowNode = baseRevision_.rootShadowNode;
+    lastRootShadowNode = lastRevision_->rootShadowNode;
+  }
+
+  auto mutations =
+      calculateShadowViewMutations(*baseRootShadowNode, *lastRootShadowNode);
+
+  std::scoped_lock lock(mutex_);
+  if (lastRevision_.has_value() &&
+      baseRevision_.rootShadowNode == baseRootShadowNode &&
+      lastRevision_->rootShadowNode == lastRootShadowNode) {
+    precomputedMutations_ = PrecomputedMutations{
+        std::move(baseRootShadowNode),
+        std::move(lastRootShadowNode),
+        std::move(mutations)};
+  }
+}
+
 void MountingCoordinator::revoke() const {
   std::scoped_lock lock(mutex_);
   // We have two goals here.
@@ -59,6 +97,7 @@ void MountingCoordinator::revoke() const {
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  precomputedMutations_.reset();
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -77,6 +116,7 @@ void MountingCoordinator::updateBaseRevision(
 void MountingCoordinator::resetLatestRevision() const {
   std::scoped_lock lock(mutex_);
   lastRevision_.reset();
+  precomputedMutations_.reset();
 }
 
 std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
@@ -92,8 +132,6 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
     number_++;
 
     if (ReactNativeFeatureFlags::fixMountedFlagAndFixPreallocationClone()) {
-      std::scoped_lock dispatchLock(EventEmitter::DispatchMutex());
-
       updateMountedFlag(
           baseRevision_.rootShadowNode->getChildren(),
           lastRevision_->rootShadowNode->getChildren());
@@ -103,8 +141,18 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
     telemetry.willDiff();
 
-    auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+    auto mutations = ShadowViewMutation::List{};
+    if (precomputedMutations_.has_value() &&
+        precomputedMutations_->baseRootShadowNode ==
+            baseRevision_.rootShadowNode &&
+        precomputedMutations_->lastRootShadowNode ==
+            lastRevision_->rootShadowNode) {
+      mutations = std::move(precomputedMutations_->mutations);
+    } else {
+      mutations = calculateShadowViewMutations(
+          *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+    }
+    precomputedMutations_.reset();
 
     telemetry.didDiff();
 
@@ -138,6 +186,19 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
     transaction = mountingOverrideDelegate->pullTransaction(
         surfaceId_, number_, telemetry, std::move(mutations));
+
+    // The delegate merges its own instructions (e.g. final frames of
+    // animations) with the diff, which often leaves views created and deleted
+    // or updated several times within the same transaction.
+    if (transaction.has_value() && CoreFeatures::enableMutationCompaction) {
+      auto number = transaction->getNumber();
+      auto transactionTelemetry = transaction->getTelemetry();
+      transaction = MountingTransaction{
+          surfaceId_,
+          number,
+          compactShadowViewMutations(std::move(*transaction).getMutations()),
+          transactionTelemetry};
+    }
   }
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
@@ -189,6 +250,12 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 #endif
 
   if (lastRevision_.has_value()) {
+    if (CoreFeatures::enableDeferredReclamation) {
+      // The mounted tree is replaced here; once it's gone from the screen
+      // this is usually the last reference to its nodes.
+      ReclamationQueue::shared().retire(
+          std::move(baseRevision_.rootShadowNode));
+    }
     baseRevision_ = std::move(*lastRevision_);
     lastRevision_.reset();
   }
@@ -100,6 +100,14 @@ class MountingCoordinator final {
 
   void push(ShadowTreeRevision revision) const;
 
+  /*
+   * Computes mutations between the base revision and the most recent one
+   * ahead of time, so a following `pullTransaction` call does not need to do
+   * it on the mounting thread. The result is discarded if any of the
+   * revisions changes in the meantime.
+   */
+  void precomputeMutations() const;
+
   /*
    * Revokes the last pushed `ShadowTreeRevision`.
    * Generating a `MountingTransaction` requires some resources which the
@@ -112,8 +120,8 @@ class MountingCoordinator final {
  private:
   const SurfaceId surfaceId_;
 
-  // Protects access to `baseRevision_`, `lastRevision_` and
-  // `mountingOverrideDelegate_`.
+  // Protects access to `baseRevision_`, `lastRevision_`,
+  // `mountingOverrideDelegate_` and `precomputedMutations_`.
   mutable std::mutex mutex_;
   mutable ShadowTreeRevision baseRevision_;
   mutable std::optional<ShadowTreeRevision> lastRevision_{};
@@ -122,6 +130,13 @@ class MountingCoordinator final {
   mutable std::weak_ptr<const MountingOverrideDelegate>
       mountingOverrideDelegate_;
 
+  struct PrecomputedMutations {
+    RootShadowNode::Shared baseRootShadowNode;
+    RootShadowNode::Shared lastRootShadowNode;
+    ShadowViewMutation::List mutations;
+  };
+  mutable std::optional<PrecomputedMutations> precomputedMutations_{};
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
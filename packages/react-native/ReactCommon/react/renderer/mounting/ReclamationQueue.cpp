@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ReclamationQueue.h"
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook::react {
+
+/*
+ * Counts `shadowNode` and the descendants which are freed together with it,
+ * i.e. the ones not shared with any other tree.
+ */
+static int countExclusivelyOwnedNodes(const ShadowNode& shadowNode) {
+  auto count = 1;
+  for (const auto& childNode : shadowNode.getChildren()) {
+    if (childNode.use_count() == 1) {
+      count += countExclusivelyOwnedNodes(*childNode);
+    }
+  }
+  return count;
+}
+
+static void lowerCurrentThreadPriority() {
+#if defined(__APPLE__)
+  pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined(__linux__)
+  // On Linux (and Android) niceness is a per-thread attribute.
+  setpriority(PRIO_PROCESS, 0, 10);
+#endif
+}
+
+const ReclamationQueue& ReclamationQueue::shared() {
+  // Intentionally leaked to avoid joining the worker during static
+  // destruction.
+  static auto* queue = new ReclamationQueue();
+  return *queue;
+}
+
+ReclamationQueue::ReclamationQueue(size_t capacity)
+    : capacity_(capacity), thread_([this]() { loop(); }) {}
+
+ReclamationQueue::~ReclamationQueue() {
+  {
+    std::scoped_lock lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+void ReclamationQueue::retire(RootShadowNode::Shared rootShadowNode) const {
+  if (rootShadowNode == nullptr) {
+    return;
+  }
+  enqueue(Retiree{std::move(rootShadowNode), {}});
+}
+
+void ReclamationQueue::retire(ShadowViewMutationList mutations) const {
+  if (mutations.empty()) {
+    return;
+  }
+  enqueue(Retiree{nullptr, std::move(mutations)});
+}
+
+void ReclamationQueue::enqueue(Retiree&& retiree) const {
+  {
+    std::scoped_lock lock(mutex_);
+    if (retiree.rootShadowNode != nullptr) {
+      // Every owner of a tree (the shadow tree, a commit in progress and the
+      // mounting coordinator) retires it when dropping it. A pending copy
+      // keeps the tree alive, so the new reference is released right away
+      // instead of taking another slot. This never destroys the tree.
+      for (const auto& pendingRetiree : pending_) {
+        if (pendingRetiree.rootShadowNode == retiree.rootShadowNode) {
+          retiree.rootShadowNode.reset();
+          return;
+        }
+      }
+    }
+
+    if (pending_.size() < capacity_) {
+      pending_.push_back(std::move(retiree));
+      enqueuedCount_++;
+      // The worker is woken up for the first object only; everything
+      // retired until it gets scheduled ends up in the same batch.
+      if (pending_.size() == 1) {
+        condition_.notify_one();
+      }
+      return;
+    }
+  }
+
+  // Backpressure: the worker doesn't keep up, so the retiring thread pays
+  // for the destruction as if the queue didn't exist.
+  auto batch = std::vector<Retiree>{};
+  batch.push_back(std::move(retiree));
+  reclaim(std::move(batch), true);
+}
+
+void ReclamationQueue::flush() const {
+  std::unique_lock lock(mutex_);
+  auto target = enqueuedCount_;
+  reclaimedCondition_.wait(
+      lock, [this, target]() { return reclaimedCount_ >= target; });
+}
+
+ReclamationTelemetry ReclamationQueue::getTelemetry() const {
+  std::scoped_lock lock(telemetryMutex_);
+  return telemetry_;
+}
+
+void ReclamationQueue::reclaim(std::vector<Retiree>&& batch, bool isInline)
+    const {
+  SystraceSection s("ReclamationQueue::reclaim");
+
+  auto startTime = telemetryTimePointNow();
+  auto nodeCount = 0;
+  auto mutationCount = 0;
+  for (auto& retiree : batch) {
+    if (retiree.rootShadowNode.use_count() == 1) {
+      nodeCount += countExclusivelyOwnedNodes(*retiree.rootShadowNode);
+    }
+    mutationCount += static_cast<int>(retiree.mutations.size());
+    // Trees are released one by one, so that subtrees shared by several
+    // trees of the batch are counted with the last of them.
+    retiree = Retiree{};
+  }
+  batch.clear();
+  auto duration = telemetryTimePointNow() - startTime;
+
+  std::scoped_lock lock(telemetryMutex_);
+  if (isInline) {
+    telemetry_.inlineReclamationCount++;
+  } else {
+    telemetry_.batchCount++;
+  }
+  telemetry_.reclaimedNodeCount += nodeCount;
+  telemetry_.reclaimedMutationCount += mutationCount;
+  telemetry_.reclamationDuration += duration;
+}
+
+void ReclamationQueue::loop() {
+  lowerCurrentThreadPriority();
+
+  while (true) {
+    auto batch = std::vector<Retiree>{};
+
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this]() { return stopped_ || !pending_.empty(); });
+      if (pending_.empty()) {
+        return;
+      }
+      batch.swap(pending_);
+    }
+
+    auto batchSize = batch.size();
+    reclaim(std::move(batch), false);
+
+    {
+      std::scoped_lock lock(mutex_);
+      reclaimedCount_ += batchSize;
+    }
+    reclaimedCondition_.notify_all();
+  }
+}
+
+} // namespace facebook::react
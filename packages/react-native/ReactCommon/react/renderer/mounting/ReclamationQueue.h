@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook::react {
+
+/*
+ * Aggregated statistics of a `ReclamationQueue`.
+ */
+struct ReclamationTelemetry {
+  /*
+   * Number of batches destroyed by the worker thread.
+   */
+  int batchCount{0};
+
+  /*
+   * Number of retired trees and mutation lists destroyed synchronously by the
+   * retiring thread because the queue was full.
+   */
+  int inlineReclamationCount{0};
+
+  /*
+   * Number of `ShadowNode`s freed along with retired trees, as estimated
+   * right before their destruction.
+   */
+  int reclaimedNodeCount{0};
+
+  /*
+   * Number of mutations in retired mutation lists.
+   */
+  int reclaimedMutationCount{0};
+
+  /*
+   * Total time spent destroying retired objects, on any thread.
+   */
+  TelemetryDuration reclamationDuration{0};
+};
+
+/*
+ * Destroys retired shadow trees and mutation lists in batches on a low
+ * priority worker thread.
+ * When the last reference to a large tree is dropped, thousands of
+ * `ShadowNode`s, `Props` and `State`s are released recursively; retiring the
+ * reference instead keeps that work off the JavaScript and main threads.
+ * The queue holds at most `capacity` objects; when it is full, objects are
+ * destroyed right away on the retiring thread so memory stays bounded.
+ * Retiring a tree which is already pending doesn't take another slot.
+ */
+class ReclamationQueue final {
+ public:
+  static constexpr size_t kDefaultCapacity = 64;
+
+  /*
+   * Returns the process-wide instance. The instance is never destroyed.
+   */
+  static const ReclamationQueue& shared();
+
+  explicit ReclamationQueue(size_t capacity = kDefaultCapacity);
+  ~ReclamationQueue();
+
+  /*
+   * Not copyable, not movable.
+   */
+  ReclamationQueue(const ReclamationQueue& other) = delete;
+  ReclamationQueue& operator=(const ReclamationQueue& other) = delete;
+
+  /*
+   * Schedules the reference to be released on the worker thread.
+   * Does nothing for `nullptr`.
+   * Can be called from any thread.
+   */
+  void retire(RootShadowNode::Shared rootShadowNode) const;
+  void retire(ShadowViewMutationList mutations) const;
+
+  /*
+   * Blocks until all objects retired before the call are destroyed.
+   * Can be called from any thread except the worker.
+   */
+  void flush() const;
+
+  /*
+   * Returns the statistics collected since the queue was created.
+   * Can be called from any thread.
+   */
+  ReclamationTelemetry getTelemetry() const;
+
+ private:
+  struct Retiree {
+    RootShadowNode::Shared rootShadowNode;
+    ShadowViewMutationList mutations;
+  };
+
+  void enqueue(Retiree&& retiree) const;
+  void reclaim(std::vector<Retiree>&& batch, bool isInline) const;
+  void loop();
+
+  const size_t capacity_;
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable std::condition_variable reclaimedCondition_;
+  mutable std::vector<Retiree> pending_; // Protected by `mutex_`.
+  mutable size_t enqueuedCount_{0}; // Protected by `mutex_`.
+  mutable size_t reclaimedCount_{0}; // Protected by `mutex_`.
+  bool stopped_{false}; // Protected by `mutex_`.
+
+  mutable std::mutex telemetryMutex_;
+  mutable ReclamationTelemetry telemetry_{}; // Protected by `telemetryMutex_`.
+
+  std::thread thread_;
+};
+
+} // namespace facebook::react
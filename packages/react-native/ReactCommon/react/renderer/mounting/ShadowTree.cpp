@@ -18,6 +18,8 @@
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/utils/CoreFeatures.h>
+#include "CommitPipeline.h"
+#include "ReclamationQueue.h"
 #include "updateMountedFlag.h"
 
 #include "ShadowTreeDelegate.h"
@@ -27,6 +29,16 @@ namespace facebook::react {
 using CommitStatus = ShadowTree::CommitStatus;
 using CommitMode = ShadowTree::CommitMode;
 
+/*
+ * The second half of a commit handed off to the `CommitPipeline` worker.
+ */
+struct ShadowTree::PipelinedCommit {
+  RootShadowNode::Unshared newRootShadowNode;
+  TransactionTelemetry telemetry;
+  CommitMode commitMode;
+  CommitOptions commitOptions;
+};
+
 // --- State Alignment Mechanism algorithm ---
 // Note: Ideally, we don't have to const_cast but our use of constness in
 // C++ is overly restrictive. We do const_cast here but the only place where
@@ -309,6 +321,12 @@ ShadowTree::ShadowTree(
 }
 
 ShadowTree::~ShadowTree() {
+  {
+    // Scheduled tasks refer to `this`, so they must be drained first.
+    std::unique_lock lock(pipelineTasksMutex_);
+    pipelineTasksCondition_.wait(lock, [this]() { return pipelineTasks_ == 0; });
+  }
+
   mountingCoordinator_->revoke();
 }
 
@@ -321,6 +339,7 @@ void ShadowTree::setCommitMode(CommitMode commitMode) const {
 
   {
     std::unique_lock lock(commitMutex_);
+    waitForPipelinedCommit(lock);
     if (commitMode_ == commitMode) {
       return;
     }
@@ -382,6 +401,7 @@ CommitStatus ShadowTree::tryCommit(
   {
     // Reading `currentRevision_` in shared manner.
     std::shared_lock lock(commitMutex_);
+    waitForPipelinedCommit(lock);
     commitMode = commitMode_;
     oldRevision = currentRevision_;
     lastRevisionNumberWithNewState = lastRevisionNumberWithNewState_;
@@ -417,19 +437,34 @@ CommitStatus ShadowTree::tryCommit(
     return CommitStatus::Cancelled;
   }
 
+  if (commitOptions.pipelined) {
+    return schedulePipelinedCommit(
+        oldRevision,
+        std::move(newRootShadowNode),
+        telemetry,
+        commitMode,
+        lastRevisionNumberWithNewState,
+        commitOptions);
+  }
+
   // Layout nodes.
   std::vector<const LayoutableShadowNode*> affectedLayoutableNodes{};
   affectedLayoutableNodes.reserve(1024);
+  int skippedLayoutSubtreesCount = 0;
 
   telemetry.willLayout();
   telemetry.setAsThreadLocal();
-  newRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
+  newRootShadowNode->layoutIfNeeded(
+      &affectedLayoutableNodes, &skippedLayoutSubtreesCount);
   telemetry.unsetAsThreadLocal();
-  telemetry.didLayout(static_cast<int>(affectedLayoutableNodes.size()));
+  telemetry.didLayout(
+      static_cast<int>(affectedLayoutableNodes.size()),
+      skippedLayoutSubtreesCount);
 
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
     std::unique_lock lock(commitMutex_);
+    waitForPipelinedCommit(lock);
 
     if (commitOptions.shouldYield && commitOptions.shouldYield()) {
       return CommitStatus::Cancelled;
@@ -449,40 +484,159 @@ CommitStatus ShadowTree::tryCommit(
       }
     }
 
-    auto newRevisionNumber = currentRevision_.number + 1;
+    newRevision = promoteRevision(
+        std::move(newRootShadowNode), telemetry, commitOptions);
+  }
+
+  emitLayoutEvents(affectedLayoutableNodes);
+
+  if (commitMode == CommitMode::Normal) {
+    mount(std::move(newRevision), commitOptions.mountSynchronously);
+  }
+
+  if (CoreFeatures::enableDeferredReclamation) {
+    ReclamationQueue::shared().retire(std::move(oldRevision.rootShadowNode));
+  }
+
+  return CommitStatus::Succeeded;
+}
+
+ShadowTreeRevision ShadowTree::promoteRevision(
+    RootShadowNode::Unshared newRootShadowNode,
+    TransactionTelemetry& telemetry,
+    const CommitOptions& commitOptions) const {
+  auto newRevisionNumber = currentRevision_.number + 1;
+
+  if (ReactNativeFeatureFlags::fixMountedFlagAndFixPreallocationClone()) {
+    newRootShadowNode->markPromotedRecursively();
+  } else {
+    updateMountedFlag(
+        currentRevision_.rootShadowNode->getChildren(),
+        newRootShadowNode->getChildren());
+  }
+
+  telemetry.didCommit();
+  telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
+
+  // Seal the shadow node so it can no longer be mutated
+  // Does nothing in release.
+  newRootShadowNode->sealRecursive();
+
+  if (CoreFeatures::enableDeferredReclamation) {
+    ReclamationQueue::shared().retire(
+        std::move(currentRevision_.rootShadowNode));
+  }
+
+  currentRevision_ = ShadowTreeRevision{
+      std::move(newRootShadowNode), newRevisionNumber, telemetry};
+
+  if (!commitOptions.enableStateReconciliation) {
+    lastRevisionNumberWithNewState_ = newRevisionNumber;
+  }
+
+  return currentRevision_;
+}
+
+#pragma mark - Pipelined commits
+
+CommitStatus ShadowTree::schedulePipelinedCommit(
+    const ShadowTreeRevision& oldRevision,
+    RootShadowNode::Unshared newRootShadowNode,
+    const TransactionTelemetry& telemetry,
+    CommitMode commitMode,
+    ShadowTreeRevision::Number lastRevisionNumberWithNewState,
+    const CommitOptions& commitOptions) const {
+  SystraceSection s("ShadowTree::schedulePipelinedCommit");
+
+  auto pipelinedCommit = std::make_shared<PipelinedCommit>(PipelinedCommit{
+      std::move(newRootShadowNode), telemetry, commitMode, commitOptions});
+
+  {
+    std::unique_lock lock(commitMutex_);
+
+    waitForPipelinedCommit(lock);
 
-    if (ReactNativeFeatureFlags::fixMountedFlagAndFixPreallocationClone()) {
-      newRootShadowNode->markPromotedRecursively();
+    // This is the last point at which the commit can yield. Once handed off,
+    // it is always published, so that `Succeeded` is final.
+    if (commitOptions.shouldYield && commitOptions.shouldYield()) {
+      return CommitStatus::Cancelled;
+    }
+
+    if (CoreFeatures::enableGranularShadowTreeStateReconciliation) {
+      if (commitOptions.enableStateReconciliation &&
+          lastRevisionNumberWithNewState != lastRevisionNumberWithNewState_) {
+        return CommitStatus::Failed;
+      }
     } else {
-      std::scoped_lock dispatchLock(EventEmitter::DispatchMutex());
-      updateMountedFlag(
-          currentRevision_.rootShadowNode->getChildren(),
-          newRootShadowNode->getChildren());
+      if (currentRevision_.number != oldRevision.number) {
+        return CommitStatus::Failed;
+      }
     }
 
-    telemetry.didCommit();
-    telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
+    // From now on, all other commits wait for this one, so publishing it on
+    // the worker cannot conflict with anything.
+    pipelinedCommit_ = pipelinedCommit;
+  }
+
+  {
+    std::scoped_lock lock(pipelineTasksMutex_);
+    pipelineTasks_++;
+  }
 
-    // Seal the shadow node so it can no longer be mutated
-    // Does nothing in release.
-    newRootShadowNode->sealRecursive();
+  CommitPipeline::shared().dispatch([this, pipelinedCommit]() {
+    runPipelinedCommit(*pipelinedCommit);
 
-    newRevision = ShadowTreeRevision{
-        std::move(newRootShadowNode), newRevisionNumber, telemetry};
+    std::scoped_lock lock(pipelineTasksMutex_);
+    pipelineTasks_--;
+    pipelineTasksCondition_.notify_all();
+  });
 
-    currentRevision_ = newRevision;
-    if (!commitOptions.enableStateReconciliation) {
-      lastRevisionNumberWithNewState_ = newRevisionNumber;
-    }
+  return CommitStatus::Succeeded;
+}
+
+void ShadowTree::runPipelinedCommit(PipelinedCommit& pipelinedCommit) const {
+  SystraceSection s("ShadowTree::runPipelinedCommit");
+
+  auto& telemetry = pipelinedCommit.telemetry;
+  const auto& commitOptions = pipelinedCommit.commitOptions;
+
+  // Layout nodes.
+  std::vector<const LayoutableShadowNode*> affectedLayoutableNodes{};
+  affectedLayoutableNodes.reserve(1024);
+  int skippedLayoutSubtreesCount = 0;
+
+  telemetry.willLayout();
+  telemetry.setAsThreadLocal();
+  pipelinedCommit.newRootShadowNode->layoutIfNeeded(
+      &affectedLayoutableNodes, &skippedLayoutSubtreesCount);
+  telemetry.unsetAsThreadLocal();
+  telemetry.didLayout(
+      static_cast<int>(affectedLayoutableNodes.size()),
+      skippedLayoutSubtreesCount);
+
+  auto newRevision = ShadowTreeRevision{};
+
+  {
+    std::unique_lock lock(commitMutex_);
+
+    react_native_assert(pipelinedCommit_.get() == &pipelinedCommit);
+    pipelinedCommit_ = nullptr;
+    pipelinedCommitCondition_.notify_all();
+
+    newRevision = promoteRevision(
+        std::move(pipelinedCommit.newRootShadowNode), telemetry, commitOptions);
   }
 
   emitLayoutEvents(affectedLayoutableNodes);
 
-  if (commitMode == CommitMode::Normal) {
-    mount(std::move(newRevision), commitOptions.mountSynchronously);
+  if (pipelinedCommit.commitMode == CommitMode::Normal) {
+    mountingCoordinator_->push(std::move(newRevision));
+    // We are off the mounting thread already, so the diff can be computed
+    // here instead of inside `pullTransaction`.
+    mountingCoordinator_->precomputeMutations();
+    delegate_.shadowTreeDidFinishTransaction(
+        mountingCoordinator_, commitOptions.mountSynchronously);
   }
-
-  return CommitStatus::Succeeded;
 }
 
 ShadowTreeRevision ShadowTree::getCurrentRevision() const {
@@ -490,6 +644,12 @@ ShadowTreeRevision ShadowTree::getCurrentRevision() const {
   return currentRevision_;
 }
 
+ShadowTreeRevision ShadowTree::getCommittedRevision() const {
+  std::shared_lock lock(commitMutex_);
+  waitForPipelinedCommit(lock);
+  return currentRevision_;
+}
+
 void ShadowTree::mount(ShadowTreeRevision revision, bool mountSynchronously)
     const {
   mountingCoordinator_->push(std::move(revision));
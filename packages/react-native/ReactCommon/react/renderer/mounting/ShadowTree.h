@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -70,6 +73,19 @@ class ShadowTree final {
     // Called during `tryCommit` phase. Returning true indicates current commit
     // should yield to the next commit.
     std::function<bool()> shouldYield;
+
+    // When set to true, only the transaction, state reconciliation and commit
+    // hooks run on the calling thread. Layout, publishing of the new revision,
+    // layout events and diffing run on the `CommitPipeline` worker, and
+    // `tryCommit` returns as soon as the new tree is handed off. A pipelined
+    // commit that returned `Succeeded` is always published.
+    // Any other commit and `getCommittedRevision` wait for an in-flight
+    // pipelined commit to be published first; `getCurrentRevision` does not.
+    // The wait is unbounded and deliberate: commits build on the published
+    // revision, so only one pipelined commit per tree is in flight, and
+    // JavaScript overlaps with layout only until its next commit or layout
+    // read.
+    bool pipelined{false};
   };
 
   /*
@@ -115,10 +131,20 @@ class ShadowTree final {
 
   /*
    * Returns a `ShadowTreeRevision` representing the momentary state of
-   * the `ShadowTree`.
+   * the `ShadowTree`. Does not include an in-flight pipelined commit, so
+   * its layout may be older than the last successful commit.
    */
   ShadowTreeRevision getCurrentRevision() const;
 
+  /*
+   * Returns the `ShadowTreeRevision` of the last successful commit, waiting
+   * for an in-flight pipelined commit to be published.
+   * Use it for anything reading layout on behalf of JavaScript (measuring,
+   * hit testing, intersection observers), which has to observe the commits
+   * it issued.
+   */
+  ShadowTreeRevision getCommittedRevision() const;
+
   /*
    * Commit an empty tree (a new `RootShadowNode` with no children).
    */
@@ -136,8 +162,46 @@ class ShadowTree final {
  private:
   constexpr static ShadowTreeRevision::Number INITIAL_REVISION{0};
 
+  struct PipelinedCommit;
+
   void mount(ShadowTreeRevision revision, bool mountSynchronously) const;
 
+  /*
+   * Makes `newRootShadowNode` the current revision.
+   * Must be called with `commitMutex_` locked in unique manner.
+   */
+  ShadowTreeRevision promoteRevision(
+      RootShadowNode::Unshared newRootShadowNode,
+      TransactionTelemetry& telemetry,
+      const CommitOptions& commitOptions) const;
+
+  /*
+   * Hands off `newRootShadowNode` to the `CommitPipeline` worker.
+   */
+  CommitStatus schedulePipelinedCommit(
+      const ShadowTreeRevision& oldRevision,
+      RootShadowNode::Unshared newRootShadowNode,
+      const TransactionTelemetry& telemetry,
+      CommitMode commitMode,
+      ShadowTreeRevision::Number lastRevisionNumberWithNewState,
+      const CommitOptions& commitOptions) const;
+
+  /*
+   * Performs the second half of a pipelined commit. Runs on the
+   * `CommitPipeline` worker.
+   */
+  void runPipelinedCommit(PipelinedCommit& pipelinedCommit) const;
+
+  /*
+   * Blocks until there is no in-flight pipelined commit.
+   * `lock` must hold `commitMutex_`.
+   */
+  template <typename LockT>
+  void waitForPipelinedCommit(LockT& lock) const {
+    pipelinedCommitCondition_.wait(
+        lock, [this]() { return pipelinedCommit_ == nullptr; });
+  }
+
   void emitLayoutEvents(
       std::vector<const LayoutableShadowNode*>& affectedLayoutableNodes) const;
 
@@ -149,6 +213,12 @@ class ShadowTree final {
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
   mutable ShadowTreeRevision::Number
       lastRevisionNumberWithNewState_; // Protected by `commitMutex_`.
+  mutable std::shared_ptr<PipelinedCommit>
+      pipelinedCommit_; // Protected by `commitMutex_`.
+  mutable std::condition_variable_any pipelinedCommitCondition_;
+  mutable std::mutex pipelineTasksMutex_;
+  mutable std::condition_variable pipelineTasksCondition_;
+  mutable int pipelineTasks_{0}; // Protected by `pipelineTasksMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
 };
 
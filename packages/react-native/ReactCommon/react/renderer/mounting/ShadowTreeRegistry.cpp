@@ -11,55 +11,145 @@
 
 namespace facebook::react {
 
+ShadowTreeRegistry::ReadSection::ReadSection(Shard& shard) : shard_(shard) {
+  // Registering races with writers flipping the epoch; a reader which lost
+  // the race may have registered in a counter a writer no longer waits for,
+  // so it has to retry with the new epoch before touching the snapshot.
+  while (true) {
+    auto epoch = shard_.epoch.load();
+    auto& readerCount = shard_.readerCounts[epoch & 1];
+    readerCount.fetch_add(1);
+    if (shard_.epoch.load() == epoch) {
+      readerCount_ = &readerCount;
+      return;
+    }
+    if (readerCount.fetch_sub(1) == 1) {
+      readerCount.notify_all();
+    }
+  }
+}
+
+ShadowTreeRegistry::ReadSection::~ReadSection() {
+  if (readerCount_->fetch_sub(1) == 1) {
+    readerCount_->notify_all();
+  }
+}
+
+const ShadowTreeRegistry::Snapshot* ShadowTreeRegistry::ReadSection::snapshot()
+    const {
+  return shard_.snapshot.load();
+}
+
 ShadowTreeRegistry::~ShadowTreeRegistry() {
-  react_native_assert(
-      registry_.empty() && "Deallocation of non-empty `ShadowTreeRegistry`.");
+  for (const auto& shard : shards_) {
+    react_native_assert(
+        shard.shadowTrees.empty() &&
+        "Deallocation of non-empty `ShadowTreeRegistry`.");
+  }
+}
+
+ShadowTreeRegistry::Shard& ShadowTreeRegistry::shardForSurfaceId(
+    SurfaceId surfaceId) const {
+  // Root tags are usually generated in steps of 10, so the id is mixed
+  // (Fibonacci hashing) to spread surfaces evenly.
+  static_assert((kShardCount & (kShardCount - 1)) == 0);
+  auto hash = static_cast<uint32_t>(surfaceId) * 0x9E3779B1u;
+  return shards_[(hash >> 16) & (kShardCount - 1)];
+}
+
+void ShadowTreeRegistry::publishSnapshot(Shard& shard) {
+  auto snapshot = std::make_unique<Snapshot>();
+  snapshot->reserve(shard.shadowTrees.size());
+  for (const auto& [surfaceId, shadowTree] : shard.shadowTrees) {
+    snapshot->emplace_back(surfaceId, shadowTree.get());
+  }
+
+  shard.snapshot.store(snapshot.get());
+  auto previousSnapshot = std::exchange(
+      shard.ownedSnapshot, std::unique_ptr<const Snapshot>(snapshot.release()));
+  if (previousSnapshot != nullptr) {
+    shard.retiredSnapshots.push_back(std::move(previousSnapshot));
+  }
+}
+
+void ShadowTreeRegistry::waitForReaders(Shard& shard) {
+  // Only this function flips the epoch, and it drains the previous counter
+  // each time, so every reader which entered before the flip is registered
+  // in that counter. Readers entering after it use the other one.
+  auto epoch = shard.epoch.fetch_add(1);
+  auto& readerCount = shard.readerCounts[epoch & 1];
+  for (auto count = readerCount.load(); count != 0;
+       count = readerCount.load()) {
+    readerCount.wait(count);
+  }
+
+  shard.retiredSnapshots.clear();
 }
 
 void ShadowTreeRegistry::add(std::unique_ptr<ShadowTree>&& shadowTree) const {
-  std::unique_lock lock(mutex_);
+  auto& shard = shardForSurfaceId(shadowTree->getSurfaceId());
+  std::scoped_lock lock(shard.mutex);
 
-  registry_.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  shard.shadowTrees.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  publishSnapshot(shard);
 }
 
 std::unique_ptr<ShadowTree> ShadowTreeRegistry::remove(
     SurfaceId surfaceId) const {
-  std::unique_lock lock(mutex_);
+  auto& shard = shardForSurfaceId(surfaceId);
+  std::scoped_lock lock(shard.mutex);
 
-  auto iterator = registry_.find(surfaceId);
-  if (iterator == registry_.end()) {
+  auto iterator = shard.shadowTrees.find(surfaceId);
+  if (iterator == shard.shadowTrees.end()) {
     return {};
   }
 
-  auto shadowTree = std::unique_ptr<ShadowTree>(iterator->second.release());
-  registry_.erase(iterator);
+  auto shadowTree = std::move(iterator->second);
+  shard.shadowTrees.erase(iterator);
+
+  // Once the grace period is over nobody can be visiting the tree anymore.
+  publishSnapshot(shard);
+  waitForReaders(shard);
   return shadowTree;
 }
 
 bool ShadowTreeRegistry::visit(
     SurfaceId surfaceId,
     const std::function<void(const ShadowTree& shadowTree)>& callback) const {
-  std::shared_lock lock(mutex_);
+  auto readSection = ReadSection{shardForSurfaceId(surfaceId)};
 
-  auto iterator = registry_.find(surfaceId);
-
-  if (iterator == registry_.end()) {
+  const auto* snapshot = readSection.snapshot();
+  if (snapshot == nullptr) {
     return false;
   }
 
-  callback(*iterator->second);
-  return true;
+  for (const auto& [id, shadowTree] : *snapshot) {
+    if (id == surfaceId) {
+      callback(*shadowTree);
+      return true;
+    }
+  }
+
+  return false;
 }
 
 void ShadowTreeRegistry::enumerate(
     const std::function<void(const ShadowTree& shadowTree, bool& stop)>&
         callback) const {
-  std::shared_lock lock(mutex_);
   auto stop = false;
-  for (const auto& pair : registry_) {
-    callback(*pair.second, stop);
-    if (stop) {
-      return;
+  for (auto& shard : shards_) {
+    auto readSection = ReadSection{shard};
+
+    const auto* snapshot = readSection.snapshot();
+    if (snapshot == nullptr) {
+      continue;
+    }
+
+    for (const auto& [surfaceId, shadowTree] : *snapshot) {
+      callback(*shadowTree, stop);
+      if (stop) {
+        return;
+      }
     }
   }
 }
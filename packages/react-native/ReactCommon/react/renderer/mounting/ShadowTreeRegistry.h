@@ -7,8 +7,13 @@
 
 #pragma once
 
-#include <shared_mutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/mounting/ShadowTree.h>
@@ -17,6 +22,14 @@ namespace facebook::react {
 
 /*
  * Owning registry of `ShadowTree`s.
+ *
+ * Surfaces are spread over a fixed number of shards. Each shard publishes an
+ * immutable snapshot of its trees which `visit` and `enumerate` read without
+ * taking any lock. `add` and `remove` serialize on the shard's mutex and
+ * publish a new snapshot. `add` returns right away and leaves the previous
+ * snapshot for later reclamation. `remove` blocks (without spinning) until
+ * every reader that could still see the removed `ShadowTree` has left (a
+ * grace period), so the tree is never destroyed while it is being visited.
  */
 class ShadowTreeRegistry final {
  public:
@@ -35,14 +48,17 @@ class ShadowTreeRegistry final {
    * and returns it as a result.
    * The ownership of the instance is also transferred to the caller.
    * Returns `nullptr` if a `ShadowTree` with given `surfaceId` was not found.
+   * Blocks until all ongoing `visit` and `enumerate` calls which may reference
+   * the instance have finished, so must not be called from their callbacks.
    * Can be called from any thread.
    */
   std::unique_ptr<ShadowTree> remove(SurfaceId surfaceId) const;
 
   /*
    * Finds a `ShadowTree` instance with a given `surfaceId` in the registry and
-   * synchronously calls the `callback` with a reference to the instance while
-   * the mutex is being acquired.
+   * synchronously calls the `callback` with a reference to the instance.
+   * Never blocks; the instance is guaranteed to stay alive until the
+   * `callback` returns.
    * Returns `true` if the registry has `ShadowTree` instance with corresponding
    * `surfaceId`, otherwise returns `false` without calling the `callback`.
    * Can be called from any thread.
@@ -54,6 +70,7 @@ class ShadowTreeRegistry final {
   /*
    * Enumerates all stored shadow trees.
    * Set `stop` to `true` to interrupt the enumeration.
+   * Never blocks.
    * Can be called from any thread.
    */
   void enumerate(
@@ -61,9 +78,74 @@ class ShadowTreeRegistry final {
           callback) const;
 
  private:
-  mutable std::shared_mutex mutex_;
-  mutable std::unordered_map<SurfaceId, std::unique_ptr<ShadowTree>>
-      registry_; // Protected by `mutex_`.
+  static constexpr size_t kShardCount = 16;
+
+  /*
+   * Immutable list of the trees of a shard. Shards hold a handful of
+   * surfaces, so a linear scan beats hashing.
+   */
+  using Snapshot = std::vector<std::pair<SurfaceId, const ShadowTree*>>;
+
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::unordered_map<SurfaceId, std::unique_ptr<ShadowTree>>
+        shadowTrees; // Protected by `mutex`.
+    std::unique_ptr<const Snapshot> ownedSnapshot; // Protected by `mutex`.
+
+    /*
+     * Previous snapshots readers may still hold. Released after the next
+     * grace period.
+     */
+    std::vector<std::unique_ptr<const Snapshot>>
+        retiredSnapshots; // Protected by `mutex`.
+
+    /*
+     * Mirrors `ownedSnapshot` for readers.
+     */
+    std::atomic<const Snapshot*> snapshot{nullptr};
+
+    /*
+     * Readers register in the counter selected by the parity of `epoch`.
+     * A grace period flips the epoch and waits for the previous counter to
+     * drain. Readers leaving a counter notify waiters when it drops to zero.
+     */
+    std::atomic<uint64_t> epoch{0};
+    std::array<std::atomic<size_t>, 2> readerCounts{};
+  };
+
+  /*
+   * RAII read-side critical section of a shard.
+   */
+  class ReadSection final {
+   public:
+    explicit ReadSection(Shard& shard);
+    ~ReadSection();
+
+    ReadSection(const ReadSection&) = delete;
+    ReadSection& operator=(const ReadSection&) = delete;
+
+    const Snapshot* snapshot() const;
+
+   private:
+    Shard& shard_;
+    std::atomic<size_t>* readerCount_{};
+  };
+
+  Shard& shardForSurfaceId(SurfaceId surfaceId) const;
+
+  /*
+   * Publishes a snapshot of `shard.shadowTrees` and retires the previous
+   * one. Must be called with `shard.mutex` held.
+   */
+  static void publishSnapshot(Shard& shard);
+
+  /*
+   * Waits until every reader which entered before the call has left, then
+   * releases the retired snapshots. Must be called with `shard.mutex` held.
+   */
+  static void waitForReaders(Shard& shard);
+
+  mutable std::array<Shard, kShardCount> shards_{};
 };
 
 } // namespace facebook::react
@@ -8,6 +8,8 @@
 #include "TelemetryController.h"
 
 #include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ReclamationQueue.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
@@ -47,6 +49,12 @@ bool TelemetryController::pullTransaction(
   compoundTelemetry_ = compoundTelemetry;
   mutex_.unlock();
 
+  if (CoreFeatures::enableDeferredReclamation) {
+    // Delete mutations may hold the last references to `Props`, `State`s
+    // and `EventEmitter`s of removed views.
+    ReclamationQueue::shared().retire(std::move(transaction).getMutations());
+  }
+
   return true;
 }
 
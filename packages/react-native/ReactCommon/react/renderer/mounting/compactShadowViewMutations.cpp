@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "compactShadowViewMutations.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook::react {
+
+static Tag getChildTag(const ShadowViewMutation& mutation) {
+  switch (mutation.type) {
+    case ShadowViewMutation::Create:
+    case ShadowViewMutation::Insert:
+    case ShadowViewMutation::Update:
+      return mutation.newChildShadowView.tag;
+    case ShadowViewMutation::Delete:
+    case ShadowViewMutation::Remove:
+    case ShadowViewMutation::RemoveDeleteTree:
+      return mutation.oldChildShadowView.tag;
+  }
+  return NO_VIEW_TAG;
+}
+
+static bool isInsertOrRemove(const ShadowViewMutation& mutation) {
+  return mutation.type == ShadowViewMutation::Insert ||
+      mutation.type == ShadowViewMutation::Remove;
+}
+
+/*
+ * Returns `true` for instructions that platforms may apply differently from
+ * what their type suggests. Views (and parents) they touch are left intact.
+ */
+static bool isOpaque(const ShadowViewMutation& mutation) {
+  return mutation.type == ShadowViewMutation::RemoveDeleteTree ||
+      mutation.isRedundantOperation ||
+      (isInsertOrRemove(mutation) && mutation.mutatedViewIsVirtual());
+}
+
+/*
+ * Finds views that are created and deleted within the stream and never
+ * host a view which outlives them.
+ */
+static std::unordered_set<Tag> findTransientTags(
+    const ShadowViewMutation::List& mutations,
+    const std::unordered_set<Tag>& frozenTags) {
+  struct Lifetime {
+    bool created{false};
+    bool deleted{false};
+    bool eligible{true};
+  };
+
+  auto lifetimes = std::unordered_map<Tag, Lifetime>{};
+  auto edges = std::vector<std::pair<Tag, Tag>>{};
+
+  for (const auto& mutation : mutations) {
+    auto tag = getChildTag(mutation);
+    switch (mutation.type) {
+      case ShadowViewMutation::Create: {
+        auto& lifetime = lifetimes[tag];
+        lifetime.eligible = lifetime.eligible && !lifetime.created;
+        lifetime.created = true;
+        break;
+      }
+      case ShadowViewMutation::Delete: {
+        auto it = lifetimes.find(tag);
+        if (it != lifetimes.end()) {
+          it->second.eligible = it->second.eligible && !it->second.deleted;
+          it->second.deleted = true;
+        }
+        break;
+      }
+      case ShadowViewMutation::Insert:
+      case ShadowViewMutation::Remove:
+        if (!isOpaque(mutation)) {
+          edges.emplace_back(mutation.parentShadowView.tag, tag);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  auto transientTags = std::unordered_set<Tag>{};
+  for (const auto& [tag, lifetime] : lifetimes) {
+    if (lifetime.created && lifetime.deleted && lifetime.eligible &&
+        !frozenTags.contains(tag)) {
+      transientTags.insert(tag);
+    }
+  }
+
+  // A transient view cannot be dropped if it hosted a view that survives, or
+  // if it was mounted to a parent whose indices we must not touch.
+  auto changed = true;
+  while (changed && !transientTags.empty()) {
+    changed = false;
+    for (const auto& [parentTag, childTag] : edges) {
+      if (transientTags.contains(parentTag) &&
+          !transientTags.contains(childTag)) {
+        transientTags.erase(parentTag);
+        changed = true;
+      }
+      if (transientTags.contains(childTag) && frozenTags.contains(parentTag)) {
+        transientTags.erase(childTag);
+        changed = true;
+      }
+    }
+  }
+
+  return transientTags;
+}
+
+/*
+ * Drops all instructions touching transient views. Instructions addressing
+ * siblings of those views by index are rewritten as if the transient views
+ * were never inserted.
+ */
+static ShadowViewMutation::List dropTransientViews(
+    ShadowViewMutation::List mutations,
+    const std::unordered_set<Tag>& transientTags) {
+  if (transientTags.empty()) {
+    return mutations;
+  }
+
+  // Current indices of transient children, per (non-transient) parent.
+  auto transientIndices = std::unordered_map<Tag, std::vector<int>>{};
+
+  auto result = ShadowViewMutation::List{};
+  result.reserve(mutations.size());
+
+  for (auto& mutation : mutations) {
+    auto tag = getChildTag(mutation);
+    auto isTransient = transientTags.contains(tag);
+
+    if (isInsertOrRemove(mutation) && !isOpaque(mutation) &&
+        !transientTags.contains(mutation.parentShadowView.tag)) {
+      auto& indices = transientIndices[mutation.parentShadowView.tag];
+      auto index = mutation.index;
+      auto it = std::lower_bound(indices.begin(), indices.end(), index);
+
+      if (!isTransient) {
+        mutation.index = index - static_cast<int>(it - indices.begin());
+      }
+
+      if (mutation.type == ShadowViewMutation::Insert) {
+        std::for_each(it, indices.end(), [](int& i) { i++; });
+        if (isTransient) {
+          indices.insert(it, index);
+        }
+      } else {
+        if (isTransient) {
+          react_native_assert(it != indices.end() && *it == index);
+          it = indices.erase(it);
+        }
+        std::for_each(it, indices.end(), [](int& i) { i--; });
+      }
+    }
+
+    if (!isTransient) {
+      result.push_back(std::move(mutation));
+    }
+  }
+
+  return result;
+}
+
+/*
+ * Cancels pairs of `Remove` and `Insert` instructions which put a view back
+ * into the position it was removed from. Instructions addressing siblings
+ * of the view in between are rewritten as if the view was never removed.
+ */
+static void cancelNoOpMoves(
+    ShadowViewMutation::List& mutations,
+    std::vector<bool>& dropped,
+    const std::unordered_set<Tag>& frozenTags) {
+  auto pendingRemoves = std::unordered_map<Tag, size_t>{};
+  auto parentInstructions = std::unordered_map<Tag, std::vector<size_t>>{};
+
+  auto tryCancel = [&](size_t removeIndex, size_t insertIndex) {
+    const auto& remove = mutations[removeIndex];
+    const auto& insert = mutations[insertIndex];
+    const auto& instructions = parentInstructions[insert.parentShadowView.tag];
+    auto begin =
+        std::upper_bound(instructions.begin(), instructions.end(), removeIndex);
+
+    // Tracks the position the view would have if it stayed in place.
+    auto position = remove.index;
+    for (auto it = begin; it != instructions.end(); it++) {
+      if (dropped[*it]) {
+        continue;
+      }
+      const auto& mutation = mutations[*it];
+      if (mutation.type == ShadowViewMutation::Insert) {
+        if (mutation.index <= position) {
+          position++;
+        }
+      } else if (mutation.index < position) {
+        position--;
+      }
+    }
+
+    if (position != insert.index) {
+      return false;
+    }
+
+    position = remove.index;
+    for (auto it = begin; it != instructions.end(); it++) {
+      if (dropped[*it]) {
+        continue;
+      }
+      auto& mutation = mutations[*it];
+      if (mutation.type == ShadowViewMutation::Insert) {
+        if (mutation.index <= position) {
+          position++;
+        } else {
+          mutation.index++;
+        }
+      } else {
+        if (mutation.index < position) {
+          position--;
+        } else {
+          mutation.index++;
+        }
+      }
+    }
+    return true;
+  };
+
+  for (size_t i = 0; i < mutations.size(); i++) {
+    if (dropped[i]) {
+      continue;
+    }
+
+    auto& mutation = mutations[i];
+    auto tag = getChildTag(mutation);
+
+    if (!isInsertOrRemove(mutation) || isOpaque(mutation) ||
+        frozenTags.contains(mutation.parentShadowView.tag)) {
+      pendingRemoves.erase(tag);
+      continue;
+    }
+
+    auto parentTag = mutation.parentShadowView.tag;
+
+    if (mutation.type == ShadowViewMutation::Remove) {
+      pendingRemoves[tag] = i;
+      parentInstructions[parentTag].push_back(i);
+      continue;
+    }
+
+    auto it = pendingRemoves.find(tag);
+    if (it != pendingRemoves.end() &&
+        mutations[it->second].parentShadowView.tag == parentTag &&
+        tryCancel(it->second, i)) {
+      auto& remove = mutations[it->second];
+      dropped[it->second] = true;
+      if (remove.oldChildShadowView == mutation.newChildShadowView) {
+        dropped[i] = true;
+      } else {
+        mutation = ShadowViewMutation::UpdateMutation(
+            remove.oldChildShadowView,
+            mutation.newChildShadowView,
+            mutation.parentShadowView);
+      }
+      pendingRemoves.erase(it);
+      continue;
+    }
+
+    if (it != pendingRemoves.end()) {
+      pendingRemoves.erase(it);
+    }
+    parentInstructions[parentTag].push_back(i);
+  }
+}
+
+/*
+ * Folds consecutive updates of the same view (i.e. ones not separated by
+ * other instructions affecting that view) into the first one.
+ */
+static void foldUpdates(
+    ShadowViewMutation::List& mutations,
+    std::vector<bool>& dropped) {
+  auto updates = std::unordered_map<Tag, size_t>{};
+
+  for (size_t i = 0; i < mutations.size(); i++) {
+    if (dropped[i]) {
+      continue;
+    }
+
+    auto& mutation = mutations[i];
+    auto tag = getChildTag(mutation);
+
+    if (mutation.type != ShadowViewMutation::Update) {
+      updates.erase(tag);
+      continue;
+    }
+
+    auto it = updates.find(tag);
+    if (it == updates.end()) {
+      updates[tag] = i;
+      continue;
+    }
+
+    auto& update = mutations[it->second];
+    update.newChildShadowView = mutation.newChildShadowView;
+    update.parentShadowView = mutation.parentShadowView;
+    dropped[i] = true;
+
+    if (update.oldChildShadowView == update.newChildShadowView) {
+      dropped[it->second] = true;
+      updates.erase(it);
+    }
+  }
+}
+
+ShadowViewMutation::List compactShadowViewMutations(
+    ShadowViewMutation::List mutations) {
+  SystraceSection s("compactShadowViewMutations");
+
+  if (mutations.size() < 2) {
+    return mutations;
+  }
+
+  // Views (and parents of views) touched by opaque instructions.
+  auto frozenTags = std::unordered_set<Tag>{};
+  for (const auto& mutation : mutations) {
+    if (isOpaque(mutation)) {
+      frozenTags.insert(getChildTag(mutation));
+      if (mutation.type != ShadowViewMutation::Delete) {
+        frozenTags.insert(mutation.parentShadowView.tag);
+      }
+    }
+  }
+
+  auto transientTags = findTransientTags(mutations, frozenTags);
+  mutations = dropTransientViews(std::move(mutations), transientTags);
+
+  auto dropped = std::vector<bool>(mutations.size(), false);
+  cancelNoOpMoves(mutations, dropped, frozenTags);
+  foldUpdates(mutations, dropped);
+
+  auto result = ShadowViewMutation::List{};
+  result.reserve(mutations.size());
+  for (size_t i = 0; i < mutations.size(); i++) {
+    if (!dropped[i]) {
+      result.push_back(std::move(mutations[i]));
+    }
+  }
+  return result;
+}
+
+ShadowViewMutation::List compactShadowViewMutations(
+    std::vector<ShadowViewMutation::List> mutationLists) {
+  auto size = size_t{0};
+  for (const auto& mutations : mutationLists) {
+    size += mutations.size();
+  }
+
+  auto mutations = ShadowViewMutation::List{};
+  mutations.reserve(size);
+  for (auto& list : mutationLists) {
+    std::move(list.begin(), list.end(), std::back_inserter(mutations));
+  }
+
+  return compactShadowViewMutations(std::move(mutations));
+}
+
+} // namespace facebook::react
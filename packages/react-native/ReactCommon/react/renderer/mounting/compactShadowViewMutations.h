@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook::react {
+
+/*
+ * Rewrites a stream of mutation instructions into a shorter one which brings
+ * a view tree into exactly the same final state. The following is compacted:
+ *  - Views that are created and deleted within the stream disappear from it
+ *    entirely, together with their insertions, removals and updates (indices
+ *    of the sibling instructions are adjusted accordingly);
+ *  - A view removed and inserted back into the same position of the same
+ *    parent is left in place (and updated if needed);
+ *  - Repeated updates of the same view are folded into a single one.
+ * Views affected by `RemoveDeleteTree`, redundant or virtual instructions are
+ * never compacted.
+ *
+ * Note: Dropping a `Create`/`Delete` pair is not compatible with platforms
+ * which preallocate views ahead of a `Create` instruction.
+ */
+ShadowViewMutation::List compactShadowViewMutations(
+    ShadowViewMutation::List mutations);
+
+/*
+ * Concatenates several consecutive mutation streams (e.g. multiple pending
+ * transactions) and compacts the result as a single stream.
+ */
+ShadowViewMutation::List compactShadowViewMutations(
+    std::vector<ShadowViewMutation::List> mutationLists);
+
+} // namespace facebook::react
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/compactShadowViewMutations.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+static ShadowView makeShadowView(Tag tag, Float width = 100) {
+  auto shadowView = ShadowView{};
+  shadowView.componentName = "View";
+  shadowView.surfaceId = 1;
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const ViewProps>();
+  shadowView.layoutMetrics = LayoutMetrics{};
+  shadowView.layoutMetrics.frame.size = {width, 10};
+  return shadowView;
+}
+
+/*
+ * `StubViewTree` equality does not account for the order of children.
+ */
+static void expectSameHierarchy(const StubView& lhs, const StubView& rhs) {
+  EXPECT_EQ(lhs.tag, rhs.tag);
+  ASSERT_EQ(lhs.children.size(), rhs.children.size());
+  for (size_t i = 0; i < lhs.children.size(); i++) {
+    expectSameHierarchy(*lhs.children[i], *rhs.children[i]);
+  }
+}
+
+static void expectSameTrees(const StubViewTree& lhs, const StubViewTree& rhs) {
+  EXPECT_TRUE(lhs == rhs);
+  expectSameHierarchy(lhs.getRootStubView(), rhs.getRootStubView());
+}
+
+/*
+ * Builds a view tree with a root view (tag 1) and given (empty) children.
+ */
+static StubViewTree buildStubViewTree(const std::vector<Tag>& childTags) {
+  auto viewTree = StubViewTree{makeShadowView(1)};
+  auto mutations = ShadowViewMutation::List{};
+  for (size_t i = 0; i < childTags.size(); i++) {
+    mutations.push_back(
+        ShadowViewMutation::CreateMutation(makeShadowView(childTags[i])));
+    mutations.push_back(ShadowViewMutation::InsertMutation(
+        makeShadowView(1), makeShadowView(childTags[i]), static_cast<int>(i)));
+  }
+  viewTree.mutate(mutations);
+  return viewTree;
+}
+
+static void testCompaction(
+    const std::vector<Tag>& childTags,
+    const ShadowViewMutation::List& mutations,
+    size_t expectedSize) {
+  auto expectedViewTree = buildStubViewTree(childTags);
+  expectedViewTree.mutate(mutations);
+
+  auto compactedMutations = compactShadowViewMutations(mutations);
+  EXPECT_EQ(compactedMutations.size(), expectedSize);
+
+  auto viewTree = buildStubViewTree(childTags);
+  viewTree.mutate(compactedMutations);
+
+  expectSameTrees(viewTree, expectedViewTree);
+}
+
+TEST(MutationCompactionTest, testCreateDeletePairsAreCancelled) {
+  auto root = makeShadowView(1);
+  testCompaction(
+      {2},
+      {
+          ShadowViewMutation::CreateMutation(makeShadowView(3)),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(3), 0),
+          ShadowViewMutation::CreateMutation(makeShadowView(4)),
+          // Children: [3, 2, 4]
+          ShadowViewMutation::InsertMutation(root, makeShadowView(4), 2),
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(3), makeShadowView(3, 50), root),
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(3, 50), 0),
+          ShadowViewMutation::DeleteMutation(makeShadowView(3, 50)),
+      },
+      2);
+}
+
+TEST(MutationCompactionTest, testTransientSubtreesAreCancelled) {
+  auto root = makeShadowView(1);
+  testCompaction(
+      {2},
+      {
+          ShadowViewMutation::CreateMutation(makeShadowView(3)),
+          ShadowViewMutation::CreateMutation(makeShadowView(4)),
+          ShadowViewMutation::InsertMutation(
+              makeShadowView(3), makeShadowView(4), 0),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(3), 1),
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(3), 1),
+          ShadowViewMutation::RemoveMutation(
+              makeShadowView(3), makeShadowView(4), 0),
+          ShadowViewMutation::DeleteMutation(makeShadowView(3)),
+          ShadowViewMutation::DeleteMutation(makeShadowView(4)),
+      },
+      0);
+}
+
+TEST(MutationCompactionTest, testSurvivingChildrenKeepTheirParents) {
+  auto root = makeShadowView(1);
+  testCompaction(
+      {2},
+      {
+          ShadowViewMutation::CreateMutation(makeShadowView(3)),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(3), 1),
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(2), 0),
+          ShadowViewMutation::InsertMutation(
+              makeShadowView(3), makeShadowView(2), 0),
+          ShadowViewMutation::RemoveMutation(
+              makeShadowView(3), makeShadowView(2), 0),
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(3), 0),
+          ShadowViewMutation::DeleteMutation(makeShadowView(3)),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(2), 0),
+      },
+      8);
+}
+
+TEST(MutationCompactionTest, testRepeatedUpdatesAreFolded) {
+  auto root = makeShadowView(1);
+  testCompaction(
+      {2, 3},
+      {
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(2), makeShadowView(2, 10), root),
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(3), makeShadowView(3, 10), root),
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(2, 10), makeShadowView(2, 20), root),
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(2, 20), makeShadowView(2, 30), root),
+          // Reverts the first update of view 3.
+          ShadowViewMutation::UpdateMutation(
+              makeShadowView(3, 10), makeShadowView(3), root),
+      },
+      1);
+}
+
+TEST(MutationCompactionTest, testNoOpMovesAreCancelled) {
+  auto root = makeShadowView(1);
+
+  // Moving a view back to its position turns into a plain update.
+  testCompaction(
+      {2, 3, 4},
+      {
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(3), 1),
+          ShadowViewMutation::CreateMutation(makeShadowView(5)),
+          // Children: [5, 2, 4]
+          ShadowViewMutation::InsertMutation(root, makeShadowView(5), 0),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(3, 50), 2),
+      },
+      3);
+
+  // An actual move is preserved.
+  testCompaction(
+      {2, 3, 4},
+      {
+          ShadowViewMutation::RemoveMutation(root, makeShadowView(2), 0),
+          ShadowViewMutation::InsertMutation(root, makeShadowView(2), 2),
+      },
+      2);
+}
+
+TEST(MutationCompactionTest, testAccumulatedRevisionsProduceTheSameTree) {
+  auto entropy = Entropy(1337);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  auto totalMutationCount = size_t{0};
+  auto totalCompactedMutationCount = size_t{0};
+
+  for (int i = 0; i < 20; i++) {
+    auto family =
+        rootComponentDescriptor.createFamily({Tag(1), SurfaceId(1), nullptr});
+
+    auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+        std::static_pointer_cast<const RootShadowNode>(
+            rootComponentDescriptor.createShadowNode(
+                ShadowNodeFragment{RootShadowNode::defaultSharedProps()},
+                family)));
+
+    emptyRootNode = emptyRootNode->clone(
+        parserContext,
+        LayoutConstraints{
+            Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, 64);
+
+    auto initialRootNode = std::static_pointer_cast<const RootShadowNode>(
+        emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<ShadowNode::ListOfShared>(
+                ShadowNode::ListOfShared{singleRootChildNode})}));
+
+    // A sequence of revisions the mounting layer has not caught up with.
+    auto currentRootNode = initialRootNode;
+    auto mutationLists = std::vector<ShadowViewMutation::List>{};
+    for (int j = 0; j < 8; j++) {
+      auto nextRootNode = currentRootNode;
+      alterShadowTree(
+          entropy,
+          nextRootNode,
+          {
+              &messWithChildren,
+              &messWithYogaStyles,
+              &messWithLayoutableOnlyFlag,
+              &messWithNodeFlattenednessFlags,
+          });
+      std::const_pointer_cast<RootShadowNode>(nextRootNode)->layoutIfNeeded();
+      nextRootNode->sealRecursive();
+
+      mutationLists.push_back(
+          calculateShadowViewMutations(*currentRootNode, *nextRootNode));
+      currentRootNode = nextRootNode;
+    }
+
+    auto mutations = ShadowViewMutation::List{};
+    for (const auto& list : mutationLists) {
+      mutations.insert(mutations.end(), list.begin(), list.end());
+    }
+    auto compactedMutations = compactShadowViewMutations(mutationLists);
+
+    totalMutationCount += mutations.size();
+    totalCompactedMutationCount += compactedMutations.size();
+    EXPECT_LE(compactedMutations.size(), mutations.size());
+
+    auto buildInitialViewTree = [&]() {
+      auto viewTree =
+          buildStubViewTreeWithoutUsingDifferentiator(*emptyRootNode);
+      viewTree.mutate(
+          calculateShadowViewMutations(*emptyRootNode, *initialRootNode));
+      return viewTree;
+    };
+
+    auto viewTree = buildInitialViewTree();
+    viewTree.mutate(mutations);
+
+    auto compactedViewTree = buildInitialViewTree();
+    compactedViewTree.mutate(compactedMutations);
+
+    auto expectedViewTree =
+        buildStubViewTreeWithoutUsingDifferentiator(*currentRootNode);
+
+    expectSameTrees(viewTree, expectedViewTree);
+    expectSameTrees(compactedViewTree, expectedViewTree);
+  }
+
+  EXPECT_LT(totalCompactedMutationCount, totalMutationCount);
+}
+
+} // namespace facebook::react
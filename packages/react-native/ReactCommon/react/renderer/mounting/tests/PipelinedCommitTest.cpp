@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+std::shared_ptr<RootShadowNode> buildTree(
+    ComponentBuilder& builder,
+    std::shared_ptr<ViewShadowNode>& viewShadowNode,
+    Float width) {
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .tag(1)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          sharedProps->layoutConstraints = LayoutConstraints{{0, 0}, {500, 500}};
+          return sharedProps;
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .reference(viewShadowNode)
+            .tag(2)
+            .props([=] {
+              auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+              auto &yogaStyle = sharedProps->yogaStyle;
+              yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(width));
+              yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(20));
+              return sharedProps;
+            })
+        });
+  // clang-format on
+  return builder.build(element);
+}
+
+// Mirrors `UIManager::completeSurface`.
+ShadowTreeCommitTransaction replaceChildren(
+    const std::shared_ptr<RootShadowNode>& rootShadowNode) {
+  return [=](const RootShadowNode& oldRootShadowNode) {
+    return std::make_shared<RootShadowNode>(
+        oldRootShadowNode,
+        ShadowNodeFragment{
+            .props = ShadowNodeFragment::propsPlaceholder(),
+            .children = std::make_shared<const ShadowNode::ListOfShared>(
+                rootShadowNode->getChildren()),
+        });
+  };
+}
+
+} // namespace
+
+TEST(PipelinedCommitTest, publishesLaidOutRevision) {
+  auto builder = simpleComponentBuilder();
+  auto viewShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto rootShadowNode = buildTree(builder, viewShadowNode, 100);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto status =
+      shadowTree.commit(replaceChildren(rootShadowNode), {.pipelined = true});
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+
+  // Reading the committed revision waits for the pipeline.
+  auto revision = shadowTree.getCommittedRevision();
+  EXPECT_EQ(revision.number, 1);
+
+  auto& viewNode = static_cast<const ViewShadowNode&>(
+      *revision.rootShadowNode->getChildren().at(0));
+  EXPECT_TRUE(ShadowNode::sameFamily(viewNode, *viewShadowNode));
+  EXPECT_EQ(viewNode.getLayoutMetrics().frame.size.width, 100);
+
+  // Mutations were pre-computed by the pipeline and must still be correct.
+  auto transaction = shadowTree.getMountingCoordinator()->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(transaction->getNumber(), 1);
+
+  auto hasCreateMutation = false;
+  for (const auto& mutation : transaction->getMutations()) {
+    if (mutation.type == ShadowViewMutation::Create &&
+        mutation.newChildShadowView.tag == 2) {
+      hasCreateMutation = true;
+    }
+  }
+  EXPECT_TRUE(hasCreateMutation);
+}
+
+TEST(PipelinedCommitTest, interleavesWithRegularCommits) {
+  auto builder = simpleComponentBuilder();
+  auto viewShadowNodeA = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeB = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeC = std::shared_ptr<ViewShadowNode>{};
+  auto rootShadowNodeA = buildTree(builder, viewShadowNodeA, 100);
+  auto rootShadowNodeB = buildTree(builder, viewShadowNodeB, 200);
+  auto rootShadowNodeC = buildTree(builder, viewShadowNodeC, 300);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  shadowTree.commit(replaceChildren(rootShadowNodeA), {.pipelined = true});
+  shadowTree.commit(replaceChildren(rootShadowNodeB), {.pipelined = true});
+
+  // A regular commit always observes the most recent pipelined commit.
+  auto observedChildShadowNode = ShadowNode::Shared{};
+  auto transactionC = replaceChildren(rootShadowNodeC);
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        observedChildShadowNode = oldRootShadowNode.getChildren().at(0);
+        return transactionC(oldRootShadowNode);
+      },
+      {});
+  ASSERT_NE(observedChildShadowNode, nullptr);
+  EXPECT_TRUE(
+      ShadowNode::sameFamily(*observedChildShadowNode, *viewShadowNodeB));
+
+  auto revision = shadowTree.getCurrentRevision();
+  auto& viewNode = static_cast<const ViewShadowNode&>(
+      *revision.rootShadowNode->getChildren().at(0));
+  EXPECT_TRUE(ShadowNode::sameFamily(viewNode, *viewShadowNodeC));
+  EXPECT_EQ(viewNode.getLayoutMetrics().frame.size.width, 300);
+}
+
+TEST(PipelinedCommitTest, publishesConsecutivePipelinedCommits) {
+  auto builder = simpleComponentBuilder();
+  auto viewShadowNodeA = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeB = std::shared_ptr<ViewShadowNode>{};
+  auto rootShadowNodeA = buildTree(builder, viewShadowNodeA, 100);
+  auto rootShadowNodeB = buildTree(builder, viewShadowNodeB, 200);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  // The second commit is based on the first one instead of dropping it.
+  auto observedChildShadowNode = ShadowNode::Shared{};
+  auto transactionB = replaceChildren(rootShadowNodeB);
+  EXPECT_EQ(
+      shadowTree.commit(replaceChildren(rootShadowNodeA), {.pipelined = true}),
+      ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(
+      shadowTree.commit(
+          [&](const RootShadowNode& oldRootShadowNode) {
+            observedChildShadowNode = oldRootShadowNode.getChildren().at(0);
+            return transactionB(oldRootShadowNode);
+          },
+          {.pipelined = true}),
+      ShadowTree::CommitStatus::Succeeded);
+  ASSERT_NE(observedChildShadowNode, nullptr);
+  EXPECT_TRUE(
+      ShadowNode::sameFamily(*observedChildShadowNode, *viewShadowNodeA));
+
+  auto revision = shadowTree.getCommittedRevision();
+  EXPECT_EQ(revision.number, 2);
+  auto& viewNode = static_cast<const ViewShadowNode&>(
+      *revision.rootShadowNode->getChildren().at(0));
+  EXPECT_TRUE(ShadowNode::sameFamily(viewNode, *viewShadowNodeB));
+  EXPECT_EQ(viewNode.getLayoutMetrics().frame.size.width, 200);
+
+  // Both commits were mounted.
+  auto transaction = shadowTree.getMountingCoordinator()->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(transaction->getNumber(), 2);
+}
+
+TEST(PipelinedCommitTest, failsOnConflictingCommit) {
+  auto builder = simpleComponentBuilder();
+  auto viewShadowNodeA = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeB = std::shared_ptr<ViewShadowNode>{};
+  auto rootShadowNodeA = buildTree(builder, viewShadowNodeA, 100);
+  auto rootShadowNodeB = buildTree(builder, viewShadowNodeB, 200);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  // Another commit lands while the pipelined transaction runs.
+  auto transactionA = replaceChildren(rootShadowNodeA);
+  auto status = shadowTree.tryCommit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        shadowTree.commit(replaceChildren(rootShadowNodeB), {});
+        return transactionA(oldRootShadowNode);
+      },
+      {.pipelined = true});
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Failed);
+
+  auto revision = shadowTree.getCommittedRevision();
+  EXPECT_EQ(revision.number, 1);
+  EXPECT_TRUE(ShadowNode::sameFamily(
+      *revision.rootShadowNode->getChildren().at(0), *viewShadowNodeB));
+}
+
+TEST(PipelinedCommitTest, cancelledCommitIsNotPublished) {
+  auto builder = simpleComponentBuilder();
+  auto viewShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto rootShadowNode = buildTree(builder, viewShadowNode, 100);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto status = shadowTree.commit(
+      replaceChildren(rootShadowNode),
+      {.shouldYield = []() { return true; }, .pipelined = true});
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Cancelled);
+
+  auto revision = shadowTree.getCommittedRevision();
+  EXPECT_EQ(revision.number, 0);
+  EXPECT_TRUE(revision.rootShadowNode->getChildren().empty());
+  EXPECT_FALSE(
+      shadowTree.getMountingCoordinator()->pullTransaction().has_value());
+}
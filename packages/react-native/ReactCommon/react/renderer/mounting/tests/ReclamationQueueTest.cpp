@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ReclamationQueue.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+#include <react/utils/CoreFeatures.h>
+
+using namespace facebook::react;
+
+namespace {
+
+int countNodes(const ShadowNode& shadowNode) {
+  auto count = 1;
+  for (const auto& childNode : shadowNode.getChildren()) {
+    count += countNodes(*childNode);
+  }
+  return count;
+}
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+class ReclamationQueueTest : public ::testing::Test {
+ protected:
+  ReclamationQueueTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        parameters_{EventDispatcher::Shared{}, contextContainer_, nullptr},
+        viewComponentDescriptor_(parameters_),
+        rootComponentDescriptor_(parameters_) {
+    contextContainer_->insert(
+        "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+  }
+
+  RootShadowNode::Shared makeTree(int size) {
+    auto family =
+        rootComponentDescriptor_.createFamily({Tag(1), SurfaceId(1), nullptr});
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootComponentDescriptor_.createShadowNode(
+            ShadowNodeFragment{
+                RootShadowNode::defaultSharedProps(),
+                std::make_shared<ShadowNode::ListOfShared>(
+                    ShadowNode::ListOfShared{generateShadowNodeTree(
+                        entropy_, viewComponentDescriptor_, size)}),
+            },
+            family));
+  }
+
+ private:
+  Entropy entropy_{42};
+  ContextContainer::Shared contextContainer_;
+  ComponentDescriptorParameters parameters_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  RootComponentDescriptor rootComponentDescriptor_;
+};
+
+} // namespace
+
+TEST_F(ReclamationQueueTest, retiredTreesAreDestroyedOnWorker) {
+  auto queue = ReclamationQueue{};
+
+  auto rootShadowNode = makeTree(256);
+  auto nodeCount = countNodes(*rootShadowNode);
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>(rootShadowNode);
+
+  queue.retire(std::move(rootShadowNode));
+  queue.retire(RootShadowNode::Shared{});
+  queue.flush();
+
+  EXPECT_TRUE(weakRootShadowNode.expired());
+
+  auto telemetry = queue.getTelemetry();
+  EXPECT_GE(telemetry.batchCount, 1);
+  EXPECT_EQ(telemetry.inlineReclamationCount, 0);
+  EXPECT_EQ(telemetry.reclaimedNodeCount, nodeCount);
+}
+
+TEST_F(ReclamationQueueTest, sharedNodesAreNotCounted) {
+  auto queue = ReclamationQueue{};
+
+  auto rootShadowNode = makeTree(64);
+  auto sharedChildNode = rootShadowNode->getChildren().front();
+  auto nodeCount = countNodes(*rootShadowNode);
+  auto sharedNodeCount = countNodes(*sharedChildNode);
+
+  queue.retire(std::move(rootShadowNode));
+  queue.flush();
+
+  EXPECT_EQ(
+      queue.getTelemetry().reclaimedNodeCount, nodeCount - sharedNodeCount);
+  EXPECT_EQ(sharedChildNode.use_count(), 1);
+}
+
+TEST_F(ReclamationQueueTest, fullQueueDestroysInline) {
+  auto queue = ReclamationQueue{0};
+
+  auto rootShadowNode = makeTree(16);
+  auto weakRootShadowNode = std::weak_ptr<const RootShadowNode>(rootShadowNode);
+
+  queue.retire(std::move(rootShadowNode));
+
+  // No need to flush: the tree is gone before `retire` returns.
+  EXPECT_TRUE(weakRootShadowNode.expired());
+
+  auto telemetry = queue.getTelemetry();
+  EXPECT_EQ(telemetry.batchCount, 0);
+  EXPECT_EQ(telemetry.inlineReclamationCount, 1);
+  EXPECT_GT(telemetry.reclaimedNodeCount, 0);
+}
+
+TEST_F(ReclamationQueueTest, retiredMutationsAreCounted) {
+  auto queue = ReclamationQueue{};
+
+  auto mutations = ShadowViewMutationList{};
+  for (auto tag = Tag{2}; tag < 12; tag++) {
+    auto shadowView = ShadowView{};
+    shadowView.tag = tag;
+    mutations.push_back(ShadowViewMutation::CreateMutation(shadowView));
+  }
+
+  queue.retire(std::move(mutations));
+  queue.retire(ShadowViewMutationList{});
+  queue.flush();
+
+  EXPECT_EQ(queue.getTelemetry().reclaimedMutationCount, 10);
+}
+
+TEST_F(ReclamationQueueTest, replacedRevisionsAreCounted) {
+  auto enableDeferredReclamation = CoreFeatures::enableDeferredReclamation;
+  CoreFeatures::enableDeferredReclamation = true;
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{1},
+      LayoutConstraints{{0, 0}, {500, 500}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  // Commits a new tree and mounts it, which retires every revision replaced
+  // along the way from the shadow tree and the mounting coordinator.
+  auto commitAndMount = [&](int size) {
+    auto children = makeTree(size)->getChildren();
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::make_shared<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  .props = ShadowNodeFragment::propsPlaceholder(),
+                  .children =
+                      std::make_shared<const ShadowNode::ListOfShared>(
+                          children),
+              });
+        },
+        {});
+    shadowTree.getMountingCoordinator()->pullTransaction();
+  };
+
+  const auto& queue = ReclamationQueue::shared();
+  queue.flush();
+  auto initialTelemetry = queue.getTelemetry();
+
+  commitAndMount(64);
+  commitAndMount(64);
+  commitAndMount(64);
+  queue.flush();
+
+  auto telemetry = queue.getTelemetry();
+  EXPECT_GT(
+      telemetry.reclaimedNodeCount, initialTelemetry.reclaimedNodeCount);
+
+  CoreFeatures::enableDeferredReclamation = enableDeferredReclamation;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+#include <react/utils/ContextContainer.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+class ShadowTreeRegistryTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<ShadowTree> makeShadowTree(SurfaceId surfaceId) const {
+    return std::make_unique<ShadowTree>(
+        surfaceId,
+        LayoutConstraints{},
+        LayoutContext{},
+        shadowTreeDelegate_,
+        contextContainer_);
+  }
+
+  ShadowTreeRegistry registry_{};
+
+ private:
+  DummyShadowTreeDelegate shadowTreeDelegate_{};
+  ContextContainer contextContainer_{};
+};
+
+} // namespace
+
+TEST_F(ShadowTreeRegistryTest, visitFindsAddedTrees) {
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 101; surfaceId += 10) {
+    registry_.add(makeShadowTree(surfaceId));
+  }
+
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 101; surfaceId += 10) {
+    auto visitedSurfaceId = SurfaceId{-1};
+    EXPECT_TRUE(registry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+      visitedSurfaceId = shadowTree.getSurfaceId();
+    }));
+    EXPECT_EQ(visitedSurfaceId, surfaceId);
+  }
+
+  EXPECT_FALSE(registry_.visit(2, [](const ShadowTree&) { FAIL(); }));
+
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 101; surfaceId += 10) {
+    auto shadowTree = registry_.remove(surfaceId);
+    EXPECT_NE(shadowTree, nullptr);
+    if (shadowTree == nullptr) {
+      continue;
+    }
+    EXPECT_EQ(shadowTree->getSurfaceId(), surfaceId);
+    EXPECT_FALSE(registry_.visit(surfaceId, [](const ShadowTree&) { FAIL(); }));
+  }
+
+  EXPECT_EQ(registry_.remove(1), nullptr);
+}
+
+TEST_F(ShadowTreeRegistryTest, enumerateVisitsEveryTreeUntilStopped) {
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 64; surfaceId++) {
+    registry_.add(makeShadowTree(surfaceId));
+  }
+
+  auto visitedSurfaceIds = std::vector<bool>(65, false);
+  registry_.enumerate([&](const ShadowTree& shadowTree, bool& /*stop*/) {
+    EXPECT_FALSE(visitedSurfaceIds[shadowTree.getSurfaceId()]);
+    visitedSurfaceIds[shadowTree.getSurfaceId()] = true;
+  });
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 64; surfaceId++) {
+    EXPECT_TRUE(visitedSurfaceIds[surfaceId]);
+  }
+
+  auto count = 0;
+  registry_.enumerate([&](const ShadowTree& /*shadowTree*/, bool& stop) {
+    count++;
+    stop = count == 3;
+  });
+  EXPECT_EQ(count, 3);
+
+  for (auto surfaceId = SurfaceId{1}; surfaceId <= 64; surfaceId++) {
+    registry_.remove(surfaceId);
+  }
+}
+
+TEST_F(ShadowTreeRegistryTest, visitingIsSafeWhileTreesAreReplaced) {
+  constexpr auto surfaceCount = SurfaceId{32};
+  constexpr auto readerCount = 4;
+
+  for (auto surfaceId = SurfaceId{0}; surfaceId < surfaceCount; surfaceId++) {
+    registry_.add(makeShadowTree(surfaceId));
+  }
+
+  auto done = std::atomic<bool>{false};
+  auto visitCount = std::atomic<int>{0};
+  auto readers = std::vector<std::thread>{};
+  for (auto reader = 0; reader < readerCount; reader++) {
+    readers.emplace_back([&, reader]() {
+      auto surfaceId = SurfaceId{reader};
+      while (!done) {
+        surfaceId = (surfaceId + 7) % surfaceCount;
+        registry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+          // Touching the tree after it was destroyed would be caught by
+          // sanitizers, and most likely by this check too.
+          EXPECT_EQ(shadowTree.getSurfaceId(), surfaceId);
+          EXPECT_NE(shadowTree.getCurrentRevision().rootShadowNode, nullptr);
+          visitCount++;
+        });
+        registry_.enumerate([&](const ShadowTree& shadowTree, bool& stop) {
+          EXPECT_LT(shadowTree.getSurfaceId(), surfaceCount);
+          stop = shadowTree.getSurfaceId() == surfaceId;
+        });
+      }
+    });
+  }
+
+  // Removed trees are destroyed right away, while readers keep visiting.
+  // Failures must not return early, as the readers have to be joined first.
+  for (auto iteration = 0; iteration < 2000; iteration++) {
+    auto surfaceId = SurfaceId{iteration % surfaceCount};
+    auto shadowTree = registry_.remove(surfaceId);
+    EXPECT_NE(shadowTree, nullptr);
+    if (shadowTree == nullptr) {
+      continue;
+    }
+    shadowTree.reset();
+    registry_.add(makeShadowTree(surfaceId));
+  }
+
+  while (visitCount == 0) {
+    std::this_thread::yield();
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_GT(visitCount, 0);
+
+  for (auto surfaceId = SurfaceId{0}; surfaceId < surfaceCount; surfaceId++) {
+    EXPECT_NE(registry_.remove(surfaceId), nullptr);
+  }
+}
+
+TEST_F(ShadowTreeRegistryTest, addingDoesNotWaitForReaders) {
+  constexpr auto surfaceCount = SurfaceId{64};
+  registry_.add(makeShadowTree(0));
+
+  auto visiting = std::atomic<bool>{false};
+  auto released = std::atomic<bool>{false};
+  auto reader = std::thread([&]() {
+    registry_.visit(0, [&](const ShadowTree& /*shadowTree*/) {
+      visiting = true;
+      visiting.notify_all();
+      released.wait(false);
+    });
+  });
+  visiting.wait(false);
+
+  // Some of these share a shard with the tree being visited; adding them
+  // would never finish if it waited for the reader.
+  for (auto surfaceId = SurfaceId{1}; surfaceId < surfaceCount; surfaceId++) {
+    registry_.add(makeShadowTree(surfaceId));
+  }
+
+  released = true;
+  released.notify_all();
+  reader.join();
+
+  for (auto surfaceId = SurfaceId{0}; surfaceId < surfaceCount; surfaceId++) {
+    EXPECT_NE(registry_.remove(surfaceId), nullptr);
+  }
+}
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * End-to-end benchmarks of the rendering pipeline: commit (including layout),
+ * layout alone, diffing and mounting (applying mutations to a
+ * `StubViewTree`) of trees of various shapes.
+ *
+ * Besides time, every benchmark reports the number of heap allocations
+ * (`allocations`, per iteration) and peak heap usage above the baseline
+ * (`peakBytes`) of the measured phase. Use `--benchmark_format=json` (or
+ * `--benchmark_out=<file> --benchmark_out_format=json`) to get results in a
+ * machine-readable form.
+ *
+ * Text is never measured: the platform `TextLayoutManager` needs the host
+ * platform (JNI on Android), so paragraphs have fixed sizes and double text
+ * measurement is disabled. Text measurement is covered by
+ * `TextLayoutBenchmark`.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/components/text/ParagraphShadowNode.h>
+#include <react/renderer/components/text/RawTextShadowNode.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+
+#pragma mark - Allocation tracking
+
+namespace {
+
+/*
+ * Every allocation is prefixed with its size, so that the amount of live
+ * memory can be tracked on deallocation.
+ */
+constexpr size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+std::atomic<int64_t> allocationCount{0};
+std::atomic<int64_t> liveBytes{0};
+std::atomic<int64_t> peakLiveBytes{0};
+
+} // namespace
+
+void* operator new(size_t size) {
+  auto* allocation =
+      static_cast<char*>(std::malloc(size + kAllocationHeaderSize));
+  if (allocation == nullptr) {
+    throw std::bad_alloc{};
+  }
+  *reinterpret_cast<size_t*>(allocation) = size;
+
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  auto bytes = liveBytes.fetch_add(
+                   static_cast<int64_t>(size), std::memory_order_relaxed) +
+      static_cast<int64_t>(size);
+  auto peak = peakLiveBytes.load(std::memory_order_relaxed);
+  while (bytes > peak &&
+         !peakLiveBytes.compare_exchange_weak(
+             peak, bytes, std::memory_order_relaxed)) {
+  }
+
+  return allocation + kAllocationHeaderSize;
+}
+
+void operator delete(void* pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto* allocation = static_cast<char*>(pointer) - kAllocationHeaderSize;
+  liveBytes.fetch_sub(
+      static_cast<int64_t>(*reinterpret_cast<size_t*>(allocation)),
+      std::memory_order_relaxed);
+  std::free(allocation);
+}
+
+namespace facebook::react {
+
+/*
+ * Accumulates allocation statistics of the measured part of benchmark
+ * iterations and reports them as benchmark counters.
+ */
+class PhaseMeter final {
+ public:
+  explicit PhaseMeter(benchmark::State& state) : state_(state) {}
+
+  ~PhaseMeter() {
+    state_.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(allocations_), benchmark::Counter::kAvgIterations);
+    state_.counters["peakBytes"] = static_cast<double>(peakBytes_);
+  }
+
+  /*
+   * Starts measuring; timing must be paused when called.
+   */
+  void start() {
+    baselineAllocationCount_ = allocationCount.load();
+    baselineBytes_ = liveBytes.load();
+    peakLiveBytes.store(baselineBytes_);
+    state_.ResumeTiming();
+  }
+
+  /*
+   * Stops collecting allocation statistics (timing stops at the end of the
+   * iteration).
+   */
+  void stop() {
+    allocations_ += allocationCount.load() - baselineAllocationCount_;
+    peakBytes_ = std::max(peakBytes_, peakLiveBytes.load() - baselineBytes_);
+  }
+
+ private:
+  benchmark::State& state_;
+  int64_t allocations_{0};
+  int64_t peakBytes_{0};
+  int64_t baselineAllocationCount_{0};
+  int64_t baselineBytes_{0};
+};
+
+#pragma mark - Trees
+
+enum class TreeShape {
+  // A single chain of nested views.
+  Deep,
+  // A single container with all views as its children.
+  Wide,
+  // Containers of fixed-size paragraphs, each with a single raw text child.
+  TextHeavy,
+  // A balanced tree of layout-only views, which are flattened away; only the
+  // leaves form host views.
+  Flattened,
+};
+
+static constexpr SurfaceId kSurfaceId = 1;
+
+/*
+ * `ParagraphShadowNode::layout` measures text again unless this is enabled.
+ */
+class PipelineBenchmarkFeatureFlags : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool preventDoubleTextMeasure() override {
+    return true;
+  }
+};
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+static std::shared_ptr<const ViewShadowNodeProps> makeViewProps(
+    bool formsView) {
+  auto props = std::make_shared<ViewShadowNodeProps>();
+  auto& yogaStyle = props->yogaStyle;
+  yogaStyle.setPadding(yoga::Edge::All, yoga::value::points(1));
+  if (formsView) {
+    props->backgroundColor = colorFromComponents({0, 0, 1, 1});
+  }
+  return props;
+}
+
+static Element<ViewShadowNode> makeView(Tag& tag, bool formsView) {
+  auto element = Element<ViewShadowNode>();
+  element.tag(tag++).surfaceId(kSurfaceId).props(makeViewProps(formsView));
+  return element;
+}
+
+static Element<ParagraphShadowNode> makeParagraph(Tag& tag) {
+  auto text = Element<RawTextShadowNode>();
+  text.tag(tag++).surfaceId(kSurfaceId).props([&]() {
+    auto props = std::make_shared<RawTextProps>();
+    props->text = "Lorem ipsum dolor sit amet " + std::to_string(tag);
+    return props;
+  });
+
+  // With definite sizes, Yoga never calls the measure function of paragraphs.
+  auto paragraph = Element<ParagraphShadowNode>();
+  paragraph.tag(tag++).surfaceId(kSurfaceId).children({text}).props([]() {
+    auto props = std::make_shared<ParagraphProps>();
+    auto& yogaStyle = props->yogaStyle;
+    yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(200));
+    yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(20));
+    return props;
+  });
+  return paragraph;
+}
+
+static ElementFragment makeBalancedTree(Tag& tag, int nodeCount) {
+  constexpr int kFanOut = 4;
+  if (nodeCount <= 1) {
+    return makeView(tag, true);
+  }
+  auto element = makeView(tag, false);
+  auto children = std::vector<ElementFragment>{};
+  auto remaining = nodeCount - 1;
+  for (int i = 0; i < kFanOut && remaining > 0; i++) {
+    auto childCount = (remaining + kFanOut - i - 1) / (kFanOut - i);
+    children.push_back(makeBalancedTree(tag, childCount));
+    remaining -= childCount;
+  }
+  element.children(std::move(children));
+  return element;
+}
+
+/*
+ * Returns a tree of approximately `nodeCount` nodes of the given shape.
+ */
+static ElementFragment makeTree(TreeShape shape, int nodeCount) {
+  auto tag = Tag{kSurfaceId + 1};
+  switch (shape) {
+    case TreeShape::Deep: {
+      auto element = ElementFragment(makeView(tag, true));
+      for (int i = 1; i < nodeCount; i++) {
+        element = makeView(tag, true).children({element});
+      }
+      return element;
+    }
+    case TreeShape::Wide: {
+      auto children = std::vector<ElementFragment>{};
+      for (int i = 1; i < nodeCount; i++) {
+        children.push_back(makeView(tag, true));
+      }
+      return makeView(tag, true).children(std::move(children));
+    }
+    case TreeShape::TextHeavy: {
+      constexpr int kParagraphsPerContainer = 8;
+      auto containers = std::vector<ElementFragment>{};
+      for (int i = 0; i < nodeCount; i += kParagraphsPerContainer * 2 + 1) {
+        auto paragraphs = std::vector<ElementFragment>{};
+        for (int j = 0; j < kParagraphsPerContainer; j++) {
+          paragraphs.push_back(makeParagraph(tag));
+        }
+        containers.push_back(
+            makeView(tag, true).children(std::move(paragraphs)));
+      }
+      return makeView(tag, true).children(std::move(containers));
+    }
+    case TreeShape::Flattened:
+      return makeBalancedTree(tag, nodeCount);
+  }
+  return makeView(tag, true);
+}
+
+/*
+ * Owns a shadow tree and builds trees which can be committed into it.
+ */
+class Pipeline final {
+ public:
+  Pipeline()
+      : builder_(simpleComponentBuilder()),
+        shadowTree_(
+            kSurfaceId,
+            LayoutConstraints{{0, 0}, {1024, 1024}},
+            LayoutContext{},
+            delegate_,
+            contextContainer_) {}
+
+  ShadowNode::Shared build(TreeShape shape, int nodeCount) const {
+    return builder_.build(makeTree(shape, nodeCount));
+  }
+
+  RootShadowNode::Unshared makeRootShadowNode(
+      const ShadowNode::Shared& child) const {
+    return std::make_shared<RootShadowNode>(
+        *getEmptyRootShadowNode(),
+        ShadowNodeFragment{
+            .props = ShadowNodeFragment::propsPlaceholder(),
+            .children = std::make_shared<const ShadowNode::ListOfShared>(
+                ShadowNode::ListOfShared{child}),
+        });
+  }
+
+  void commit(const ShadowNode::Shared& child) const {
+    shadowTree_.commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return makeRootShadowNode(child);
+        },
+        {});
+  }
+
+  RootShadowNode::Shared getEmptyRootShadowNode() const {
+    return emptyRootShadowNode_;
+  }
+
+  RootShadowNode::Shared getCurrentRootShadowNode() const {
+    return shadowTree_.getCurrentRevision().rootShadowNode;
+  }
+
+ private:
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  DummyShadowTreeDelegate delegate_{};
+  ShadowTree shadowTree_;
+  RootShadowNode::Shared emptyRootShadowNode_{
+      shadowTree_.getCurrentRevision().rootShadowNode};
+};
+
+#pragma mark - Benchmarks
+
+/*
+ * Data used by an iteration is released during the setup of the next one (or
+ * after the loop), so deallocation is not measured.
+ */
+
+static void commitTree(benchmark::State& state, TreeShape shape) {
+  auto nodeCount = static_cast<int>(state.range(0));
+  auto pipeline = std::unique_ptr<Pipeline>{};
+  auto tree = ShadowNode::Shared{};
+  auto meter = PhaseMeter{state};
+  for (auto _ : state) {
+    state.PauseTiming();
+    pipeline = nullptr;
+    pipeline = std::make_unique<Pipeline>();
+    tree = pipeline->build(shape, nodeCount);
+    meter.start();
+    pipeline->commit(tree);
+    meter.stop();
+  }
+  state.SetItemsProcessed(state.iterations() * nodeCount);
+}
+
+static void layoutTree(benchmark::State& state, TreeShape shape) {
+  auto nodeCount = static_cast<int>(state.range(0));
+  auto pipeline = Pipeline{};
+  auto rootShadowNode = RootShadowNode::Unshared{};
+  auto meter = PhaseMeter{state};
+  for (auto _ : state) {
+    state.PauseTiming();
+    rootShadowNode =
+        pipeline.makeRootShadowNode(pipeline.build(shape, nodeCount));
+    meter.start();
+    rootShadowNode->layoutIfNeeded();
+    meter.stop();
+  }
+  state.SetItemsProcessed(state.iterations() * nodeCount);
+}
+
+static void diffTree(benchmark::State& state, TreeShape shape) {
+  auto nodeCount = static_cast<int>(state.range(0));
+  auto pipeline = Pipeline{};
+  pipeline.commit(pipeline.build(shape, nodeCount));
+  auto emptyRootShadowNode = pipeline.getEmptyRootShadowNode();
+  auto rootShadowNode = pipeline.getCurrentRootShadowNode();
+
+  auto mutations = ShadowViewMutation::List{};
+  auto meter = PhaseMeter{state};
+  for (auto _ : state) {
+    state.PauseTiming();
+    mutations = {};
+    meter.start();
+    mutations =
+        calculateShadowViewMutations(*emptyRootShadowNode, *rootShadowNode);
+    meter.stop();
+  }
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+  state.SetItemsProcessed(state.iterations() * nodeCount);
+}
+
+static void mountTree(benchmark::State& state, TreeShape shape) {
+  auto nodeCount = static_cast<int>(state.range(0));
+  auto pipeline = Pipeline{};
+  pipeline.commit(pipeline.build(shape, nodeCount));
+  auto emptyRootShadowNode = pipeline.getEmptyRootShadowNode();
+  auto mutations = calculateShadowViewMutations(
+      *emptyRootShadowNode, *pipeline.getCurrentRootShadowNode());
+
+  auto viewTree = std::unique_ptr<StubViewTree>{};
+  auto meter = PhaseMeter{state};
+  for (auto _ : state) {
+    state.PauseTiming();
+    viewTree = nullptr;
+    viewTree = std::make_unique<StubViewTree>(
+        buildStubViewTreeWithoutUsingDifferentiator(*emptyRootShadowNode));
+    meter.start();
+    viewTree->mutate(mutations);
+    meter.stop();
+  }
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+  state.SetItemsProcessed(state.iterations() * nodeCount);
+}
+
+#define PIPELINE_BENCHMARK(phase)                                   \
+  BENCHMARK_CAPTURE(phase, deep, TreeShape::Deep)->Arg(128)->Arg(512); \
+  BENCHMARK_CAPTURE(phase, wide, TreeShape::Wide)                     \
+      ->Arg(256)                                                      \
+      ->Arg(4096);                                                    \
+  BENCHMARK_CAPTURE(phase, textHeavy, TreeShape::TextHeavy)           \
+      ->Arg(256)                                                      \
+      ->Arg(4096);                                                    \
+  BENCHMARK_CAPTURE(phase, flattened, TreeShape::Flattened)           \
+      ->Arg(256)                                                      \
+      ->Arg(4096);
+
+PIPELINE_BENCHMARK(commitTree)
+PIPELINE_BENCHMARK(layoutTree)
+PIPELINE_BENCHMARK(diffTree)
+PIPELINE_BENCHMARK(mountTree)
+
+} // namespace facebook::react
+
+int main(int argc, char** argv) {
+  facebook::react::ReactNativeFeatureFlags::override(
+      std::make_unique<facebook::react::PipelineBenchmarkFeatureFlags>());
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
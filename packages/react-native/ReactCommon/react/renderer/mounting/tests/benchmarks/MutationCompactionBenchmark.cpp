@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/compactShadowViewMutations.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+/*
+ * Produces mutation lists of `revisionCount` consecutive random revisions of
+ * a tree of `treeSize` nodes, as if the mounting layer fell behind.
+ */
+static std::vector<ShadowViewMutation::List> generateMutationLists(
+    int treeSize,
+    int revisionCount) {
+  auto entropy = Entropy(42);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+  PropsParserContext parserContext{-1, *contextContainer};
+
+  auto family =
+      rootComponentDescriptor.createFamily({Tag(1), SurfaceId(1), nullptr});
+  auto emptyRootNode = std::const_pointer_cast<RootShadowNode>(
+      std::static_pointer_cast<const RootShadowNode>(
+          rootComponentDescriptor.createShadowNode(
+              ShadowNodeFragment{RootShadowNode::defaultSharedProps()},
+              family)));
+  emptyRootNode = emptyRootNode->clone(
+      parserContext,
+      LayoutConstraints{
+          Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+      LayoutContext{});
+
+  auto currentRootNode = std::static_pointer_cast<const RootShadowNode>(
+      emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+          ShadowNodeFragment::propsPlaceholder(),
+          std::make_shared<ShadowNode::ListOfShared>(ShadowNode::ListOfShared{
+              generateShadowNodeTree(
+                  entropy, viewComponentDescriptor, treeSize)})}));
+
+  auto mutationLists = std::vector<ShadowViewMutation::List>{};
+  for (int i = 0; i < revisionCount; i++) {
+    auto nextRootNode = currentRootNode;
+    alterShadowTree(
+        entropy,
+        nextRootNode,
+        {
+            &messWithChildren,
+            &messWithYogaStyles,
+            &messWithLayoutableOnlyFlag,
+            &messWithNodeFlattenednessFlags,
+        });
+    std::const_pointer_cast<RootShadowNode>(nextRootNode)->layoutIfNeeded();
+    nextRootNode->sealRecursive();
+    mutationLists.push_back(
+        calculateShadowViewMutations(*currentRootNode, *nextRootNode));
+    currentRootNode = nextRootNode;
+  }
+  return mutationLists;
+}
+
+static void compactAccumulatedRevisions(benchmark::State& state) {
+  auto mutationLists = generateMutationLists(
+      static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+
+  auto mutationCount = size_t{0};
+  for (const auto& list : mutationLists) {
+    mutationCount += list.size();
+  }
+
+  auto compactedMutationCount = size_t{0};
+  for (auto _ : state) {
+    auto compactedMutations = compactShadowViewMutations(mutationLists);
+    compactedMutationCount = compactedMutations.size();
+    benchmark::DoNotOptimize(compactedMutations);
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+  state.counters["compactedMutations"] =
+      static_cast<double>(compactedMutationCount);
+  state.SetItemsProcessed(state.iterations() * mutationCount);
+}
+BENCHMARK(compactAccumulatedRevisions)
+    ->Args({256, 4})
+    ->Args({256, 16})
+    ->Args({1024, 16})
+    ->Args({1024, 64});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ReclamationQueue.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+/*
+ * Builds trees of `treeSize` nodes, standing for screens which are navigated
+ * away from. Measures how long the thread dropping the last reference to such
+ * a tree (the main thread, after mounting the next screen) is busy.
+ */
+class ScreenTreeFactory {
+ public:
+  ScreenTreeFactory()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        parameters_{EventDispatcher::Shared{}, contextContainer_, nullptr},
+        viewComponentDescriptor_(parameters_),
+        rootComponentDescriptor_(parameters_) {
+    contextContainer_->insert(
+        "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+  }
+
+  RootShadowNode::Shared build(int treeSize) {
+    auto family =
+        rootComponentDescriptor_.createFamily({Tag(1), SurfaceId(1), nullptr});
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootComponentDescriptor_.createShadowNode(
+            ShadowNodeFragment{
+                RootShadowNode::defaultSharedProps(),
+                std::make_shared<ShadowNode::ListOfShared>(
+                    ShadowNode::ListOfShared{generateShadowNodeTree(
+                        entropy_, viewComponentDescriptor_, treeSize)}),
+            },
+            family));
+  }
+
+ private:
+  Entropy entropy_{42};
+  ContextContainer::Shared contextContainer_;
+  ComponentDescriptorParameters parameters_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  RootComponentDescriptor rootComponentDescriptor_;
+};
+
+static void releaseScreenInline(benchmark::State& state) {
+  auto factory = ScreenTreeFactory{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto rootShadowNode = factory.build(static_cast<int>(state.range(0)));
+    state.ResumeTiming();
+
+    rootShadowNode.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(releaseScreenInline)->Arg(1000)->Arg(10000);
+
+static void retireScreen(benchmark::State& state) {
+  auto factory = ScreenTreeFactory{};
+  auto queue = ReclamationQueue{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    // Screens aren't left faster than the worker reclaims them.
+    queue.flush();
+    auto rootShadowNode = factory.build(static_cast<int>(state.range(0)));
+    state.ResumeTiming();
+
+    queue.retire(std::move(rootShadowNode));
+  }
+  queue.flush();
+
+  auto telemetry = queue.getTelemetry();
+  state.counters["reclaimedNodes"] = telemetry.reclaimedNodeCount;
+  state.counters["reclamationUs"] = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          telemetry.reclamationDuration)
+          .count());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(retireScreen)->Arg(1000)->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
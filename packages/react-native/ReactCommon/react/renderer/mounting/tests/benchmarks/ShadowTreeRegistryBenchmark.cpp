@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+namespace facebook::react {
+
+class BenchmarkShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+constexpr auto kSurfaceCount = SurfaceId{64};
+
+static BenchmarkShadowTreeDelegate shadowTreeDelegate{};
+static ContextContainer contextContainer{};
+
+/*
+ * Registry with `kSurfaceCount` surfaces, tagged the way root tags are
+ * generated (1, 11, 21, ...), shared by all benchmark threads. It is
+ * intentionally leaked as the registry must be empty when destroyed.
+ */
+static ShadowTreeRegistry& sharedRegistry() {
+  static auto* registry = []() {
+    auto* registry = new ShadowTreeRegistry();
+    for (auto index = SurfaceId{0}; index < kSurfaceCount; index++) {
+      registry->add(std::make_unique<ShadowTree>(
+          index * 10 + 1,
+          LayoutConstraints{},
+          LayoutContext{},
+          shadowTreeDelegate,
+          contextContainer));
+    }
+    return registry;
+  }();
+  return *registry;
+}
+
+static void visitSurface(benchmark::State& state) {
+  const auto& registry = sharedRegistry();
+  auto index = SurfaceId(state.thread_index());
+  for (auto _ : state) {
+    index = (index + 1) % kSurfaceCount;
+    registry.visit(index * 10 + 1, [](const ShadowTree& shadowTree) {
+      benchmark::DoNotOptimize(shadowTree.getSurfaceId());
+    });
+  }
+}
+BENCHMARK(visitSurface)->ThreadRange(1, 8)->UseRealTime();
+
+static void visitSurfaceWhileReplacing(benchmark::State& state) {
+  const auto& registry = sharedRegistry();
+  auto index = SurfaceId(state.thread_index());
+  for (auto _ : state) {
+    index = (index + 1) % kSurfaceCount;
+    auto surfaceId = index * 10 + 1;
+    if (state.thread_index() == 0 && index == 0) {
+      // One thread keeps starting and stopping a surface.
+      registry.add(registry.remove(surfaceId));
+      continue;
+    }
+    registry.visit(surfaceId, [](const ShadowTree& shadowTree) {
+      benchmark::DoNotOptimize(shadowTree.getSurfaceId());
+    });
+  }
+}
+BENCHMARK(visitSurfaceWhileReplacing)->ThreadRange(2, 8)->UseRealTime();
+
+static void enumerateSurfaces(benchmark::State& state) {
+  const auto& registry = sharedRegistry();
+  for (auto _ : state) {
+    auto count = 0;
+    registry.enumerate([&](const ShadowTree& /*shadowTree*/, bool& /*stop*/) {
+      count++;
+    });
+    benchmark::DoNotOptimize(count);
+  }
+}
+BENCHMARK(enumerateSurfaces)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
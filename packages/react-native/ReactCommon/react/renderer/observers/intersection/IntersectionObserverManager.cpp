@@ -47,7 +47,7 @@ void IntersectionObserverManager::observe(
   RootShadowNode::Shared rootShadowNode = nullptr;
   shadowTreeRegistry.visit(surfaceId, [&](const ShadowTree& shadowTree) {
     mountingCoordinator = shadowTree.getMountingCoordinator();
-    rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+    rootShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
   });
   auto hasPendingTransactions = mountingCoordinator != nullptr &&
       mountingCoordinator->hasPendingTransactions();
@@ -12,11 +12,18 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/consistency/ScopedShadowTreeRevisionLock.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
 #include <react/utils/OnScopeExit.h>
 #include <utility>
 
 namespace facebook::react {
 
+namespace {
+// Whether the current thread is executing a task of a runtime scheduler,
+// and will hence run its "Update the rendering" step afterwards.
+thread_local bool isExecutingTask{false};
+} // namespace
+
 #pragma mark - Public
 
 RuntimeScheduler_Modern::RuntimeScheduler_Modern(
@@ -144,7 +151,19 @@ void RuntimeScheduler_Modern::scheduleRenderingUpdate(
   SystraceSection s("RuntimeScheduler::scheduleRenderingUpdate");
 
   if (ReactNativeFeatureFlags::batchRenderingUpdatesInEventLoop()) {
-    pendingRenderingUpdates_.push(renderingUpdate);
+    {
+      std::scoped_lock lock(pendingRenderingUpdatesMutex_);
+      pendingRenderingUpdates_.push(std::move(renderingUpdate));
+    }
+
+    // Pipelined commits finish on the commit pipeline thread, outside of any
+    // task, so their updates are flushed by an empty task. Other updates
+    // scheduled outside of a task wait for the next one, as before.
+    if (CoreFeatures::enablePipelinedCommits && !isExecutingTask) {
+      scheduleTask(
+          SchedulerPriority::ImmediatePriority,
+          [](jsi::Runtime& /*runtime*/) {});
+    }
   } else {
     if (renderingUpdate != nullptr) {
       renderingUpdate();
@@ -258,6 +277,10 @@ void RuntimeScheduler_Modern::executeTask(
   currentTask_ = &task;
   currentPriority_ = task.priority;
 
+  auto wasExecutingTask = isExecutingTask;
+  isExecutingTask = true;
+  OnScopeExit restoreFlag([&]() { isExecutingTask = wasExecutingTask; });
+
   {
     ScopedShadowTreeRevisionLock revisionLock(
         shadowTreeRevisionConsistencyManager_);
@@ -286,12 +309,18 @@ void RuntimeScheduler_Modern::executeTask(
 void RuntimeScheduler_Modern::updateRendering() {
   SystraceSection s("RuntimeScheduler::updateRendering");
 
-  while (!pendingRenderingUpdates_.empty()) {
-    auto& pendingRenderingUpdate = pendingRenderingUpdates_.front();
-    if (pendingRenderingUpdate != nullptr) {
-      pendingRenderingUpdate();
+  std::queue<RuntimeSchedulerRenderingUpdate> renderingUpdates;
+  {
+    std::scoped_lock lock(pendingRenderingUpdatesMutex_);
+    std::swap(renderingUpdates, pendingRenderingUpdates_);
+  }
+
+  while (!renderingUpdates.empty()) {
+    auto& renderingUpdate = renderingUpdates.front();
+    if (renderingUpdate != nullptr) {
+      renderingUpdate();
     }
-    pendingRenderingUpdates_.pop();
+    renderingUpdates.pop();
   }
 }
 
@@ -14,6 +14,7 @@
 #include <react/renderer/runtimescheduler/Task.h>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 
@@ -118,6 +119,8 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
    * platform, to be executed during the "Update the rendering" step of the
    * event loop. If the step is not enabled, the function is executed
    * immediately.
+   * Can be called from any thread. If it is not called from a task, a task
+   * is scheduled to run the step.
    */
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
@@ -187,6 +190,10 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
    */
   bool isWorkLoopScheduled_{false};
 
+  /**
+   * This protects the access to `pendingRenderingUpdates_`.
+   */
+  std::mutex pendingRenderingUpdatesMutex_;
   std::queue<RuntimeSchedulerRenderingUpdate> pendingRenderingUpdates_;
   ShadowTreeRevisionConsistencyManager* shadowTreeRevisionConsistencyManager_{
       nullptr};
@@ -11,8 +11,10 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/utils/CoreFeatures.h>
 #include <memory>
 #include <semaphore>
+#include <thread>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -83,6 +85,7 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
 
   void TearDown() override {
     ReactNativeFeatureFlags::dangerouslyReset();
+    CoreFeatures::enablePipelinedCommits = false;
   }
 
   jsi::Function createHostFunctionFromLambda(
@@ -221,6 +224,60 @@ TEST_P(
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, scheduleBatchedRenderingUpdateOutsideOfTask) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  forcedBatchRenderingUpdatesInEventLoop = true;
+  CoreFeatures::enablePipelinedCommits = true;
+
+  bool didRunRenderingUpdate = false;
+
+  // Like pipelined commits, which finish on the commit pipeline thread.
+  std::thread([&]() {
+    runtimeScheduler_->scheduleRenderingUpdate(
+        [&]() { didRunRenderingUpdate = true; });
+  }).join();
+
+  EXPECT_FALSE(didRunRenderingUpdate);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunRenderingUpdate);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_P(
+    RuntimeSchedulerTest,
+    scheduleBatchedRenderingUpdateOutsideOfTaskWithoutPipelinedCommits) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  forcedBatchRenderingUpdatesInEventLoop = true;
+
+  bool didRunRenderingUpdate = false;
+
+  std::thread([&]() {
+    runtimeScheduler_->scheduleRenderingUpdate(
+        [&]() { didRunRenderingUpdate = true; });
+  }).join();
+
+  // The update waits for the next task instead of scheduling one.
+  EXPECT_FALSE(didRunRenderingUpdate);
+  EXPECT_EQ(stubQueue_->size(), 0);
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, [](jsi::Runtime& /*runtime*/) {});
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunRenderingUpdate);
+}
+
 TEST_P(RuntimeSchedulerTest, scheduleImmediatePriorityTask) {
   bool didRunTask = false;
   auto callback =
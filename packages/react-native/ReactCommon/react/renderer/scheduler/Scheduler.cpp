@@ -93,11 +93,19 @@ Scheduler::Scheduler(
     uiManager->updateState(stateUpdate);
   };
 
+  auto stateBatchPipe = [uiManager](std::vector<StateUpdate>&& stateUpdates) {
+    uiManager->updateStates(std::move(stateUpdates));
+  };
+
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
   eventDispatcher_->emplace(
       EventQueueProcessor(
-          eventPipe, eventPipeConclusion, statePipe, eventPerformanceLogger_),
+          eventPipe,
+          eventPipeConclusion,
+          statePipe,
+          eventPerformanceLogger_,
+          stateBatchPipe),
       schedulerToolbox.asynchronousEventBeatFactory,
       eventOwnerBox,
       *runtimeScheduler,
@@ -155,6 +163,23 @@ Scheduler::Scheduler(
       reactNativeConfig_->getBool(
           "react_fabric:enable_granular_shadow_tree_state_reconciliation");
 
+  CoreFeatures::enablePipelinedCommits =
+      reactNativeConfig_->getBool("react_fabric:enable_pipelined_commits");
+
+#ifndef ANDROID
+  CoreFeatures::enableMutationCompaction =
+      reactNativeConfig_->getBool("react_fabric:enable_mutation_compaction");
+#endif
+
+  CoreFeatures::enableDeferredReclamation =
+      reactNativeConfig_->getBool("react_fabric:enable_deferred_reclamation");
+
+  CoreFeatures::enablePooledShadowNodes =
+      reactNativeConfig_->getBool("react_fabric:enable_pooled_shadow_nodes");
+
+  CoreFeatures::enableBatchedStateUpdates =
+      reactNativeConfig_->getBool("react_fabric:enable_batched_state_updates");
+
   CoreFeatures::enableReportEventPaintTime = reactNativeConfig_->getBool(
       "rn_responsiveness_performance:enable_paint_time_reporting");
 
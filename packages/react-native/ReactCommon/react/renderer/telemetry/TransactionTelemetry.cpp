@@ -84,9 +84,12 @@ void TransactionTelemetry::didLayout() {
   layoutEndTime_ = now_();
 }
 
-void TransactionTelemetry::didLayout(int affectedLayoutNodesCount) {
+void TransactionTelemetry::didLayout(
+    int affectedLayoutNodesCount,
+    int skippedLayoutSubtreesCount) {
   didLayout();
   affectedLayoutNodesCount_ = affectedLayoutNodesCount;
+  skippedLayoutSubtreesCount_ = skippedLayoutSubtreesCount;
 }
 
 void TransactionTelemetry::willMount() {
@@ -169,4 +172,8 @@ int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
 
+int TransactionTelemetry::getSkippedLayoutSubtreesCount() const {
+  return skippedLayoutSubtreesCount_;
+}
+
 } // namespace facebook::react
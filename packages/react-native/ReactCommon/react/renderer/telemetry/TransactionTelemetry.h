@@ -43,7 +43,9 @@ class TransactionTelemetry final {
   void willMeasureText();
   void didMeasureText();
   void didLayout();
-  void didLayout(int affectedLayoutNodesCount);
+  void didLayout(
+      int affectedLayoutNodesCount,
+      int skippedLayoutSubtreesCount);
   void willMount();
   void didMount();
 
@@ -67,6 +69,12 @@ class TransactionTelemetry final {
 
   int getAffectedLayoutNodesCount() const;
 
+  /*
+   * Number of subtrees which layout didn't read back because nothing in them
+   * had a new layout. This is not the number of nodes in those subtrees.
+   */
+  int getSkippedLayoutSubtreesCount() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
@@ -85,6 +93,7 @@ class TransactionTelemetry final {
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
+  int skippedLayoutSubtreesCount_{0};
 };
 
 } // namespace facebook::react
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontMetrics.h"
+#include "LineBreaker.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Bounds-checked reader of big-endian values of an OpenType font.
+ */
+class FontDataReader {
+ public:
+  explicit FontDataReader(std::string_view data) : data_(data) {}
+
+  bool contains(size_t offset, size_t length) const {
+    return offset <= data_.size() && length <= data_.size() - offset;
+  }
+
+  uint16_t uint16(size_t offset) const {
+    if (!contains(offset, 2)) {
+      valid_ = false;
+      return 0;
+    }
+    return static_cast<uint16_t>(
+        (static_cast<uint8_t>(data_[offset]) << 8) |
+        static_cast<uint8_t>(data_[offset + 1]));
+  }
+
+  int16_t int16(size_t offset) const {
+    return static_cast<int16_t>(uint16(offset));
+  }
+
+  uint32_t uint32(size_t offset) const {
+    return (static_cast<uint32_t>(uint16(offset)) << 16) | uint16(offset + 2);
+  }
+
+  bool isValid() const {
+    return valid_;
+  }
+
+ private:
+  std::string_view data_;
+  mutable bool valid_{true};
+};
+
+struct TableRecord {
+  size_t offset;
+  size_t length;
+};
+
+std::optional<TableRecord> findTable(
+    const FontDataReader& reader,
+    std::string_view tag) {
+  auto numTables = reader.uint16(4);
+  for (size_t index = 0; index < numTables; index++) {
+    auto recordOffset = 12 + index * 16;
+    auto recordTag = reader.uint32(recordOffset);
+    auto expectedTag = (static_cast<uint32_t>(tag[0]) << 24) |
+        (static_cast<uint32_t>(tag[1]) << 16) |
+        (static_cast<uint32_t>(tag[2]) << 8) | static_cast<uint32_t>(tag[3]);
+    if (recordTag == expectedTag) {
+      auto table = TableRecord{
+          reader.uint32(recordOffset + 8), reader.uint32(recordOffset + 12)};
+      if (!reader.contains(table.offset, table.length)) {
+        return std::nullopt;
+      }
+      return table;
+    }
+  }
+  return std::nullopt;
+}
+
+/*
+ * Calls `callback(codePoint, glyphId)` for every mapping of a `cmap`
+ * subtable in format 4 (BMP) or 12 (full Unicode range).
+ */
+template <typename CallbackT>
+bool enumerateCharacterMap(
+    const FontDataReader& reader,
+    size_t offset,
+    CallbackT&& callback) {
+  auto format = reader.uint16(offset);
+
+  if (format == 4) {
+    size_t segmentCount = reader.uint16(offset + 6) / 2;
+    auto endCodes = offset + 14;
+    auto startCodes = endCodes + segmentCount * 2 + 2;
+    auto idDeltas = startCodes + segmentCount * 2;
+    auto idRangeOffsets = idDeltas + segmentCount * 2;
+    for (size_t segment = 0; segment < segmentCount; segment++) {
+      auto endCode = reader.uint16(endCodes + segment * 2);
+      auto startCode = reader.uint16(startCodes + segment * 2);
+      auto idDelta = reader.uint16(idDeltas + segment * 2);
+      auto idRangeOffsetPosition = idRangeOffsets + segment * 2;
+      auto idRangeOffset = reader.uint16(idRangeOffsetPosition);
+      if (startCode > endCode || endCode == 0xFFFF) {
+        continue;
+      }
+      for (uint32_t codePoint = startCode; codePoint <= endCode; codePoint++) {
+        uint16_t glyphId = 0;
+        if (idRangeOffset == 0) {
+          glyphId = static_cast<uint16_t>(codePoint + idDelta);
+        } else {
+          auto glyphIdPosition = idRangeOffsetPosition + idRangeOffset +
+              (codePoint - startCode) * 2;
+          glyphId = reader.uint16(glyphIdPosition);
+          if (glyphId != 0) {
+            glyphId = static_cast<uint16_t>(glyphId + idDelta);
+          }
+        }
+        if (glyphId != 0) {
+          callback(static_cast<char32_t>(codePoint), glyphId);
+        }
+      }
+    }
+    return reader.isValid();
+  }
+
+  if (format == 12) {
+    auto groupCount = reader.uint32(offset + 12);
+    for (size_t group = 0; group < groupCount && reader.isValid(); group++) {
+      auto groupOffset = offset + 16 + group * 12;
+      auto startCode = reader.uint32(groupOffset);
+      auto endCode = reader.uint32(groupOffset + 4);
+      auto startGlyphId = reader.uint32(groupOffset + 8);
+      if (startCode > endCode || endCode > 0x10FFFF) {
+        continue;
+      }
+      for (auto codePoint = startCode; codePoint <= endCode; codePoint++) {
+        callback(
+            static_cast<char32_t>(codePoint),
+            static_cast<uint32_t>(startGlyphId + (codePoint - startCode)));
+      }
+    }
+    return reader.isValid();
+  }
+
+  return false;
+}
+
+/*
+ * Finds the best Unicode subtable of a `cmap` table: full repertoire
+ * (format 12) first, then BMP (format 4).
+ */
+std::optional<size_t> findCharacterMap(
+    const FontDataReader& reader,
+    const TableRecord& cmap) {
+  auto bestOffset = std::optional<size_t>{};
+  auto bestFormat = 0;
+  auto subtableCount = reader.uint16(cmap.offset + 2);
+  for (size_t index = 0; index < subtableCount; index++) {
+    auto recordOffset = cmap.offset + 4 + index * 8;
+    auto platformId = reader.uint16(recordOffset);
+    auto encodingId = reader.uint16(recordOffset + 2);
+    auto subtableOffset = cmap.offset + reader.uint32(recordOffset + 4);
+    auto isUnicode = platformId == 0 ||
+        (platformId == 3 && (encodingId == 1 || encodingId == 10));
+    if (!isUnicode) {
+      continue;
+    }
+    auto format = reader.uint16(subtableOffset);
+    if ((format == 12 || format == 4) && format > bestFormat) {
+      bestFormat = format;
+      bestOffset = subtableOffset;
+    }
+  }
+  return bestOffset;
+}
+
+constexpr Float kDefaultUnitsPerEm = 1000;
+
+/*
+ * Advances of ASCII characters (32-126) of Helvetica, per 1000 units.
+ */
+constexpr std::array<uint16_t, 95> kDefaultAsciiAdvances = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333,
+    278, 278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278,
+    584, 584, 584, 556, 1015, 667, 667, 722, 722, 667, 611, 778, 722, 278,
+    500, 667, 556, 833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944,
+    667, 667, 611, 278, 278, 278, 469, 556, 333, 556, 556, 500, 556, 556,
+    278, 556, 556, 222, 222, 500, 222, 833, 556, 556, 556, 556, 333, 500,
+    278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584};
+
+} // namespace
+
+SharedFontMetrics FontMetrics::fromFile(const std::string& path) {
+  auto file = std::ifstream(path, std::ios::binary);
+  if (!file) {
+    return nullptr;
+  }
+  auto stream = std::ostringstream{};
+  stream << file.rdbuf();
+  return fromData(stream.str());
+}
+
+SharedFontMetrics FontMetrics::fromData(const std::string& data) {
+  auto reader = FontDataReader{data};
+
+  auto head = findTable(reader, "head");
+  auto hhea = findTable(reader, "hhea");
+  auto hmtx = findTable(reader, "hmtx");
+  auto cmap = findTable(reader, "cmap");
+  if (!head || !hhea || !hmtx || !cmap) {
+    return nullptr;
+  }
+
+  auto lineMetrics = LineMetrics{};
+  lineMetrics.unitsPerEm = reader.uint16(head->offset + 18);
+  lineMetrics.ascender = reader.int16(hhea->offset + 4);
+  lineMetrics.descender = reader.int16(hhea->offset + 6);
+  lineMetrics.lineGap = reader.int16(hhea->offset + 8);
+  size_t horizontalMetricCount = reader.uint16(hhea->offset + 34);
+  if (lineMetrics.unitsPerEm <= 0 || horizontalMetricCount == 0) {
+    return nullptr;
+  }
+
+  // Typographic cap and x heights are only available since OS/2 version 2.
+  lineMetrics.capHeight = lineMetrics.ascender * 0.7f;
+  lineMetrics.xHeight = lineMetrics.ascender * 0.5f;
+  if (auto os2 = findTable(reader, "OS/2");
+      os2 && reader.uint16(os2->offset) >= 2 && os2->length >= 90) {
+    lineMetrics.xHeight = reader.int16(os2->offset + 86);
+    lineMetrics.capHeight = reader.int16(os2->offset + 88);
+  }
+
+  auto characterMap = findCharacterMap(reader, *cmap);
+  if (!characterMap) {
+    return nullptr;
+  }
+
+  auto glyphAdvance = [&](uint32_t glyphId) -> Float {
+    // Glyphs past the last horizontal metric share its advance.
+    auto index = std::min<size_t>(glyphId, horizontalMetricCount - 1);
+    return reader.uint16(hmtx->offset + index * 4);
+  };
+
+  auto advances = std::unordered_map<char32_t, Float>{};
+  auto isValid = enumerateCharacterMap(
+      reader, *characterMap, [&](char32_t codePoint, uint32_t glyphId) {
+        advances.emplace(codePoint, glyphAdvance(glyphId));
+      });
+  if (!isValid || !reader.isValid()) {
+    return nullptr;
+  }
+
+  // Glyph 0 is `.notdef`, rendered for characters the font doesn't have.
+  auto defaultAdvance = glyphAdvance(0);
+  return std::make_shared<const FontMetrics>(
+      lineMetrics, std::move(advances), defaultAdvance);
+}
+
+const SharedFontMetrics& FontMetrics::defaultMetrics() {
+  static const auto metrics = []() {
+    auto advances = std::unordered_map<char32_t, Float>{};
+    for (size_t index = 0; index < kDefaultAsciiAdvances.size(); index++) {
+      advances.emplace(
+          static_cast<char32_t>(32 + index), kDefaultAsciiAdvances[index]);
+    }
+    advances.emplace(0x00A0, 278); // No-break space
+    advances.emplace(0x2026, 1000); // Ellipsis
+    // Line metrics of Arial, which shares Helvetica's widths.
+    auto lineMetrics = LineMetrics{
+        /* .unitsPerEm = */ kDefaultUnitsPerEm,
+        /* .ascender = */ 905,
+        /* .descender = */ -212,
+        /* .lineGap = */ 33,
+        /* .capHeight = */ 716,
+        /* .xHeight = */ 519,
+    };
+    return SharedFontMetrics{std::make_shared<const FontMetrics>(
+        lineMetrics, std::move(advances), 556)};
+  }();
+  return metrics;
+}
+
+FontMetrics::FontMetrics(
+    LineMetrics lineMetrics,
+    std::unordered_map<char32_t, Float> advances,
+    Float defaultAdvance)
+    : lineMetrics_(lineMetrics),
+      advances_(std::move(advances)),
+      defaultAdvance_(defaultAdvance) {
+  for (char32_t codePoint = 0; codePoint < asciiAdvances_.size();
+       codePoint++) {
+    auto iterator = advances_.find(codePoint);
+    // Control characters (line breaks, tabs) take no space unless the
+    // table says otherwise.
+    asciiAdvances_[codePoint] = iterator != advances_.end() ? iterator->second
+        : codePoint < 32                                    ? 0
+                                                            : defaultAdvance_;
+  }
+}
+
+const FontMetrics::LineMetrics& FontMetrics::getLineMetrics() const {
+  return lineMetrics_;
+}
+
+Float FontMetrics::getNonAsciiAdvance(char32_t codePoint) const {
+  auto iterator = advances_.find(codePoint);
+  if (iterator != advances_.end()) {
+    return iterator->second;
+  }
+  return isWideCodePoint(codePoint) ? defaultAdvance_ * 2 : defaultAdvance_;
+}
+
+} // namespace facebook::react
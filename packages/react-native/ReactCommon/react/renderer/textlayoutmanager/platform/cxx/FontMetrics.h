@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+class FontMetrics;
+
+using SharedFontMetrics = std::shared_ptr<const FontMetrics>;
+
+/*
+ * Horizontal metrics of a single font face: glyph advances by code point and
+ * vertical line metrics. All values are in font units; divide by
+ * `unitsPerEm` and multiply by the font size to get points.
+ */
+class FontMetrics final {
+ public:
+  /*
+   * Metrics of the font face, as found in the `hhea` and `OS/2` tables of an
+   * OpenType font. `descender` is negative.
+   */
+  struct LineMetrics {
+    Float unitsPerEm{1000};
+    Float ascender{0};
+    Float descender{0};
+    Float lineGap{0};
+    Float capHeight{0};
+    Float xHeight{0};
+  };
+
+  /*
+   * Loads the metrics of a TrueType or OpenType font file (`.ttf`, `.otf`).
+   * Reads the `head`, `hhea`, `hmtx`, `cmap` and (if present) `OS/2` tables.
+   * Returns `nullptr` if the file can't be read or isn't a supported font.
+   */
+  static SharedFontMetrics fromFile(const std::string& path);
+
+  /*
+   * Same as `fromFile`, from the contents of a font file.
+   */
+  static SharedFontMetrics fromData(const std::string& data);
+
+  /*
+   * Returns built-in metrics approximating a regular sans-serif face
+   * (Helvetica/Arial widths for ASCII, full-width CJK), used when no font is
+   * provided.
+   */
+  static const SharedFontMetrics& defaultMetrics();
+
+  /*
+   * Creates metrics from a generated table of advances.
+   * `defaultAdvance` is used for code points missing from `advances`, and
+   * twice that for wide (CJK) code points.
+   */
+  FontMetrics(
+      LineMetrics lineMetrics,
+      std::unordered_map<char32_t, Float> advances,
+      Float defaultAdvance);
+
+  const LineMetrics& getLineMetrics() const;
+
+  /*
+   * Returns the advance of the glyph of `codePoint`.
+   */
+  Float getAdvance(char32_t codePoint) const {
+    if (codePoint < asciiAdvances_.size()) {
+      return asciiAdvances_[codePoint];
+    }
+    return getNonAsciiAdvance(codePoint);
+  }
+
+ private:
+  Float getNonAsciiAdvance(char32_t codePoint) const;
+
+  LineMetrics lineMetrics_;
+  std::array<Float, 128> asciiAdvances_{};
+  std::unordered_map<char32_t, Float> advances_;
+  Float defaultAdvance_;
+};
+
+} // namespace facebook::react
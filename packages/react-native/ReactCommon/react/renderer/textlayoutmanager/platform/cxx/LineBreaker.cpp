@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "LineBreaker.h"
+
+namespace facebook::react {
+
+bool isWideCodePoint(char32_t codePoint) {
+  return (codePoint >= 0x1100 && codePoint <= 0x115F) || // Hangul Jamo
+      (codePoint >= 0x2E80 && codePoint <= 0x303E) || // CJK radicals, symbols
+      (codePoint >= 0x3041 && codePoint <= 0x33FF) || // Kana, CJK compat
+      (codePoint >= 0x3400 && codePoint <= 0x4DBF) || // CJK extension A
+      (codePoint >= 0x4E00 && codePoint <= 0x9FFF) || // CJK ideographs
+      (codePoint >= 0xA000 && codePoint <= 0xA4CF) || // Yi
+      (codePoint >= 0xAC00 && codePoint <= 0xD7A3) || // Hangul syllables
+      (codePoint >= 0xF900 && codePoint <= 0xFAFF) || // CJK compat ideographs
+      (codePoint >= 0xFF00 && codePoint <= 0xFF60) || // Full-width forms
+      (codePoint >= 0xFFE0 && codePoint <= 0xFFE6) ||
+      (codePoint >= 0x1F300 && codePoint <= 0x1F64F) || // Emoji
+      (codePoint >= 0x1F900 && codePoint <= 0x1F9FF) ||
+      (codePoint >= 0x20000 && codePoint <= 0x3FFFD); // CJK extensions B+
+}
+
+LineBreakClass getLineBreakClass(char32_t codePoint) {
+  if (codePoint < 0x80) {
+    switch (codePoint) {
+      case '\n':
+        return LineBreakClass::LineFeed;
+      case '\r':
+        return LineBreakClass::CarriageReturn;
+      case '\v':
+      case '\f':
+        return LineBreakClass::MandatoryBreak;
+      case ' ':
+        return LineBreakClass::Space;
+      case '\t':
+      case '-':
+        return LineBreakClass::Hyphen;
+      case '(':
+      case '[':
+      case '{':
+        return LineBreakClass::Open;
+      case ')':
+      case ']':
+      case '}':
+      case '!':
+      case '?':
+      case ',':
+      case '.':
+      case ':':
+      case ';':
+      case '/':
+        return LineBreakClass::Close;
+      default:
+        return LineBreakClass::Alphabetic;
+    }
+  }
+
+  switch (codePoint) {
+    case 0x0085: // Next line
+    case 0x2028: // Line separator
+    case 0x2029: // Paragraph separator
+      return LineBreakClass::MandatoryBreak;
+    case 0x00A0: // No-break space
+    case 0x202F: // Narrow no-break space
+    case 0x2060: // Word joiner
+    case 0xFEFF: // Zero width no-break space
+      return LineBreakClass::Glue;
+    case 0x200B:
+      return LineBreakClass::ZeroWidthSpace;
+    case 0x200D: // Zero width joiner
+      return LineBreakClass::CombiningMark;
+    case 0x00AD: // Soft hyphen
+    case 0x2010: // Hyphen
+    case 0x2013: // En dash
+    case 0x2014: // Em dash
+      return LineBreakClass::Hyphen;
+    case 0x3001: // Ideographic comma
+    case 0x3002: // Ideographic full stop
+    case 0xFF01: // Full-width exclamation mark
+    case 0xFF09: // Full-width right parenthesis
+    case 0xFF0C: // Full-width comma
+    case 0xFF1A: // Full-width colon
+    case 0xFF1B: // Full-width semicolon
+    case 0xFF1F: // Full-width question mark
+    case 0x300D: // Right corner bracket
+    case 0x300F: // Right white corner bracket
+      return LineBreakClass::Close;
+    case 0xFF08: // Full-width left parenthesis
+    case 0x300C: // Left corner bracket
+    case 0x300E: // Left white corner bracket
+      return LineBreakClass::Open;
+    default:
+      break;
+  }
+
+  if ((codePoint >= 0x0300 && codePoint <= 0x036F) ||
+      (codePoint >= 0xFE00 && codePoint <= 0xFE0F) ||
+      (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF)) {
+    // Combining diacritics, variation selectors and emoji modifiers.
+    return LineBreakClass::CombiningMark;
+  }
+
+  if (codePoint >= 0x2000 && codePoint <= 0x200A && codePoint != 0x2007) {
+    return LineBreakClass::Space;
+  }
+
+  if (isWideCodePoint(codePoint)) {
+    return LineBreakClass::Ideographic;
+  }
+
+  return LineBreakClass::Alphabetic;
+}
+
+LineBreakOpportunity getLineBreakOpportunity(
+    LineBreakClass before,
+    LineBreakClass after) {
+  // LB4, LB5: Always break after hard line breaks, but treat CR LF as one.
+  switch (before) {
+    case LineBreakClass::MandatoryBreak:
+    case LineBreakClass::LineFeed:
+      return LineBreakOpportunity::Mandatory;
+    case LineBreakClass::CarriageReturn:
+      return after == LineBreakClass::LineFeed
+          ? LineBreakOpportunity::None
+          : LineBreakOpportunity::Mandatory;
+    default:
+      break;
+  }
+
+  switch (after) {
+    // LB6, LB7: Don't break before hard line breaks, spaces or zero width
+    // spaces.
+    case LineBreakClass::MandatoryBreak:
+    case LineBreakClass::CarriageReturn:
+    case LineBreakClass::LineFeed:
+    case LineBreakClass::Space:
+    case LineBreakClass::ZeroWidthSpace:
+    // LB9: Don't separate combining marks from their base.
+    case LineBreakClass::CombiningMark:
+    // LB12a: Don't break before glue.
+    case LineBreakClass::Glue:
+    // LB13: Don't break before closing punctuation.
+    case LineBreakClass::Close:
+    // LB21: Don't break before hyphens.
+    case LineBreakClass::Hyphen:
+      return LineBreakOpportunity::None;
+    default:
+      break;
+  }
+
+  switch (before) {
+    // LB8: Break after zero width spaces; LB18: break after spaces.
+    case LineBreakClass::ZeroWidthSpace:
+    case LineBreakClass::Space:
+      return LineBreakOpportunity::Allowed;
+    // LB12: Don't break after glue; LB14: don't break after opening
+    // punctuation.
+    case LineBreakClass::Glue:
+    case LineBreakClass::Open:
+      return LineBreakOpportunity::None;
+    // LB21: Break after hyphens.
+    case LineBreakClass::Hyphen:
+      return LineBreakOpportunity::Allowed;
+    default:
+      break;
+  }
+
+  // LB31: Break around ideographs; LB28, LB30: don't break within words.
+  return before == LineBreakClass::Ideographic ||
+          after == LineBreakClass::Ideographic
+      ? LineBreakOpportunity::Allowed
+      : LineBreakOpportunity::None;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Line breaking classes of the Unicode Line Breaking Algorithm (UAX #14)
+ * which affect where text wraps. Classes with the same behaviour in the
+ * subset of rules implemented here share a value, e.g. `Close` covers the
+ * CL, CP, EX and IS classes.
+ * https://www.unicode.org/reports/tr14/
+ */
+enum class LineBreakClass : uint8_t {
+  Alphabetic, // AL (and everything not listed below)
+  Ideographic, // ID: CJK ideographs, kana, Hangul, full-width forms
+  Space, // SP
+  ZeroWidthSpace, // ZW
+  Glue, // GL: no-break spaces, word joiner
+  Hyphen, // HY, BA: break after, but not before
+  Open, // OP: no break after
+  Close, // CL, CP, EX, IS: no break before
+  CombiningMark, // CM, ZWJ: attaches to the previous character
+  MandatoryBreak, // BK
+  CarriageReturn, // CR
+  LineFeed, // LF
+};
+
+enum class LineBreakOpportunity : uint8_t {
+  None,
+  Allowed,
+  Mandatory,
+};
+
+/*
+ * Returns `true` for East Asian wide and full-width code points, which are
+ * laid out as ideographs.
+ */
+bool isWideCodePoint(char32_t codePoint);
+
+LineBreakClass getLineBreakClass(char32_t codePoint);
+
+/*
+ * Returns whether a line can (or must) be broken between two adjacent
+ * characters.
+ * This is a pair-table approximation of UAX #14 which doesn't look through
+ * runs of spaces (rules LB14-LB17), treats numbers as letters, and breaks
+ * around ideographs (LB31).
+ */
+LineBreakOpportunity getLineBreakOpportunity(
+    LineBreakClass before,
+    LineBreakClass after);
+
+} // namespace facebook::react
@@ -6,9 +6,437 @@
  */
 
 #include "TextLayoutManager.h"
+#include "LineBreaker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include <react/renderer/telemetry/TransactionTelemetry.h>
 
 namespace facebook::react {
 
+namespace {
+
+constexpr Float kDefaultFontSize = 14;
+
+// Tolerates rounding of measured widths which are fed back as constraints.
+constexpr Float kLineWidthTolerance = 0.01;
+
+constexpr char32_t kEllipsis = 0x2026;
+constexpr std::string_view kEllipsisString = "…";
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+/*
+ * Font-dependent values of a fragment, in points. `ascent` and `descent`
+ * include half of the leading each, so they add up to the line height.
+ */
+struct FragmentStyle {
+  Float scale;
+  Float letterSpacing;
+  Float ascent;
+  Float descent;
+};
+
+struct Glyph {
+  Float advance;
+  Float ascent;
+  Float descent;
+  uint32_t fragmentIndex;
+  uint32_t byteOffset;
+  uint32_t byteLength;
+  LineBreakClass lineBreakClass;
+  bool isAttachment;
+};
+
+/*
+ * A line covers glyphs [begin, end), including trailing whitespace and line
+ * breaks, which don't count towards its `width`.
+ */
+struct Line {
+  size_t begin;
+  size_t end;
+  Float x;
+  Float top;
+  Float width;
+  Float ascent;
+  Float descent;
+  bool isEllipsized;
+};
+
+struct TextLayout {
+  std::string text;
+  std::vector<FragmentStyle> fragmentStyles;
+  std::vector<Glyph> glyphs;
+  std::vector<Line> lines;
+  Size size;
+};
+
+bool isWhitespace(LineBreakClass lineBreakClass) {
+  switch (lineBreakClass) {
+    case LineBreakClass::Space:
+    case LineBreakClass::ZeroWidthSpace:
+    case LineBreakClass::MandatoryBreak:
+    case LineBreakClass::CarriageReturn:
+    case LineBreakClass::LineFeed:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/*
+ * Decodes the code point starting at `offset` and advances `offset` past it.
+ * Malformed sequences decode to U+FFFD one byte at a time.
+ */
+char32_t decodeUtf8(std::string_view string, size_t& offset) {
+  auto lead = static_cast<uint8_t>(string[offset++]);
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  auto length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : -1;
+  if (length < 0 || lead > 0xF4 || offset + length > string.size()) {
+    return kReplacementCharacter;
+  }
+
+  char32_t codePoint = lead & (0x3F >> length);
+  for (auto index = 0; index < length; index++) {
+    auto continuation = static_cast<uint8_t>(string[offset + index]);
+    if ((continuation & 0xC0) != 0x80) {
+      return kReplacementCharacter;
+    }
+    codePoint = (codePoint << 6) | (continuation & 0x3F);
+  }
+  offset += length;
+  return codePoint;
+}
+
+/*
+ * Applies `textTransform` to ASCII letters; other scripts are left as is.
+ */
+char32_t transformCodePoint(
+    char32_t codePoint,
+    TextTransform transform,
+    bool& isWordStart) {
+  auto isLetter = (codePoint | 0x20) >= 'a' && (codePoint | 0x20) <= 'z';
+  auto isWordCharacter = isLetter || (codePoint >= '0' && codePoint <= '9');
+  auto shouldUppercase = transform == TextTransform::Uppercase ||
+      (transform == TextTransform::Capitalize && isWordStart);
+  isWordStart = !isWordCharacter && codePoint < 0x80;
+
+  if (!isLetter) {
+    return codePoint;
+  }
+  if (shouldUppercase) {
+    return codePoint & ~0x20;
+  }
+  if (transform == TextTransform::Lowercase) {
+    return codePoint | 0x20;
+  }
+  return codePoint;
+}
+
+FragmentStyle makeFragmentStyle(
+    const TextAttributes& textAttributes,
+    const FontMetrics& fontMetrics) {
+  auto multiplier = std::isnan(textAttributes.fontSizeMultiplier)
+      ? Float{1}
+      : textAttributes.fontSizeMultiplier;
+  auto fontSize = std::isnan(textAttributes.fontSize)
+      ? kDefaultFontSize
+      : textAttributes.fontSize;
+  const auto& lineMetrics = fontMetrics.getLineMetrics();
+
+  auto style = FragmentStyle{};
+  style.scale = fontSize * multiplier / lineMetrics.unitsPerEm;
+  style.letterSpacing = std::isnan(textAttributes.letterSpacing)
+      ? 0
+      : textAttributes.letterSpacing * multiplier;
+  style.ascent = lineMetrics.ascender * style.scale;
+  style.descent = -lineMetrics.descender * style.scale;
+
+  auto lineHeight = std::isnan(textAttributes.lineHeight)
+      ? style.ascent + style.descent + lineMetrics.lineGap * style.scale
+      : textAttributes.lineHeight * multiplier;
+  auto halfLeading = (lineHeight - style.ascent - style.descent) / 2;
+  style.ascent += halfLeading;
+  style.descent += halfLeading;
+  return style;
+}
+
+void shapeFragments(
+    TextLayout& layout,
+    const AttributedString& attributedString,
+    const FontMetrics& fontMetrics) {
+  const auto& fragments = attributedString.getFragments();
+  layout.fragmentStyles.reserve(fragments.size());
+
+  for (size_t fragmentIndex = 0; fragmentIndex < fragments.size();
+       fragmentIndex++) {
+    const auto& fragment = fragments[fragmentIndex];
+    const auto& style = layout.fragmentStyles.emplace_back(
+        makeFragmentStyle(fragment.textAttributes, fontMetrics));
+
+    if (fragment.isAttachment()) {
+      // Attachments are inline boxes sitting on the baseline, which can be
+      // wrapped like ideographs.
+      auto size = fragment.parentShadowView.layoutMetrics.frame.size;
+      layout.glyphs.push_back(Glyph{
+          size.width,
+          size.height,
+          0,
+          static_cast<uint32_t>(fragmentIndex),
+          static_cast<uint32_t>(layout.text.size()),
+          static_cast<uint32_t>(fragment.string.size()),
+          LineBreakClass::Ideographic,
+          true});
+      layout.text += fragment.string;
+      continue;
+    }
+
+    auto transform =
+        fragment.textAttributes.textTransform.value_or(TextTransform::None);
+    auto isWordStart = true;
+    auto string = std::string_view{fragment.string};
+    layout.glyphs.reserve(layout.glyphs.size() + string.size());
+
+    size_t offset = 0;
+    while (offset < string.size()) {
+      auto begin = offset;
+      auto codePoint = decodeUtf8(string, offset);
+      auto byteOffset = static_cast<uint32_t>(layout.text.size());
+      if (codePoint < 0x80) {
+        codePoint = transformCodePoint(codePoint, transform, isWordStart);
+        layout.text.push_back(static_cast<char>(codePoint));
+      } else {
+        isWordStart = false;
+        layout.text.append(string.substr(begin, offset - begin));
+      }
+
+      auto lineBreakClass = getLineBreakClass(codePoint);
+      auto advance = Float{0};
+      switch (lineBreakClass) {
+        case LineBreakClass::CombiningMark:
+        case LineBreakClass::ZeroWidthSpace:
+        case LineBreakClass::MandatoryBreak:
+        case LineBreakClass::CarriageReturn:
+        case LineBreakClass::LineFeed:
+          break;
+        default:
+          advance = fontMetrics.getAdvance(codePoint) * style.scale +
+              style.letterSpacing;
+      }
+
+      layout.glyphs.push_back(Glyph{
+          advance,
+          style.ascent,
+          style.descent,
+          static_cast<uint32_t>(fragmentIndex),
+          byteOffset,
+          static_cast<uint32_t>(layout.text.size() - byteOffset),
+          lineBreakClass,
+          false});
+    }
+  }
+}
+
+/*
+ * Appends the line of glyphs [begin, end). Lines without glyphs (after a
+ * trailing line break) take the height of the line break.
+ */
+void appendLine(TextLayout& layout, size_t begin, size_t end) {
+  auto line = Line{begin, end, 0, 0, 0, 0, 0, false};
+
+  auto width = Float{0};
+  for (auto index = begin; index < end; index++) {
+    const auto& glyph = layout.glyphs[index];
+    width += glyph.advance;
+    if (!isWhitespace(glyph.lineBreakClass)) {
+      line.width = width;
+    }
+    line.ascent = std::max(line.ascent, glyph.ascent);
+    line.descent = std::max(line.descent, glyph.descent);
+  }
+
+  if (begin == end && begin > 0) {
+    line.ascent = layout.glyphs[begin - 1].ascent;
+    line.descent = layout.glyphs[begin - 1].descent;
+  }
+
+  layout.lines.push_back(line);
+}
+
+/*
+ * Greedily fills lines up to `maxWidth`, breaking at the last break
+ * opportunity which fits, or between any two characters if a word doesn't
+ * fit on its own line. Whitespace at the end of a line hangs past it.
+ */
+void breakLines(TextLayout& layout, Float maxWidth) {
+  const auto& glyphs = layout.glyphs;
+  if (glyphs.empty()) {
+    return;
+  }
+
+  maxWidth += kLineWidthTolerance;
+  size_t lineStart = 0;
+  size_t lastBreak = 0;
+  auto lineWidth = Float{0};
+  auto widthAtLastBreak = Float{0};
+
+  for (size_t index = 0; index < glyphs.size(); index++) {
+    const auto& glyph = glyphs[index];
+
+    if (index > lineStart) {
+      auto opportunity = getLineBreakOpportunity(
+          glyphs[index - 1].lineBreakClass, glyph.lineBreakClass);
+      if (opportunity == LineBreakOpportunity::Mandatory) {
+        appendLine(layout, lineStart, index);
+        lineStart = index;
+        lastBreak = index;
+        lineWidth = 0;
+      } else if (opportunity == LineBreakOpportunity::Allowed) {
+        lastBreak = index;
+        widthAtLastBreak = lineWidth;
+      }
+    }
+
+    if (index > lineStart && lineWidth + glyph.advance > maxWidth &&
+        !isWhitespace(glyph.lineBreakClass)) {
+      auto breakIndex = lastBreak > lineStart ? lastBreak : index;
+      appendLine(layout, lineStart, breakIndex);
+      lineWidth = breakIndex == index ? 0 : lineWidth - widthAtLastBreak;
+      lineStart = breakIndex;
+      lastBreak = breakIndex;
+    }
+
+    lineWidth += glyph.advance;
+  }
+
+  appendLine(layout, lineStart, glyphs.size());
+
+  switch (glyphs.back().lineBreakClass) {
+    case LineBreakClass::MandatoryBreak:
+    case LineBreakClass::CarriageReturn:
+    case LineBreakClass::LineFeed:
+      appendLine(layout, glyphs.size(), glyphs.size());
+      break;
+    default:
+      break;
+  }
+}
+
+/*
+ * Drops the lines past `maximumNumberOfLines`. Unless the paragraph clips,
+ * the last visible line ends with an ellipsis, replacing as many characters
+ * as needed to fit; every ellipsize mode truncates at the tail.
+ */
+void truncateLines(
+    TextLayout& layout,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maxWidth,
+    const FontMetrics& fontMetrics) {
+  auto maximumNumberOfLines =
+      static_cast<size_t>(paragraphAttributes.maximumNumberOfLines);
+  if (maximumNumberOfLines == 0 ||
+      layout.lines.size() <= maximumNumberOfLines) {
+    return;
+  }
+
+  layout.lines.resize(maximumNumberOfLines);
+  if (paragraphAttributes.ellipsizeMode == EllipsizeMode::Clip) {
+    return;
+  }
+
+  auto& line = layout.lines.back();
+  auto lastGlyphIndex = line.end > line.begin ? line.end - 1 : line.begin;
+  const auto& style = layout.fragmentStyles
+      [layout.glyphs[std::min(lastGlyphIndex, layout.glyphs.size() - 1)]
+           .fragmentIndex];
+  auto ellipsisWidth =
+      fontMetrics.getAdvance(kEllipsis) * style.scale + style.letterSpacing;
+
+  auto width = Float{0};
+  for (auto index = line.begin; index < line.end; index++) {
+    width += layout.glyphs[index].advance;
+  }
+  while (line.end > line.begin &&
+         (isWhitespace(layout.glyphs[line.end - 1].lineBreakClass) ||
+          width + ellipsisWidth > maxWidth + kLineWidthTolerance)) {
+    line.end--;
+    width -= layout.glyphs[line.end].advance;
+  }
+
+  line.width = width + ellipsisWidth;
+  line.isEllipsized = true;
+}
+
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maxWidth,
+    const FontMetrics& fontMetrics) {
+  auto layout = TextLayout{};
+  shapeFragments(layout, attributedString, fontMetrics);
+  breakLines(layout, maxWidth);
+  truncateLines(layout, paragraphAttributes, maxWidth, fontMetrics);
+
+  auto top = Float{0};
+  for (auto& line : layout.lines) {
+    line.top = top;
+    top += line.ascent + line.descent;
+    layout.size.width = std::max(layout.size.width, line.width);
+  }
+  layout.size.height = top;
+  return layout;
+}
+
+/*
+ * Positions lines horizontally in a box of `containerWidth`. Justified text
+ * is aligned like natural text (to the left).
+ */
+void alignLines(
+    TextLayout& layout,
+    const AttributedString& attributedString,
+    Float containerWidth) {
+  const auto& fragments = attributedString.getFragments();
+  auto alignment = fragments.empty()
+      ? TextAlignment::Natural
+      : fragments.front().textAttributes.alignment.value_or(
+            TextAlignment::Natural);
+
+  for (auto& line : layout.lines) {
+    switch (alignment) {
+      case TextAlignment::Center:
+        line.x = (containerWidth - line.width) / 2;
+        break;
+      case TextAlignment::Right:
+        line.x = containerWidth - line.width;
+        break;
+      default:
+        line.x = 0;
+        break;
+    }
+  }
+}
+
+} // namespace
+
+TextLayoutManager::TextLayoutManager(
+    const ContextContainer::Shared& contextContainer)
+    : fontMetrics_(
+          contextContainer
+              ? contextContainer->find<SharedFontMetrics>("FontMetrics")
+                    .value_or(nullptr)
+              : nullptr),
+      measureCache_(kSimpleThreadSafeCacheSizeCap) {
+  if (!fontMetrics_) {
+    fontMetrics_ = FontMetrics::defaultMetrics();
+  }
+}
+
 void* TextLayoutManager::getNativeTextLayoutManager() const {
   return (void*)this;
 }
@@ -18,14 +446,62 @@ TextMeasurement TextLayoutManager::measure(
     ParagraphAttributes paragraphAttributes,
     const TextLayoutContext& /*layoutContext*/,
     LayoutConstraints layoutConstraints) const {
-  TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
-    }
-  }
-  return TextMeasurement{{0, 0}, attachments};
+  const auto& attributedString = attributedStringBox.getValue();
+
+  auto measurement = measureCache_.get(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](const TextMeasureCacheKey& /*key*/) {
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry != nullptr) {
+          telemetry->willMeasureText();
+        }
+
+        auto layout = layoutText(
+            attributedString,
+            paragraphAttributes,
+            layoutConstraints.maximumSize.width,
+            *fontMetrics_);
+        alignLines(
+            layout,
+            attributedString,
+            layoutConstraints.clamp(layout.size).width);
+
+        auto measurement = TextMeasurement{layout.size, {}};
+        for (const auto& line : layout.lines) {
+          auto x = line.x;
+          for (auto index = line.begin; index < line.end; index++) {
+            const auto& glyph = layout.glyphs[index];
+            if (glyph.isAttachment) {
+              measurement.attachments.push_back(
+                  {{{x, line.top + line.ascent - glyph.ascent},
+                    {glyph.advance, glyph.ascent}},
+                   false});
+            }
+            x += glyph.advance;
+          }
+        }
+
+        // Attachments on truncated lines aren't displayed.
+        auto visibleGlyphCount =
+            layout.lines.empty() ? 0 : layout.lines.back().end;
+        for (auto index = visibleGlyphCount; index < layout.glyphs.size();
+             index++) {
+          const auto& glyph = layout.glyphs[index];
+          if (glyph.isAttachment) {
+            measurement.attachments.push_back(
+                {{{0, 0}, {glyph.advance, glyph.ascent}}, true});
+          }
+        }
+
+        if (telemetry != nullptr) {
+          telemetry->didMeasureText();
+        }
+
+        return measurement;
+      });
+
+  measurement.size = layoutConstraints.clamp(measurement.size);
+  return measurement;
 }
 
 TextMeasurement TextLayoutManager::measureCachedSpannableById(
@@ -39,7 +515,50 @@ LinesMeasurements TextLayoutManager::measureLines(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
     Size size) const {
-  return {};
-};
+  auto layout = layoutText(
+      attributedString, paragraphAttributes, size.width, *fontMetrics_);
+  alignLines(layout, attributedString, size.width);
+
+  const auto& lineMetrics = fontMetrics_->getLineMetrics();
+  auto linesMeasurements = LinesMeasurements{};
+  linesMeasurements.reserve(layout.lines.size());
+
+  for (const auto& line : layout.lines) {
+    auto text = std::string{};
+    if (line.end > line.begin) {
+      const auto& first = layout.glyphs[line.begin];
+      const auto& last = layout.glyphs[line.end - 1];
+      text = layout.text.substr(
+          first.byteOffset,
+          last.byteOffset + last.byteLength - first.byteOffset);
+    }
+    if (line.isEllipsized) {
+      text += kEllipsisString;
+    }
+
+    // Reports the metrics of the largest font on the line.
+    auto scale = Float{0};
+    for (auto index = line.begin; index < line.end; index++) {
+      scale = std::max(
+          scale,
+          layout.fragmentStyles[layout.glyphs[index].fragmentIndex].scale);
+    }
+    if (line.end == line.begin && line.begin > 0) {
+      scale =
+          layout.fragmentStyles[layout.glyphs[line.begin - 1].fragmentIndex]
+              .scale;
+    }
+
+    linesMeasurements.emplace_back(
+        std::move(text),
+        Rect{{line.x, line.top}, {line.width, line.ascent + line.descent}},
+        -lineMetrics.descender * scale,
+        lineMetrics.capHeight * scale,
+        lineMetrics.ascender * scale,
+        lineMetrics.xHeight * scale);
+  }
+
+  return linesMeasurements;
+}
 
 } // namespace facebook::react
@@ -17,6 +17,8 @@
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
 
+#include "FontMetrics.h"
+
 namespace facebook::react {
 
 class TextLayoutManager;
@@ -24,11 +26,16 @@ class TextLayoutManager;
 using SharedTextLayoutManager = std::shared_ptr<const TextLayoutManager>;
 
 /*
- * Cross platform facade for Android-specific TextLayoutManager.
+ * Portable TextLayoutManager which lays text out using font metrics only
+ * (glyph advances and line metrics), without shaping or a platform text
+ * stack.
+ * Uses the metrics stored in the `ContextContainer` under the
+ * "FontMetrics" key (a `SharedFontMetrics`), or
+ * `FontMetrics::defaultMetrics()` otherwise.
  */
 class TextLayoutManager {
  public:
-  TextLayoutManager(const ContextContainer::Shared& contextContainer) {}
+  TextLayoutManager(const ContextContainer::Shared& contextContainer);
 
   virtual ~TextLayoutManager() = default;
 
@@ -64,6 +71,10 @@ class TextLayoutManager {
    * Is used on a native views layer to delegate text rendering to the manager.
    */
   void* getNativeTextLayoutManager() const;
+
+ private:
+  SharedFontMetrics fontMetrics_;
+  TextMeasureCache measureCache_;
 };
 
 } // namespace facebook::react
@@ -5,14 +5,207 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <limits>
 #include <memory>
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
 #include <react/renderer/textlayoutmanager/TextLayoutManager.h>
 
 using namespace facebook::react;
 
-TEST(TextLayoutManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+constexpr Float kInfinity = std::numeric_limits<Float>::infinity();
+
+// Line height of the default metrics at font size 10.
+constexpr Float kLineHeight = 11.5;
+
+AttributedString::Fragment makeFragment(
+    std::string string,
+    Float fontSize = 10) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes.fontSize = fontSize;
+  return fragment;
+}
+
+AttributedString makeAttributedString(std::string string) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment(std::move(string)));
+  return attributedString;
+}
+
+LayoutConstraints makeConstraints(Float maximumWidth) {
+  return LayoutConstraints{{0, 0}, {maximumWidth, kInfinity}};
+}
+
+Size measure(
+    const TextLayoutManager& textLayoutManager,
+    const AttributedString& attributedString,
+    Float maximumWidth,
+    ParagraphAttributes paragraphAttributes = {}) {
+  return textLayoutManager
+      .measure(
+          AttributedStringBox{attributedString},
+          paragraphAttributes,
+          {},
+          makeConstraints(maximumWidth))
+      .size;
+}
+
+} // namespace
+
+TEST(TextLayoutManagerTest, lineBreakOpportunities) {
+  auto opportunity = [](char32_t before, char32_t after) {
+    return getLineBreakOpportunity(
+        getLineBreakClass(before), getLineBreakClass(after));
+  };
+
+  EXPECT_EQ(opportunity('a', 'b'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity(' ', 'b'), LineBreakOpportunity::Allowed);
+  EXPECT_EQ(opportunity('a', ' '), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('-', 'b'), LineBreakOpportunity::Allowed);
+  EXPECT_EQ(opportunity('a', '-'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('a', '.'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('(', 'a'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity(0x00A0, 'a'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity(0x4E00, 0x4E01), LineBreakOpportunity::Allowed);
+  EXPECT_EQ(opportunity(0x4E00, 0x3002), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('a', 0x0301), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('\n', 'a'), LineBreakOpportunity::Mandatory);
+  EXPECT_EQ(opportunity('\r', '\n'), LineBreakOpportunity::None);
+  EXPECT_EQ(opportunity('\r', 'a'), LineBreakOpportunity::Mandatory);
+}
+
+TEST(TextLayoutManagerTest, fontMetricsRejectsInvalidData) {
+  EXPECT_EQ(FontMetrics::fromData(""), nullptr);
+  EXPECT_EQ(FontMetrics::fromData(std::string(64, '\xFF')), nullptr);
+  EXPECT_EQ(FontMetrics::fromFile("/nonexistent/font.ttf"), nullptr);
+}
+
+TEST(TextLayoutManagerTest, measuresSingleLine) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  // Advances of "Hello" in Helvetica: 722 + 556 + 222 + 222 + 556.
+  auto size =
+      measure(textLayoutManager, makeAttributedString("Hello"), kInfinity);
+  EXPECT_FLOAT_EQ(size.width, 22.78);
+  EXPECT_FLOAT_EQ(size.height, kLineHeight);
+
+  EXPECT_EQ(
+      measure(textLayoutManager, makeAttributedString(""), kInfinity).height,
+      0);
+}
+
+TEST(TextLayoutManagerTest, wrapsAtBreakOpportunities) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+  auto attributedString = makeAttributedString("aaa bbb");
+
+  auto singleLine = measure(textLayoutManager, attributedString, kInfinity);
+  auto wrapped =
+      measure(textLayoutManager, attributedString, singleLine.width - 1);
+  EXPECT_FLOAT_EQ(wrapped.width, 16.68);
+  EXPECT_FLOAT_EQ(wrapped.height, kLineHeight * 2);
+
+  auto lines = textLayoutManager.measureLines(
+      attributedString, {}, {singleLine.width - 1, kInfinity});
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0].text, "aaa ");
+  EXPECT_EQ(lines[1].text, "bbb");
+  EXPECT_FLOAT_EQ(lines[1].frame.origin.y, kLineHeight);
+  EXPECT_FLOAT_EQ(lines[1].ascender, 9.05);
+  EXPECT_FLOAT_EQ(lines[1].descender, 2.12);
+
+  // A word which doesn't fit on its own line is broken anywhere.
+  auto broken = textLayoutManager.measureLines(
+      makeAttributedString("aaaaaa"), {}, {12, kInfinity});
+  ASSERT_EQ(broken.size(), 3);
+  EXPECT_EQ(broken[0].text, "aa");
+}
+
+TEST(TextLayoutManagerTest, breaksAtLineBreaks) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto lines = textLayoutManager.measureLines(
+      makeAttributedString("a\r\nb\n"), {}, {kInfinity, kInfinity});
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_EQ(lines[0].text, "a\r\n");
+  EXPECT_EQ(lines[1].text, "b\n");
+  EXPECT_EQ(lines[2].text, "");
+  EXPECT_FLOAT_EQ(lines[0].frame.size.width, 5.56);
+}
+
+TEST(TextLayoutManagerTest, appliesTextAttributes) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto fragment = makeFragment("aa");
+  fragment.textAttributes.letterSpacing = 1;
+  fragment.textAttributes.lineHeight = 20;
+  fragment.textAttributes.textTransform = TextTransform::Uppercase;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(fragment);
+
+  auto size = measure(textLayoutManager, attributedString, kInfinity);
+  EXPECT_FLOAT_EQ(size.width, 6.67 * 2 + 2);
+  EXPECT_FLOAT_EQ(size.height, 20);
+}
+
+TEST(TextLayoutManagerTest, truncatesToMaximumNumberOfLines) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+  auto attributedString = makeAttributedString("aaa bbb ccc");
+
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+
+  auto size = measure(textLayoutManager, attributedString, 30, {});
+  EXPECT_FLOAT_EQ(size.height, kLineHeight * 3);
+
+  size = measure(textLayoutManager, attributedString, 30, paragraphAttributes);
+  EXPECT_FLOAT_EQ(size.height, kLineHeight * 2);
+
+  auto lines = textLayoutManager.measureLines(
+      attributedString, paragraphAttributes, {30, kInfinity});
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[1].text, "bbb…");
+  EXPECT_LE(lines[1].frame.size.width, 30);
+}
+
+TEST(TextLayoutManagerTest, positionsAttachments) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto attachment =
+      makeFragment(AttributedString::Fragment::AttachmentCharacter());
+  attachment.parentShadowView.layoutMetrics.frame.size = {10, 5};
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("a"));
+  attributedString.appendFragment(attachment);
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{attributedString},
+      {},
+      {},
+      makeConstraints(kInfinity));
+  ASSERT_EQ(measurement.attachments.size(), 1);
+  const auto& frame = measurement.attachments[0].frame;
+  EXPECT_FALSE(measurement.attachments[0].isClipped);
+  EXPECT_FLOAT_EQ(frame.origin.x, 5.56);
+  EXPECT_FLOAT_EQ(frame.origin.y, 9.05 + 0.165 - 5);
+  EXPECT_FLOAT_EQ(frame.size.width, 10);
+}
+
+TEST(TextLayoutManagerTest, usesFontMetricsOfContextContainer) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto fontMetrics = std::make_shared<const FontMetrics>(
+      FontMetrics::LineMetrics{100, 80, -20, 0, 70, 50},
+      std::unordered_map<char32_t, Float>{{'a', 50}},
+      100);
+  contextContainer->insert("FontMetrics", SharedFontMetrics{fontMetrics});
+  auto textLayoutManager = TextLayoutManager{contextContainer};
+
+  auto size = measure(textLayoutManager, makeAttributedString("ab"), kInfinity);
+  EXPECT_FLOAT_EQ(size.width, 15);
+  EXPECT_FLOAT_EQ(size.height, 10);
 }
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+
+#include <limits>
+#include <string>
+
+namespace facebook::react {
+
+static const auto textLayoutManager = TextLayoutManager{nullptr};
+
+static const std::string kParagraph =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five "
+    "dozen liquor jugs! How vexingly quick daft zebras jump; the five boxing "
+    "wizards jump quickly. Sphinx of black quartz, judge my vow. ";
+
+static const std::string kIdeographicParagraph =
+    "敏捷的棕色狐狸跳过了那只懒狗。我能吞下玻璃而不伤身体。"
+    "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。";
+
+static AttributedString makeAttributedString(
+    const std::string& paragraph,
+    size_t repeatCount) {
+  auto fragment = AttributedString::Fragment{};
+  for (size_t index = 0; index < repeatCount; index++) {
+    fragment.string += paragraph;
+  }
+  fragment.textAttributes.fontSize = 14;
+  fragment.textAttributes.lineHeight = 20;
+
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(fragment);
+  return attributedString;
+}
+
+/*
+ * Lays out text without the measure cache, at a width fitting about 40
+ * characters per line.
+ */
+static void layoutLatinText(benchmark::State& state) {
+  auto attributedString =
+      makeAttributedString(kParagraph, static_cast<size_t>(state.range(0)));
+  auto textSize = attributedString.getFragments().front().string.size();
+
+  for (auto _ : state) {
+    auto lines = textLayoutManager.measureLines(
+        attributedString,
+        {},
+        {280, std::numeric_limits<Float>::infinity()});
+    benchmark::DoNotOptimize(lines);
+  }
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * textSize));
+}
+BENCHMARK(layoutLatinText)->RangeMultiplier(4)->Range(1, 64);
+
+static void layoutIdeographicText(benchmark::State& state) {
+  auto attributedString = makeAttributedString(
+      kIdeographicParagraph, static_cast<size_t>(state.range(0)));
+  auto textSize = attributedString.getFragments().front().string.size();
+
+  for (auto _ : state) {
+    auto lines = textLayoutManager.measureLines(
+        attributedString,
+        {},
+        {280, std::numeric_limits<Float>::infinity()});
+    benchmark::DoNotOptimize(lines);
+  }
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * textSize));
+}
+BENCHMARK(layoutIdeographicText)->RangeMultiplier(4)->Range(1, 64);
+
+/*
+ * Measures the same text at a different width every time, so every
+ * measurement misses the measure cache, like resizing a text input.
+ */
+static void measureWithChangingConstraints(benchmark::State& state) {
+  auto attributedString = makeAttributedString(kParagraph, 4);
+  auto width = Float{200};
+
+  for (auto _ : state) {
+    width = width < 400 ? width + 0.5f : 200;
+    auto measurement = textLayoutManager.measure(
+        AttributedStringBox{attributedString},
+        {},
+        {},
+        {{0, 0}, {width, std::numeric_limits<Float>::infinity()}});
+    benchmark::DoNotOptimize(measurement);
+  }
+}
+BENCHMARK(measureWithChangingConstraints);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -63,7 +63,7 @@ static bool isAnyViewInPathToRootListeningToEvents(
   uiManager.getShadowTreeRegistry().visit(
       shadowNode.getSurfaceId(),
       [&owningRootShadowNode](const ShadowTree& shadowTree) {
-        owningRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        owningRootShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
       });
 
   if (owningRootShadowNode == nullptr) {
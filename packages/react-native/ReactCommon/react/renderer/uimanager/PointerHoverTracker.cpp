@@ -26,7 +26,7 @@ PointerHoverTracker::PointerHoverTracker(
     shadowTreeRegistry.visit(
         target_->getSurfaceId(),
         [&rootShadowNode](const ShadowTree& shadowTree) {
-          rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+          rootShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
         });
     this->root_ = rootShadowNode;
   }
@@ -18,9 +18,12 @@
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
 #include <react/renderer/uimanager/UIManagerMountHook.h>
+#include <react/utils/CoreFeatures.h>
 
 #include <glog/logging.h>
 
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 namespace {
@@ -191,10 +194,17 @@ void UIManager::completeSurface(
 
     if (result == ShadowTree::CommitStatus::Succeeded &&
         lazyShadowTreeRevisionConsistencyManager_ != nullptr) {
-      // It's safe to update the visible revision of the shadow tree immediately
-      // after we commit a specific one.
-      lazyShadowTreeRevisionConsistencyManager_->updateCurrentRevision(
-          surfaceId, shadowTree.getCurrentRevision().rootShadowNode);
+      if (commitOptions.pipelined) {
+        // The revision is published later by the commit pipeline, so it is
+        // captured when it is first read (reading it waits for the pipeline).
+        lazyShadowTreeRevisionConsistencyManager_->resetCurrentRevision(
+            surfaceId);
+      } else {
+        // It's safe to update the visible revision of the shadow tree
+        // immediately after we commit a specific one.
+        lazyShadowTreeRevisionConsistencyManager_->updateCurrentRevision(
+            surfaceId, shadowTree.getCurrentRevision().rootShadowNode);
+      }
     }
   });
 }
@@ -269,7 +279,7 @@ ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
   auto ancestorShadowNode = ShadowNode::Shared{};
   shadowTreeRegistry_.visit(
       shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
-        ancestorShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        ancestorShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
       });
   return getShadowNodeInSubtree(shadowNode, ancestorShadowNode);
 }
@@ -336,7 +346,7 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
     shadowTreeRegistry_.visit(
         shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
           owningAncestorShadowNode =
-              shadowTree.getCurrentRevision().rootShadowNode;
+              shadowTree.getCommittedRevision().rootShadowNode;
           ancestorShadowNode = owningAncestorShadowNode.get();
         });
   } else {
@@ -367,6 +377,9 @@ void UIManager::updateState(const StateUpdate& stateUpdate) const {
   auto& family = stateUpdate.family;
   auto& componentDescriptor = family->getComponentDescriptor();
 
+  stateUpdateCount_++;
+  stateUpdateCommitCount_++;
+
   shadowTreeRegistry_.visit(
       family->getSurfaceId(), [&](const ShadowTree& shadowTree) {
         shadowTree.commit(
@@ -403,6 +416,106 @@ void UIManager::updateState(const StateUpdate& stateUpdate) const {
       });
 }
 
+void UIManager::updateStates(std::vector<StateUpdate>&& stateUpdates) const {
+  if (!CoreFeatures::enableBatchedStateUpdates) {
+    for (const auto& stateUpdate : stateUpdates) {
+      updateState(stateUpdate);
+    }
+    return;
+  }
+
+  // Grouping updates by surface, preserving their order within each surface.
+  auto surfaceIds = std::vector<SurfaceId>{};
+  auto stateUpdatesBySurface =
+      std::unordered_map<SurfaceId, std::vector<StateUpdate>>{};
+  for (auto& stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    auto& surfaceStateUpdates = stateUpdatesBySurface[surfaceId];
+    if (surfaceStateUpdates.empty()) {
+      surfaceIds.push_back(surfaceId);
+    }
+    surfaceStateUpdates.push_back(std::move(stateUpdate));
+  }
+
+  for (auto surfaceId : surfaceIds) {
+    const auto& surfaceStateUpdates = stateUpdatesBySurface[surfaceId];
+    if (surfaceStateUpdates.size() == 1) {
+      updateState(surfaceStateUpdates.front());
+    } else {
+      updateStatesOfSurface(surfaceId, surfaceStateUpdates);
+    }
+  }
+}
+
+void UIManager::updateStatesOfSurface(
+    SurfaceId surfaceId,
+    const std::vector<StateUpdate>& stateUpdates) const {
+  SystraceSection s("UIManager::updateStatesOfSurface");
+
+  auto familiesToUpdate = std::unordered_set<const ShadowNodeFamily*>{};
+  for (const auto& stateUpdate : stateUpdates) {
+    familiesToUpdate.insert(stateUpdate.family.get());
+  }
+
+  stateUpdateCount_ += static_cast<int>(stateUpdates.size());
+  stateUpdateCommitCount_++;
+
+  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          auto hasNewStates = false;
+
+          auto rootNode = oldRootShadowNode.cloneMultiple(
+              familiesToUpdate,
+              [&](const ShadowNode& oldShadowNode,
+                  const ShadowNodeFragment& fragment) {
+                const auto& family = oldShadowNode.getFamily();
+
+                // Updates of the same family are chained as if they were
+                // committed one after another.
+                auto data = oldShadowNode.getState()->getDataPointer();
+                auto isDataChanged = false;
+                for (const auto& stateUpdate : stateUpdates) {
+                  if (stateUpdate.family.get() != &family) {
+                    continue;
+                  }
+                  auto newData = stateUpdate.callback(data);
+                  if (newData) {
+                    data = std::move(newData);
+                    isDataChanged = true;
+                  }
+                }
+
+                if (!isDataChanged) {
+                  return oldShadowNode.clone(fragment);
+                }
+
+                hasNewStates = true;
+                auto newState =
+                    family.getComponentDescriptor().createState(family, data);
+                return oldShadowNode.clone({
+                    /* .props = */ fragment.props,
+                    /* .children = */ fragment.children,
+                    /* .state = */ newState,
+                });
+              });
+
+          // Every update was cancelled (or no node is mounted anymore).
+          return rootNode && hasNewStates
+              ? std::static_pointer_cast<RootShadowNode>(rootNode)
+              : nullptr;
+        },
+        {/* default commit options */});
+  });
+}
+
+StateUpdateTelemetry UIManager::getStateUpdateTelemetry() const {
+  return StateUpdateTelemetry{
+      /* .stateUpdateCount = */ stateUpdateCount_,
+      /* .commitCount = */ stateUpdateCommitCount_,
+  };
+}
+
 void UIManager::dispatchCommand(
     const ShadowNode::Shared& shadowNode,
     const std::string& commandName,
@@ -436,7 +549,7 @@ void UIManager::setNativeProps_DEPRECATED(
         // The lambda passed to `commit` may be executed multiple times.
         // We need to create fresh copy of the `RawProps` object each time.
         auto ancestorShadowNode =
-            shadowTree.getCurrentRevision().rootShadowNode;
+            shadowTree.getCommittedRevision().rootShadowNode;
         shadowTree.commit(
             [&](const RootShadowNode& oldRootShadowNode) {
               auto rootNode = oldRootShadowNode.cloneTree(
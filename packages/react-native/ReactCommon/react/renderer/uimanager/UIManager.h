@@ -11,6 +11,7 @@
 #include <jsi/jsi.h>
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <atomic>
 #include <shared_mutex>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
@@ -37,6 +38,15 @@ class UIManagerBinding;
 class UIManagerCommitHook;
 class UIManagerMountHook;
 
+/*
+ * Counters of the state updates applied by `UIManager`. Batching saves
+ * `stateUpdateCount - commitCount` commits.
+ */
+struct StateUpdateTelemetry {
+  int stateUpdateCount{0};
+  int commitCount{0};
+};
+
 class UIManager final : public ShadowTreeDelegate {
  public:
   UIManager(
@@ -174,6 +184,17 @@ class UIManager final : public ShadowTreeDelegate {
    */
   void updateState(const StateUpdate& stateUpdate) const;
 
+  /*
+   * Applies state updates queued together, in order. If
+   * `CoreFeatures::enableBatchedStateUpdates` is set, the updates of each
+   * surface are applied in one commit which clones every affected ancestor
+   * once. As with `updateState`, an update whose callback returns `nullptr`
+   * is not applied; the other updates still are.
+   */
+  void updateStates(std::vector<StateUpdate>&& stateUpdates) const;
+
+  StateUpdateTelemetry getStateUpdateTelemetry() const;
+
   void dispatchCommand(
       const ShadowNode::Shared& shadowNode,
       const std::string& commandName,
@@ -218,6 +239,10 @@ class UIManager final : public ShadowTreeDelegate {
       const jsi::Value& successCallback,
       const jsi::Value& failureCallback) const;
 
+  void updateStatesOfSurface(
+      SurfaceId surfaceId,
+      const std::vector<StateUpdate>& stateUpdates) const;
+
   ShadowNode::Shared getShadowNodeInSubtree(
       const ShadowNode& shadowNode,
       const ShadowNode::Shared& ancestorShadowNode) const;
@@ -238,6 +263,9 @@ class UIManager final : public ShadowTreeDelegate {
 
   std::unique_ptr<LeakChecker> leakChecker_;
 
+  mutable std::atomic<int> stateUpdateCount_{0};
+  mutable std::atomic<int> stateUpdateCommitCount_{0};
+
   std::unique_ptr<LazyShadowTreeRevisionConsistencyManager>
       lazyShadowTreeRevisionConsistencyManager_;
   std::unique_ptr<LatestShadowTreeRevisionProvider>
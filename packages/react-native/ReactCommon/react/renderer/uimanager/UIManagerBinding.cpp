@@ -16,7 +16,9 @@
 #include <react/renderer/dom/DOM.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
+#include <react/utils/CoreFeatures.h>
 
+#include <cmath>
 #include <utility>
 
 #include "bindingUtils.h"
@@ -34,6 +36,9 @@ void UIManagerBinding::createAndInstallIfNeeded(
     // The global namespace does not have an instance of the binding;
     // we need to create, install and return it.
     auto uiManagerBinding = std::make_shared<UIManagerBinding>(uiManager);
+    // Destroyed together with the binding, which the runtime destroys.
+    uiManagerBinding->objectShapeCache_ =
+        std::make_unique<JSIObjectShapeCache>(runtime);
     auto object = jsi::Object::createFromHostObject(runtime, uiManagerBinding);
     runtime.global().setProperty(
         runtime, uiManagerModuleName, std::move(object));
@@ -66,17 +71,19 @@ jsi::Value UIManagerBinding::getInspectorDataForInstance(
     jsi::Runtime& runtime,
     const EventEmitter& eventEmitter) const {
   auto eventTarget = eventEmitter.eventTarget_;
-  EventEmitter::DispatchMutex().lock();
 
   if (!runtime.global().hasProperty(runtime, "__fbBatchedBridge") ||
       !eventTarget) {
     return jsi::Value::undefined();
   }
 
-  eventTarget->retain(runtime);
-  auto instanceHandle = eventTarget->getInstanceHandle(runtime);
-  eventTarget->release(runtime);
-  EventEmitter::DispatchMutex().unlock();
+  auto instanceHandle = jsi::Value::undefined();
+  {
+    std::scoped_lock lock(EventEmitter::DispatchMutex(eventTarget.get()));
+    eventTarget->retain(runtime);
+    instanceHandle = eventTarget->getInstanceHandle(runtime);
+    eventTarget->release(runtime);
+  }
 
   if (instanceHandle.isUndefined()) {
     return jsi::Value::undefined();
@@ -153,8 +160,10 @@ void UIManagerBinding::dispatchEventToJS(
                  << eventTarget->getTag();
     }
     react_native_assert(payload.isObject());
-    payload.asObject(runtime).setProperty(
-        runtime, "target", eventTarget->getTag());
+    static const auto targetShape = JSIObjectShape{"target"};
+    auto payloadObject = payload.asObject(runtime);
+    targetShape.setProperty(
+        runtime, payloadObject, 0, jsi::Value(eventTarget->getTag()));
     return instanceHandle;
   }()
                                                : jsi::Value::null();
@@ -193,6 +202,131 @@ static void validateArgumentCount(
   }
 }
 
+/*
+ * Opcodes of the instruction list passed to `createNodes`.
+ * Must be kept in sync with `FabricUIManager.js`.
+ */
+enum class NodeInstruction {
+  // Followed by the `createNode` arguments except `rootTag`:
+  // `reactTag, viewName, props, instanceHandle`.
+  CreateNode = 0,
+  // Followed by `parent, child`. Each of them is either the index of a node
+  // created by the same call or a node.
+  AppendChild = 1,
+};
+
+static constexpr size_t kNodeInstructionCount = 2;
+
+/*
+ * Returns `value` as an index lower than `size`. Throws if it is not a
+ * non-negative integer in that range, as casting it would be undefined.
+ */
+static size_t indexFromInstructionValue(
+    jsi::Runtime& runtime,
+    const jsi::Value& value,
+    size_t size,
+    const std::string& description) {
+  auto number = value.isNumber() ? value.getNumber() : -1.0;
+  if (!(number >= 0 && number < static_cast<double>(size)) ||
+      std::trunc(number) != number) {
+    throw jsi::JSError(
+        runtime,
+        "createNodes: invalid " + description + " " +
+            (value.isNumber() ? std::to_string(number) : "(not a number)"));
+  }
+  return static_cast<size_t>(number);
+}
+
+static ShadowNode::Shared shadowNodeFromInstructionOperand(
+    jsi::Runtime& runtime,
+    const std::vector<ShadowNode::Shared>& createdShadowNodes,
+    const jsi::Value& value) {
+  if (!value.isNumber()) {
+    return shadowNodeFromValue(runtime, value);
+  }
+
+  return createdShadowNodes[indexFromInstructionValue(
+      runtime, value, createdShadowNodes.size(), "node index")];
+}
+
+/*
+ * Executes the instruction list passed to `createNodes` and returns the nodes
+ * created by it, in order.
+ */
+static jsi::Value createNodesFromInstructions(
+    jsi::Runtime& runtime,
+    const UIManager& uiManager,
+    SurfaceId surfaceId,
+    const jsi::Array& instructions) {
+  SystraceSection s("UIManagerBinding::createNodes");
+
+  auto length = instructions.length(runtime);
+  auto createdShadowNodes = std::vector<ShadowNode::Shared>{};
+  auto ensureOperands = [&](size_t index, size_t count) {
+    if (index + count >= length) {
+      throw jsi::JSError(
+          runtime, "createNodes: instruction list ended unexpectedly");
+    }
+  };
+
+  size_t index = 0;
+  while (index < length) {
+    auto opcode = static_cast<NodeInstruction>(indexFromInstructionValue(
+        runtime,
+        instructions.getValueAtIndex(runtime, index),
+        kNodeInstructionCount,
+        "instruction"));
+    switch (opcode) {
+      case NodeInstruction::CreateNode: {
+        ensureOperands(index, 4);
+        auto tag = instructions.getValueAtIndex(runtime, index + 1);
+        auto instanceHandle = instanceHandleFromValue(
+            runtime, instructions.getValueAtIndex(runtime, index + 4), tag);
+        if (!instanceHandle) {
+          react_native_assert(false);
+          return jsi::Value::undefined();
+        }
+
+        createdShadowNodes.push_back(uiManager.createNode(
+            tagFromValue(tag),
+            stringFromValue(
+                runtime, instructions.getValueAtIndex(runtime, index + 2)),
+            surfaceId,
+            RawProps(runtime, instructions.getValueAtIndex(runtime, index + 3)),
+            std::move(instanceHandle)));
+        index += 5;
+        break;
+      }
+      case NodeInstruction::AppendChild: {
+        ensureOperands(index, 2);
+        uiManager.appendChild(
+            shadowNodeFromInstructionOperand(
+                runtime,
+                createdShadowNodes,
+                instructions.getValueAtIndex(runtime, index + 1)),
+            shadowNodeFromInstructionOperand(
+                runtime,
+                createdShadowNodes,
+                instructions.getValueAtIndex(runtime, index + 2)));
+        index += 3;
+        break;
+      }
+      default:
+        throw jsi::JSError(
+            runtime,
+            "createNodes: unknown instruction at index " +
+                std::to_string(index));
+    }
+  }
+
+  auto result = jsi::Array(runtime, createdShadowNodes.size());
+  for (size_t i = 0; i < createdShadowNodes.size(); i++) {
+    result.setValueAtIndex(
+        runtime, i, valueFromShadowNode(runtime, createdShadowNodes[i]));
+  }
+  return result;
+}
+
 jsi::Value UIManagerBinding::get(
     jsi::Runtime& runtime,
     const jsi::PropNameID& name) {
@@ -336,11 +470,14 @@ jsi::Value UIManagerBinding::get(
 
           auto& eventTarget = targetNode->getEventEmitter()->eventTarget_;
 
-          EventEmitter::DispatchMutex().lock();
-          eventTarget->retain(runtime);
-          auto instanceHandle = eventTarget->getInstanceHandle(runtime);
-          eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
+          auto instanceHandle = jsi::Value::undefined();
+          {
+            std::scoped_lock lock(
+                EventEmitter::DispatchMutex(eventTarget.get()));
+            eventTarget->retain(runtime);
+            instanceHandle = eventTarget->getInstanceHandle(runtime);
+            eventTarget->release(runtime);
+          }
 
           onSuccessFunction.call(runtime, std::move(instanceHandle));
           return jsi::Value::undefined();
@@ -444,6 +581,33 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Creates and connects many new nodes at once, as described by a
+  // list of instructions (see `NodeInstruction`).
+  if (methodName == "createNodes") {
+    auto paramCount = 2;
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        paramCount,
+        [uiManager, methodName, paramCount](
+            jsi::Runtime& runtime,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* arguments,
+            size_t count) -> jsi::Value {
+          try {
+            validateArgumentCount(runtime, methodName, paramCount, count);
+
+            return createNodesFromInstructions(
+                runtime,
+                *uiManager,
+                surfaceIdFromValue(runtime, arguments[0]),
+                arguments[1].asObject(runtime).asArray(runtime));
+          } catch (const std::logic_error& ex) {
+            LOG(FATAL) << "logic_error in createNodes: " << ex.what();
+          }
+        });
+  }
+
   // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
   if (methodName == "createChildSet") {
     return jsi::Function::createFromHostFunction(
@@ -540,7 +704,8 @@ jsi::Value UIManagerBinding::get(
                 shadowNodeList,
                 {.enableStateReconciliation = true,
                  .mountSynchronously = false,
-                 .shouldYield = nullptr});
+                 .shouldYield = nullptr,
+                 .pipelined = CoreFeatures::enablePipelinedCommits});
           }
 
           return jsi::Value::undefined();
@@ -586,12 +751,14 @@ jsi::Value UIManagerBinding::get(
               shadowNodeFromValue(runtime, arguments[1]).get(),
               {/* .includeTransform = */ false});
           auto frame = layoutMetrics.frame;
-          auto result = jsi::Object(runtime);
-          result.setProperty(runtime, "left", frame.origin.x);
-          result.setProperty(runtime, "top", frame.origin.y);
-          result.setProperty(runtime, "width", frame.size.width);
-          result.setProperty(runtime, "height", frame.size.height);
-          return result;
+          static const auto shape =
+              JSIObjectShape{"left", "top", "width", "height"};
+          return shape.createObject(
+              runtime,
+              {frame.origin.x,
+               frame.origin.y,
+               frame.size.width,
+               frame.size.height});
         });
   }
 
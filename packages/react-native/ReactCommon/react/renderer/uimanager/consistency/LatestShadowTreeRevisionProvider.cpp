@@ -20,7 +20,7 @@ RootShadowNode::Shared LatestShadowTreeRevisionProvider::getCurrentRevision(
   RootShadowNode::Shared rootShadowNode;
 
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
-    rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+    rootShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
   });
 
   return rootShadowNode;
@@ -22,6 +22,11 @@ void LazyShadowTreeRevisionConsistencyManager::updateCurrentRevision(
       surfaceId, std::move(rootShadowNode));
 }
 
+void LazyShadowTreeRevisionConsistencyManager::resetCurrentRevision(
+    SurfaceId surfaceId) {
+  capturedRootShadowNodesForConsistency_.erase(surfaceId);
+}
+
 #pragma mark - ShadowTreeRevisionProvider
 
 RootShadowNode::Shared
@@ -35,7 +40,7 @@ LazyShadowTreeRevisionConsistencyManager::getCurrentRevision(
   RootShadowNode::Shared rootShadowNode;
 
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
-    rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+    rootShadowNode = shadowTree.getCommittedRevision().rootShadowNode;
   });
 
   capturedRootShadowNodesForConsistency_.emplace(surfaceId, rootShadowNode);
@@ -32,6 +32,13 @@ class LazyShadowTreeRevisionConsistencyManager
       SurfaceId surfaceId,
       RootShadowNode::Shared rootShadowNode);
 
+  /*
+   * Drops the revision captured for the given surface, so that the next read
+   * captures the last committed one. Used after pipelined commits, whose
+   * revision is only published later.
+   */
+  void resetCurrentRevision(SurfaceId surfaceId);
+
 #pragma mark - ShadowTreeRevisionProvider
 
   RootShadowNode::Shared getCurrentRevision(SurfaceId surfaceId) override;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/renderer/uimanager/primitives.h>
+#include <react/utils/ContextContainer.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+class UIManagerBindingTest : public ::testing::Test {
+ protected:
+  UIManagerBindingTest() {
+    auto contextContainer = std::make_shared<ContextContainer>();
+    auto providerRegistry =
+        std::make_shared<ComponentDescriptorProviderRegistry>();
+    auto componentDescriptorRegistry =
+        providerRegistry->createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                EventDispatcher::Shared{}, contextContainer, nullptr});
+    providerRegistry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    RuntimeExecutor runtimeExecutor =
+        [](const std::function<void(jsi::Runtime&)>& /*unused*/) {};
+    uiManager_ = std::make_shared<UIManager>(
+        runtimeExecutor, [](std::function<void()>&&) {}, contextContainer);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+    UIManagerBinding::createAndInstallIfNeeded(*runtime_, uiManager_);
+  }
+
+  ~UIManagerBindingTest() override {
+    UIManagerBinding::getBinding(*runtime_)->invalidate();
+  }
+
+  /*
+   * Calls `createNodes` with the instruction list `instructions` (a
+   * JavaScript expression).
+   */
+  jsi::Value createNodes(const std::string& instructions) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(
+            "nativeFabricUIManager.createNodes(1, " + instructions + ")"),
+        "createNodes.js");
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_{hermes::makeHermesRuntime()};
+  std::shared_ptr<UIManager> uiManager_;
+};
+
+TEST_F(UIManagerBindingTest, createNodesBuildsTree) {
+  auto nodes = createNodes(
+                   "[0, 2, 'View', {}, {},"
+                   " 0, 4, 'View', {}, {},"
+                   " 0, 6, 'View', {}, {},"
+                   " 1, 0, 1,"
+                   " 1, 0, 2]")
+                   .asObject(*runtime_)
+                   .asArray(*runtime_);
+  ASSERT_EQ(nodes.length(*runtime_), 3);
+
+  auto parent =
+      shadowNodeFromValue(*runtime_, nodes.getValueAtIndex(*runtime_, 0));
+  EXPECT_EQ(parent->getTag(), 2);
+  ASSERT_EQ(parent->getChildren().size(), 2);
+  EXPECT_EQ(parent->getChildren()[0]->getTag(), 4);
+  EXPECT_EQ(parent->getChildren()[1]->getTag(), 6);
+}
+
+TEST_F(UIManagerBindingTest, createNodesRejectsInvalidInstructions) {
+  // Unknown, fractional, negative and non-numeric opcodes.
+  EXPECT_THROW(createNodes("[2, 2, 'View', {}, {}]"), jsi::JSError);
+  EXPECT_THROW(createNodes("[0.5, 2, 'View', {}, {}]"), jsi::JSError);
+  EXPECT_THROW(createNodes("[-1, 2, 'View', {}, {}]"), jsi::JSError);
+  EXPECT_THROW(createNodes("['0', 2, 'View', {}, {}]"), jsi::JSError);
+
+  // Truncated instruction.
+  EXPECT_THROW(createNodes("[0, 2, 'View', {}]"), jsi::JSError);
+}
+
+TEST_F(UIManagerBindingTest, createNodesRejectsInvalidNodeIndices) {
+  auto createTwoNodesAndAppend = [&](const std::string& parent,
+                                     const std::string& child) {
+    return createNodes(
+        "[0, 2, 'View', {}, {}, 0, 4, 'View', {}, {}, 1, " + parent + ", " +
+        child + "]");
+  };
+
+  EXPECT_NO_THROW(createTwoNodesAndAppend("0", "1"));
+  EXPECT_THROW(createTwoNodesAndAppend("0", "2"), jsi::JSError);
+  EXPECT_THROW(createTwoNodesAndAppend("-1", "1"), jsi::JSError);
+  EXPECT_THROW(createTwoNodesAndAppend("0", "0.5"), jsi::JSError);
+  EXPECT_THROW(createTwoNodesAndAppend("NaN", "1"), jsi::JSError);
+  EXPECT_THROW(createTwoNodesAndAppend("0", "Infinity"), jsi::JSError);
+  EXPECT_THROW(createTwoNodesAndAppend("0", "1e300"), jsi::JSError);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+class UIManagerPipelinedCommitTest : public ::testing::Test {
+ protected:
+  UIManagerPipelinedCommitTest() {
+    auto contextContainer = std::make_shared<ContextContainer>();
+
+    ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+    auto componentDescriptorRegistry =
+        componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                EventDispatcher::Shared{}, contextContainer, nullptr});
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    componentDescriptorProviderRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    builder_ = std::make_unique<ComponentBuilder>(componentDescriptorRegistry);
+
+    RuntimeExecutor runtimeExecutor =
+        [](std::function<void(jsi::Runtime & runtime)>&& /*callback*/) {};
+    BackgroundExecutor backgroundExecutor =
+        [](std::function<void()>&& /*callback*/) {};
+    uiManager_ = std::make_unique<UIManager>(
+        runtimeExecutor, backgroundExecutor, contextContainer);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+    uiManager_->startSurface(
+        std::make_unique<ShadowTree>(
+            surfaceId_,
+            LayoutConstraints{{0, 0}, {500, 500}},
+            LayoutContext{},
+            *uiManager_,
+            *contextContainer),
+        "test",
+        folly::dynamic::object,
+        DisplayMode::Visible);
+  }
+
+  ~UIManagerPipelinedCommitTest() override {
+    uiManager_->stopSurface(surfaceId_);
+  }
+
+  std::shared_ptr<ViewShadowNode> buildView() {
+    // clang-format off
+    auto element =
+        Element<ViewShadowNode>()
+          .tag(2)
+          .surfaceId(surfaceId_)
+          .props([] {
+            auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+            auto &yogaStyle = sharedProps->yogaStyle;
+            yogaStyle.setMargin(yoga::Edge::Left, yoga::value::points(10));
+            yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(100));
+            yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(50));
+            return sharedProps;
+          });
+    // clang-format on
+    return builder_->build(element);
+  }
+
+  SurfaceId surfaceId_{1};
+  std::unique_ptr<ComponentBuilder> builder_;
+  std::unique_ptr<UIManager> uiManager_;
+};
+
+TEST_F(UIManagerPipelinedCommitTest, layoutIsReadableRightAfterCommit) {
+  auto viewShadowNode = buildView();
+
+  uiManager_->completeSurface(
+      surfaceId_,
+      std::make_shared<ShadowNode::ListOfShared>(
+          ShadowNode::ListOfShared{viewShadowNode}),
+      {.pipelined = true});
+
+  // Layout runs on the commit pipeline; reading it must not observe the tree
+  // from before layout.
+  auto layoutMetrics = uiManager_->getRelativeLayoutMetrics(
+      *viewShadowNode, nullptr, {.includeTransform = false});
+  EXPECT_EQ(layoutMetrics.frame.origin.x, 10);
+  EXPECT_EQ(layoutMetrics.frame.size.width, 100);
+  EXPECT_EQ(layoutMetrics.frame.size.height, 50);
+
+  auto newestClone = uiManager_->getNewestCloneOfShadowNode(*viewShadowNode);
+  ASSERT_NE(newestClone, nullptr);
+  auto& layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode&>(*newestClone);
+  EXPECT_EQ(layoutableShadowNode.getLayoutMetrics().frame.size.width, 100);
+
+  auto hitShadowNode = uiManager_->findNodeAtPoint(viewShadowNode, {50, 25});
+  ASSERT_NE(hitShadowNode, nullptr);
+  EXPECT_EQ(hitShadowNode->getTag(), 2);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+/*
+ * Builds a tree of `nodeCount` views, with four children per view, the way
+ * the renderer does on initial render: one host call per node and per edge.
+ */
+static constexpr auto kCreateNodesOneByOne = R"((function (rootTag, nodeCount) {
+  var createNode = nativeFabricUIManager.createNode;
+  var appendChild = nativeFabricUIManager.appendChild;
+  var nodes = [];
+  for (var i = 0; i < nodeCount; i++) {
+    var props = {nativeID: 'view' + i, opacity: 0.5, flex: 1};
+    var node = createNode(i * 2 + 2, 'View', rootTag, props, {});
+    if (i > 0) {
+      appendChild(nodes[(i - 1) >> 2], node);
+    }
+    nodes.push(node);
+  }
+  return nodes;
+}))";
+
+/*
+ * Builds the same tree with a single `createNodes` call.
+ */
+static constexpr auto kCreateNodesInBatch = R"((function (rootTag, nodeCount) {
+  var instructions = [];
+  for (var i = 0; i < nodeCount; i++) {
+    var props = {nativeID: 'view' + i, opacity: 0.5, flex: 1};
+    instructions.push(0, i * 2 + 2, 'View', props, {});
+    if (i > 0) {
+      instructions.push(1, (i - 1) >> 2, i);
+    }
+  }
+  return nativeFabricUIManager.createNodes(rootTag, instructions);
+}))";
+
+static void buildTree(benchmark::State& state, const char* source) {
+  auto nodeCount = static_cast<int>(state.range(0));
+
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto providerRegistry =
+      std::make_shared<ComponentDescriptorProviderRegistry>();
+  auto componentDescriptorRegistry =
+      providerRegistry->createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, contextContainer, nullptr});
+  providerRegistry->add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  RuntimeExecutor runtimeExecutor =
+      [](const std::function<void(jsi::Runtime&)>& /*unused*/) {};
+  auto uiManager = std::make_shared<UIManager>(
+      runtimeExecutor, [](std::function<void()>&&) {}, contextContainer);
+  uiManager->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+  auto runtime = hermes::makeHermesRuntime();
+  UIManagerBinding::createAndInstallIfNeeded(*runtime, uiManager);
+  auto function =
+      runtime
+          ->evaluateJavaScript(
+              std::make_shared<jsi::StringBuffer>(source), "buildTree.js")
+          .asObject(*runtime)
+          .asFunction(*runtime);
+
+  for (auto _ : state) {
+    auto nodes = function.call(*runtime, 1, nodeCount);
+    benchmark::DoNotOptimize(nodes);
+
+    state.PauseTiming();
+    nodes = jsi::Value::undefined();
+    runtime->instrumentation().collectGarbage("benchmark");
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nodeCount);
+
+  UIManagerBinding::getBinding(*runtime)->invalidate();
+}
+
+static void createNodesOneByOne(benchmark::State& state) {
+  buildTree(state, kCreateNodesOneByOne);
+}
+BENCHMARK(createNodesOneByOne)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+static void createNodesInBatch(benchmark::State& state) {
+  buildTree(state, kCreateNodesInBatch);
+}
+BENCHMARK(createNodesInBatch)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -14,5 +14,10 @@ bool CoreFeatures::enableGranularScrollViewStateUpdatesIOS = false;
 bool CoreFeatures::enableGranularShadowTreeStateReconciliation = false;
 bool CoreFeatures::excludeYogaFromRawProps = false;
 bool CoreFeatures::enableReportEventPaintTime = false;
+bool CoreFeatures::enablePipelinedCommits = false;
+bool CoreFeatures::enableMutationCompaction = false;
+bool CoreFeatures::enableDeferredReclamation = false;
+bool CoreFeatures::enablePooledShadowNodes = false;
+bool CoreFeatures::enableBatchedStateUpdates = false;
 
 } // namespace facebook::react
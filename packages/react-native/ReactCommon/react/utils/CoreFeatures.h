@@ -33,6 +33,28 @@ class CoreFeatures {
   // Report paint time inside the Event Timing API implementation
   // (PerformanceObserver).
   static bool enableReportEventPaintTime;
+
+  // When enabled, React commits hand the new tree off to a dedicated worker
+  // which performs layout and diffing off the JavaScript thread.
+  static bool enablePipelinedCommits;
+
+  // When enabled, mutations produced by a `MountingOverrideDelegate` are
+  // compacted before being handed to the mounting layer. Not compatible with
+  // view preallocation (Android).
+  static bool enableMutationCompaction;
+
+  // When enabled, replaced shadow trees and mounted mutation lists are
+  // released on a low priority worker thread (see `ReclamationQueue`) instead
+  // of the JavaScript and main threads.
+  static bool enableDeferredReclamation;
+
+  // When enabled, shadow nodes and their families are allocated from
+  // per-size slab pools with thread-local caches (see `PoolAllocator`).
+  static bool enablePooledShadowNodes;
+
+  // When enabled, state updates queued for the same surface are applied in a
+  // single commit instead of one commit each.
+  static bool enableBatchedStateUpdates;
 };
 
 } // namespace facebook::react
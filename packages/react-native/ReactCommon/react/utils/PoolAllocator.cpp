@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PoolAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace facebook::react {
+
+// Blocks moved between a thread cache and its pool at once.
+static constexpr size_t kBatchSize = 32;
+
+// A thread cache holding more than this returns a batch to the pool.
+static constexpr size_t kMaxCachedBlocks = kBatchSize * 4;
+
+static constexpr size_t kSlabSize = 64 * 1024;
+
+// Sizes are rounded up to this granularity to share pools between types.
+static constexpr size_t kSizeGranularity = 16;
+
+static std::atomic<size_t> reservedSize{0};
+
+struct SlabPool::LocalCache {
+  SlabPool* pool{nullptr};
+  FreeBlock* freeBlocks{nullptr};
+  size_t count{0};
+};
+
+namespace {
+
+struct PoolRegistry {
+  std::mutex mutex;
+  std::vector<SlabPool*> pools; // Protected by `mutex`.
+};
+
+PoolRegistry& poolRegistry() {
+  // Intentionally leaked: blocks may be freed during static destruction.
+  static auto* registry = new PoolRegistry();
+  return *registry;
+}
+
+} // namespace
+
+/*
+ * Caches of the current thread, indexed by pool. Returned to their pools when
+ * the thread exits.
+ */
+struct ThreadCaches {
+  std::vector<SlabPool::LocalCache> caches;
+
+  ~ThreadCaches();
+};
+
+static thread_local ThreadCaches threadCaches;
+
+// Set once `threadCaches` of the current thread is destroyed; objects freed
+// by thread-local destructors running later bypass the cache.
+static thread_local bool threadCachesDestroyed{false};
+
+SlabPool& SlabPool::forSize(size_t size, size_t alignment) {
+  alignment = std::max(alignment, alignof(FreeBlock));
+  auto blockSize = std::max(size, sizeof(FreeBlock));
+  blockSize = (blockSize + kSizeGranularity - 1) / kSizeGranularity *
+      kSizeGranularity;
+  blockSize = (blockSize + alignment - 1) / alignment * alignment;
+
+  auto& registry = poolRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (auto* pool : registry.pools) {
+    if (pool->blockSize_ == blockSize && pool->alignment_ == alignment) {
+      return *pool;
+    }
+  }
+
+  auto* pool = new SlabPool(registry.pools.size(), blockSize, alignment);
+  registry.pools.push_back(pool);
+  return *pool;
+}
+
+size_t SlabPool::getReservedSize() {
+  return reservedSize.load(std::memory_order_relaxed);
+}
+
+SlabPool::SlabPool(size_t index, size_t blockSize, size_t alignment)
+    : index_(index), blockSize_(blockSize), alignment_(alignment) {}
+
+size_t SlabPool::getBlockSize() const {
+  return blockSize_;
+}
+
+SlabPool::LocalCache* SlabPool::localCache() {
+  if (threadCachesDestroyed) {
+    return nullptr;
+  }
+
+  auto& caches = threadCaches.caches;
+  if (caches.size() <= index_) {
+    caches.resize(index_ + 1);
+  }
+  auto& cache = caches[index_];
+  cache.pool = this;
+  return &cache;
+}
+
+void* SlabPool::allocate() {
+  auto* cache = localCache();
+  if (cache == nullptr) {
+    auto transientCache = LocalCache{this};
+    refill(transientCache);
+    auto* block = transientCache.freeBlocks;
+    transientCache.freeBlocks = block->next;
+    returnAll(transientCache);
+    return block;
+  }
+
+  if (cache->freeBlocks == nullptr) {
+    refill(*cache);
+  }
+
+  auto* block = cache->freeBlocks;
+  cache->freeBlocks = block->next;
+  cache->count--;
+  return block;
+}
+
+void SlabPool::deallocate(void* block) noexcept {
+  auto* freeBlock = static_cast<FreeBlock*>(block);
+
+  auto* cache = localCache();
+  if (cache == nullptr) {
+    std::scoped_lock lock(mutex_);
+    freeBlock->next = freeBlocks_;
+    freeBlocks_ = freeBlock;
+    return;
+  }
+
+  freeBlock->next = cache->freeBlocks;
+  cache->freeBlocks = freeBlock;
+  cache->count++;
+
+  if (cache->count > kMaxCachedBlocks) {
+    spill(*cache);
+  }
+}
+
+void SlabPool::refill(LocalCache& cache) {
+  std::scoped_lock lock(mutex_);
+
+  if (freeBlocks_ == nullptr) {
+    auto blockCount = std::max(kSlabSize / blockSize_, kBatchSize);
+    auto* slab = static_cast<std::byte*>(::operator new(
+        blockCount * blockSize_, std::align_val_t{alignment_}));
+    slabs_.push_back(slab);
+    reservedSize.fetch_add(blockCount * blockSize_, std::memory_order_relaxed);
+
+    // Threading the list from the end keeps blocks in address order.
+    for (auto index = blockCount; index > 0; index--) {
+      auto* freeBlock =
+          reinterpret_cast<FreeBlock*>(slab + (index - 1) * blockSize_);
+      freeBlock->next = freeBlocks_;
+      freeBlocks_ = freeBlock;
+    }
+  }
+
+  for (size_t index = 0; index < kBatchSize && freeBlocks_ != nullptr;
+       index++) {
+    auto* freeBlock = freeBlocks_;
+    freeBlocks_ = freeBlock->next;
+    freeBlock->next = cache.freeBlocks;
+    cache.freeBlocks = freeBlock;
+    cache.count++;
+  }
+}
+
+void SlabPool::spill(LocalCache& cache) noexcept {
+  // Detaching the batch before taking the lock keeps the critical section
+  // down to splicing two lists.
+  auto* first = cache.freeBlocks;
+  auto* last = first;
+  for (size_t index = 1; index < kBatchSize; index++) {
+    last = last->next;
+  }
+  cache.freeBlocks = last->next;
+  cache.count -= kBatchSize;
+
+  std::scoped_lock lock(mutex_);
+  last->next = freeBlocks_;
+  freeBlocks_ = first;
+}
+
+void SlabPool::returnAll(LocalCache& cache) noexcept {
+  if (cache.freeBlocks == nullptr) {
+    return;
+  }
+
+  auto* last = cache.freeBlocks;
+  while (last->next != nullptr) {
+    last = last->next;
+  }
+
+  std::scoped_lock lock(mutex_);
+  last->next = freeBlocks_;
+  freeBlocks_ = cache.freeBlocks;
+  cache.freeBlocks = nullptr;
+  cache.count = 0;
+}
+
+ThreadCaches::~ThreadCaches() {
+  threadCachesDestroyed = true;
+  for (auto& cache : caches) {
+    if (cache.pool != nullptr) {
+      cache.pool->returnAll(cache);
+    }
+  }
+}
+
+} // namespace facebook::react
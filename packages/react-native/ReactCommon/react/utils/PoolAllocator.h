@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace facebook::react {
+
+struct ThreadCaches;
+
+/*
+ * Process-wide pool of equally sized memory blocks carved out of large slabs.
+ * Every thread keeps a cache of free blocks, so allocating and freeing only
+ * takes the pool's mutex when a batch of blocks is moved between the cache
+ * and the pool. Slabs are never returned to the system.
+ */
+class SlabPool final {
+ public:
+  /*
+   * Returns the pool serving blocks of (at least) the given size and
+   * alignment. Pools are shared by all types of the same size class and are
+   * never destroyed.
+   * Can be called from any thread.
+   */
+  static SlabPool& forSize(size_t size, size_t alignment);
+
+  /*
+   * Total size of the slabs allocated by all pools, in bytes.
+   */
+  static size_t getReservedSize();
+
+  /*
+   * Not copyable, not movable.
+   */
+  SlabPool(const SlabPool& other) = delete;
+  SlabPool& operator=(const SlabPool& other) = delete;
+
+  /*
+   * Can be called from any thread; blocks can be freed on a different
+   * thread than the one which allocated them.
+   */
+  void* allocate();
+  void deallocate(void* block) noexcept;
+
+  size_t getBlockSize() const;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct LocalCache;
+  friend struct ThreadCaches;
+
+  SlabPool(size_t index, size_t blockSize, size_t alignment);
+
+  LocalCache* localCache();
+  void refill(LocalCache& cache);
+  void spill(LocalCache& cache) noexcept;
+  void returnAll(LocalCache& cache) noexcept;
+
+  const size_t index_;
+  const size_t blockSize_;
+  const size_t alignment_;
+
+  std::mutex mutex_;
+  FreeBlock* freeBlocks_{nullptr}; // Protected by `mutex_`.
+  std::vector<void*> slabs_; // Protected by `mutex_`.
+};
+
+/*
+ * Standard allocator serving single objects from a `SlabPool`, meant for
+ * `std::allocate_shared` of frequently created objects such as shadow nodes:
+ * the object and its control block then live in one pooled block.
+ * Arrays fall back to the global allocator.
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& /*other*/) noexcept {}
+
+  T* allocate(size_t count) {
+    if (count != 1) {
+      return static_cast<T*>(::operator new(
+          count * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+    return static_cast<T*>(pool().allocate());
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept {
+    if (count != 1) {
+      ::operator delete(pointer, std::align_val_t{alignof(T)});
+      return;
+    }
+    pool().deallocate(pointer);
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& /*rhs*/) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>& /*rhs*/) const noexcept {
+    return false;
+  }
+
+ private:
+  static SlabPool& pool() {
+    static auto& pool = SlabPool::forSize(sizeof(T), alignof(T));
+    return pool;
+  }
+};
+
+} // namespace facebook::react
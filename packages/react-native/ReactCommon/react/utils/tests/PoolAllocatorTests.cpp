@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/utils/PoolAllocator.h>
+
+namespace facebook::react {
+
+namespace {
+
+struct Node {
+  explicit Node(int value) : value(value) {}
+
+  int value;
+  double payload[6]{};
+};
+
+struct alignas(64) OverAlignedNode {
+  int value{0};
+};
+
+} // namespace
+
+TEST(PoolAllocatorTests, testSharedObjectsAreDistinctAndReused) {
+  auto allocator = PoolAllocator<Node>{};
+
+  auto nodes = std::vector<std::shared_ptr<Node>>{};
+  auto addresses = std::unordered_set<const Node*>{};
+  for (auto index = 0; index < 1000; index++) {
+    nodes.push_back(std::allocate_shared<Node>(allocator, index));
+    addresses.insert(nodes.back().get());
+  }
+  EXPECT_EQ(addresses.size(), nodes.size());
+  for (auto index = 0; index < 1000; index++) {
+    EXPECT_EQ(nodes[index]->value, index);
+  }
+
+  auto reservedSize = SlabPool::getReservedSize();
+  nodes.clear();
+  for (auto index = 0; index < 1000; index++) {
+    nodes.push_back(std::allocate_shared<Node>(allocator, index));
+  }
+  EXPECT_EQ(SlabPool::getReservedSize(), reservedSize);
+}
+
+TEST(PoolAllocatorTests, testAlignment) {
+  auto nodes = std::vector<std::shared_ptr<OverAlignedNode>>{};
+  for (auto index = 0; index < 100; index++) {
+    nodes.push_back(std::allocate_shared<OverAlignedNode>(
+        PoolAllocator<OverAlignedNode>{}));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(nodes.back().get()) % 64, 0);
+  }
+}
+
+TEST(PoolAllocatorTests, testObjectsCanBeFreedOnAnotherThread) {
+  auto allocator = PoolAllocator<Node>{};
+
+  for (auto round = 0; round < 10; round++) {
+    auto nodes = std::vector<std::shared_ptr<Node>>{};
+    for (auto index = 0; index < 1000; index++) {
+      nodes.push_back(std::allocate_shared<Node>(allocator, index));
+    }
+    std::thread([nodes = std::move(nodes)]() mutable { nodes.clear(); })
+        .join();
+  }
+
+  auto node = std::allocate_shared<Node>(allocator, 42);
+  EXPECT_EQ(node->value, 42);
+}
+
+TEST(PoolAllocatorTests, testArraysUseGlobalAllocator) {
+  auto values = std::vector<int, PoolAllocator<int>>{};
+  for (auto index = 0; index < 1000; index++) {
+    values.push_back(index);
+  }
+  EXPECT_EQ(values[999], 999);
+}
+
+} // namespace facebook::react
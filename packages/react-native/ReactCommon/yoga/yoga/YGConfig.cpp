@@ -8,6 +8,7 @@
 #include <yoga/Yoga.h>
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/debug/Log.h>
+#include <yoga/node/NodeArena.h>
 
 using namespace facebook;
 using namespace facebook::yoga;
@@ -90,3 +91,17 @@ void YGConfigSetCloneNodeFunc(
     const YGCloneNodeFunc callback) {
   resolveRef(config)->setCloneNodeCallback(callback);
 }
+
+void YGConfigSetUseNodeArena(const YGConfigRef config, const bool enabled) {
+  resolveRef(config)->setNodeArenaEnabled(enabled);
+}
+
+bool YGConfigGetUseNodeArena(const YGConfigConstRef config) {
+  return resolveRef(config)->isNodeArenaEnabled();
+}
+
+void YGConfigResetNodeArena(const YGConfigRef config) {
+  if (auto nodeArena = resolveRef(config)->getNodeArena()) {
+    nodeArena->reset();
+  }
+}
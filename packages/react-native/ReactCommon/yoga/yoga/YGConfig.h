@@ -155,4 +155,26 @@ YG_EXPORT void YGConfigSetCloneNodeFunc(
     YGConfigRef config,
     YGCloneNodeFunc callback);
 
+/**
+ * Allocates nodes created with the config (including clones of them) from an
+ * arena owned by the config, instead of with one heap allocation per node.
+ * Nodes from the arena may still be freed individually, and are all freed
+ * together with the config. Nodes created before the arena was enabled are not
+ * affected.
+ */
+YG_EXPORT void YGConfigSetUseNodeArena(YGConfigRef config, bool enabled);
+
+/**
+ * Whether nodes created with the config are allocated from its arena.
+ */
+YG_EXPORT bool YGConfigGetUseNodeArena(YGConfigConstRef config);
+
+/**
+ * Frees every node allocated from the arena of the config at once, e.g. after
+ * laying out a tree which is then thrown away. This is much cheaper than
+ * freeing each node, and keeps the memory of the arena for the next tree.
+ * Nodes not allocated from the arena must not be connected to those which are.
+ */
+YG_EXPORT void YGConfigResetNodeArena(YGConfigRef config);
+
 YG_EXTERN_C_END
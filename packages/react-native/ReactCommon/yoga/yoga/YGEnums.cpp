@@ -61,6 +61,8 @@ const char* YGDisplayToString(const YGDisplay value) {
       return "flex";
     case YGDisplayNone:
       return "none";
+    case YGDisplayGrid:
+      return "grid";
   }
   return "unknown";
 }
@@ -129,6 +131,20 @@ const char* YGFlexDirectionToString(const YGFlexDirection value) {
   return "unknown";
 }
 
+const char* YGGridTrackUnitToString(const YGGridTrackUnit value) {
+  switch (value) {
+    case YGGridTrackUnitAuto:
+      return "auto";
+    case YGGridTrackUnitPoint:
+      return "point";
+    case YGGridTrackUnitPercent:
+      return "percent";
+    case YGGridTrackUnitFraction:
+      return "fraction";
+  }
+  return "unknown";
+}
+
 const char* YGGutterToString(const YGGutter value) {
   switch (value) {
     case YGGutterColumn:
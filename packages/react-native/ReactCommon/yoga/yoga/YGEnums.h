@@ -38,7 +38,8 @@ YG_ENUM_DECL(
 YG_ENUM_DECL(
     YGDisplay,
     YGDisplayFlex,
-    YGDisplayNone)
+    YGDisplayNone,
+    YGDisplayGrid)
 
 YG_ENUM_DECL(
     YGEdge,
@@ -73,6 +74,13 @@ YG_ENUM_DECL(
     YGFlexDirectionRow,
     YGFlexDirectionRowReverse)
 
+YG_ENUM_DECL(
+    YGGridTrackUnit,
+    YGGridTrackUnitAuto,
+    YGGridTrackUnitPoint,
+    YGGridTrackUnitPercent,
+    YGGridTrackUnitFraction)
+
 YG_ENUM_DECL(
     YGGutter,
     YGGutterColumn,
@@ -13,18 +13,33 @@
 #include <yoga/debug/Log.h>
 #include <yoga/event/event.h>
 #include <yoga/node/Node.h>
+#include <yoga/node/NodeArena.h>
 
 using namespace facebook;
 using namespace facebook::yoga;
 
+namespace {
+
+void deallocateNode(yoga::Node* node) {
+  if (node->isArenaAllocated()) {
+    NodeArena::deallocate(node);
+  } else {
+    delete node;
+  }
+}
+
+} // namespace
+
 YGNodeRef YGNodeNew(void) {
   return YGNodeNewWithConfig(YGConfigGetDefault());
 }
 
 YGNodeRef YGNodeNewWithConfig(const YGConfigConstRef config) {
-  auto* node = new yoga::Node{resolveRef(config)};
   yoga::assertFatal(
       config != nullptr, "Tried to construct YGNode with null config");
+  auto* node = resolveRef(config)->isNodeArenaEnabled()
+      ? resolveRef(config)->getNodeArena()->allocate(resolveRef(config))
+      : new yoga::Node{resolveRef(config)};
   Event::publish<Event::NodeAllocation>(node, {config});
 
   return node;
@@ -32,7 +47,11 @@ YGNodeRef YGNodeNewWithConfig(const YGConfigConstRef config) {
 
 YGNodeRef YGNodeClone(YGNodeConstRef oldNodeRef) {
   auto oldNode = resolveRef(oldNodeRef);
-  const auto node = new yoga::Node(*oldNode);
+  const auto config = oldNode->getConfig();
+  auto node = config->isNodeArenaEnabled()
+      ? config->getNodeArena()->allocate(*oldNode)
+      : new yoga::Node(*oldNode);
+  node->setArenaAllocated(config->isNodeArenaEnabled());
   Event::publish<Event::NodeAllocation>(node, {node->getConfig()});
   node->setOwner(nullptr);
   return node;
@@ -55,7 +74,7 @@ void YGNodeFree(const YGNodeRef nodeRef) {
   node->clearChildren();
 
   Event::publish<Event::NodeDeallocation>(node, {YGNodeGetConfig(node)});
-  delete resolveRef(node);
+  deallocateNode(node);
 }
 
 void YGNodeFreeRecursive(YGNodeRef rootRef) {
@@ -77,7 +96,7 @@ void YGNodeFreeRecursive(YGNodeRef rootRef) {
 
 void YGNodeFinalize(const YGNodeRef node) {
   Event::publish<Event::NodeDeallocation>(node, {YGNodeGetConfig(node)});
-  delete resolveRef(node);
+  deallocateNode(resolveRef(node));
 }
 
 void YGNodeReset(YGNodeRef node) {
@@ -5,6 +5,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <limits>
+
 #include <yoga/Yoga.h>
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/node/Node.h>
@@ -32,6 +34,49 @@ void updateStyle(YGNodeRef node, IdxT idx, ValueT value) {
   }
 }
 
+GridTrackList gridTrackList(const YGGridTrackSize* tracks, size_t count) {
+  GridTrackList trackList;
+  trackList.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    switch (scopedEnum(tracks[i].unit)) {
+      case GridTrackUnit::Auto:
+        trackList.push_back(GridTrackSize::ofAuto());
+        break;
+      case GridTrackUnit::Point:
+        trackList.push_back(GridTrackSize::points(tracks[i].value));
+        break;
+      case GridTrackUnit::Percent:
+        trackList.push_back(GridTrackSize::percent(tracks[i].value));
+        break;
+      case GridTrackUnit::Fraction:
+        trackList.push_back(GridTrackSize::fraction(tracks[i].value));
+        break;
+    }
+  }
+  return trackList;
+}
+
+YGGridTrackSize gridTrackAt(const GridTrackList& trackList, size_t index) {
+  yoga::assertFatal(index < trackList.size(), "Grid track index out of range");
+  const auto& trackSize = trackList[index];
+  return {trackSize.value(), unscopedEnum(trackSize.unit())};
+}
+
+int16_t gridLine(int line) {
+  yoga::assertFatal(
+      line >= std::numeric_limits<int16_t>::min() &&
+          line <= std::numeric_limits<int16_t>::max(),
+      "Grid line out of range");
+  return static_cast<int16_t>(line);
+}
+
+uint16_t gridSpan(int span) {
+  yoga::assertFatal(
+      span >= 1 && span <= std::numeric_limits<uint16_t>::max(),
+      "Grid span must be between 1 and 65535");
+  return static_cast<uint16_t>(span);
+}
+
 } // namespace
 
 void YGNodeCopyStyle(YGNodeRef dstNode, YGNodeConstRef srcNode) {
@@ -388,3 +433,99 @@ void YGNodeStyleSetMaxHeightPercent(
 YGValue YGNodeStyleGetMaxHeight(const YGNodeConstRef node) {
   return (YGValue)resolveRef(node)->style().maxDimension(Dimension::Height);
 }
+
+void YGNodeStyleSetGridTemplateColumns(
+    const YGNodeRef node,
+    const YGGridTrackSize* tracks,
+    const size_t trackCount) {
+  updateStyle<&Style::gridTemplateColumns, &Style::setGridTemplateColumns>(
+      node, gridTrackList(tracks, trackCount));
+}
+
+size_t YGNodeStyleGetGridTemplateColumnCount(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridTemplateColumns().size();
+}
+
+YGGridTrackSize YGNodeStyleGetGridTemplateColumn(
+    const YGNodeConstRef node,
+    const size_t index) {
+  return gridTrackAt(resolveRef(node)->style().gridTemplateColumns(), index);
+}
+
+void YGNodeStyleSetGridTemplateRows(
+    const YGNodeRef node,
+    const YGGridTrackSize* tracks,
+    const size_t trackCount) {
+  updateStyle<&Style::gridTemplateRows, &Style::setGridTemplateRows>(
+      node, gridTrackList(tracks, trackCount));
+}
+
+size_t YGNodeStyleGetGridTemplateRowCount(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridTemplateRows().size();
+}
+
+YGGridTrackSize YGNodeStyleGetGridTemplateRow(
+    const YGNodeConstRef node,
+    const size_t index) {
+  return gridTrackAt(resolveRef(node)->style().gridTemplateRows(), index);
+}
+
+void YGNodeStyleSetGridColumnStart(const YGNodeRef node, const int line) {
+  auto placement = resolveRef(node)->style().gridColumn();
+  placement.start = gridLine(line);
+  updateStyle<&Style::gridColumn, &Style::setGridColumn>(node, placement);
+}
+
+int YGNodeStyleGetGridColumnStart(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridColumn().start;
+}
+
+void YGNodeStyleSetGridColumnEnd(const YGNodeRef node, const int line) {
+  auto placement = resolveRef(node)->style().gridColumn();
+  placement.end = gridLine(line);
+  updateStyle<&Style::gridColumn, &Style::setGridColumn>(node, placement);
+}
+
+int YGNodeStyleGetGridColumnEnd(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridColumn().end;
+}
+
+void YGNodeStyleSetGridColumnSpan(const YGNodeRef node, const int span) {
+  auto placement = resolveRef(node)->style().gridColumn();
+  placement.span = gridSpan(span);
+  updateStyle<&Style::gridColumn, &Style::setGridColumn>(node, placement);
+}
+
+int YGNodeStyleGetGridColumnSpan(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridColumn().span;
+}
+
+void YGNodeStyleSetGridRowStart(const YGNodeRef node, const int line) {
+  auto placement = resolveRef(node)->style().gridRow();
+  placement.start = gridLine(line);
+  updateStyle<&Style::gridRow, &Style::setGridRow>(node, placement);
+}
+
+int YGNodeStyleGetGridRowStart(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridRow().start;
+}
+
+void YGNodeStyleSetGridRowEnd(const YGNodeRef node, const int line) {
+  auto placement = resolveRef(node)->style().gridRow();
+  placement.end = gridLine(line);
+  updateStyle<&Style::gridRow, &Style::setGridRow>(node, placement);
+}
+
+int YGNodeStyleGetGridRowEnd(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridRow().end;
+}
+
+void YGNodeStyleSetGridRowSpan(const YGNodeRef node, const int span) {
+  auto placement = resolveRef(node)->style().gridRow();
+  placement.span = gridSpan(span);
+  updateStyle<&Style::gridRow, &Style::setGridRow>(node, placement);
+}
+
+int YGNodeStyleGetGridRowSpan(const YGNodeConstRef node) {
+  return resolveRef(node)->style().gridRow().span;
+}
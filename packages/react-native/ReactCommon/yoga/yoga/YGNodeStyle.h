@@ -122,4 +122,52 @@ YG_EXPORT YGValue YGNodeStyleGetMaxHeight(YGNodeConstRef node);
 YG_EXPORT void YGNodeStyleSetAspectRatio(YGNodeRef node, float aspectRatio);
 YG_EXPORT float YGNodeStyleGetAspectRatio(YGNodeConstRef node);
 
+/**
+ * Size of a row or column track of a grid container. `value` is ignored for
+ * YGGridTrackUnitAuto.
+ */
+typedef struct YGGridTrackSize {
+  float value;
+  YGGridTrackUnit unit;
+} YGGridTrackSize;
+
+YG_EXPORT void YGNodeStyleSetGridTemplateColumns(
+    YGNodeRef node,
+    const YGGridTrackSize* tracks,
+    size_t trackCount);
+YG_EXPORT size_t YGNodeStyleGetGridTemplateColumnCount(YGNodeConstRef node);
+YG_EXPORT YGGridTrackSize
+YGNodeStyleGetGridTemplateColumn(YGNodeConstRef node, size_t index);
+
+YG_EXPORT void YGNodeStyleSetGridTemplateRows(
+    YGNodeRef node,
+    const YGGridTrackSize* tracks,
+    size_t trackCount);
+YG_EXPORT size_t YGNodeStyleGetGridTemplateRowCount(YGNodeConstRef node);
+YG_EXPORT YGGridTrackSize
+YGNodeStyleGetGridTemplateRow(YGNodeConstRef node, size_t index);
+
+/**
+ * Grid lines are 1-based and negative lines count back from the end of the
+ * explicit grid. A line of 0 is not set: the item is placed automatically
+ * and spans `span` tracks.
+ */
+YG_EXPORT void YGNodeStyleSetGridColumnStart(YGNodeRef node, int line);
+YG_EXPORT int YGNodeStyleGetGridColumnStart(YGNodeConstRef node);
+
+YG_EXPORT void YGNodeStyleSetGridColumnEnd(YGNodeRef node, int line);
+YG_EXPORT int YGNodeStyleGetGridColumnEnd(YGNodeConstRef node);
+
+YG_EXPORT void YGNodeStyleSetGridColumnSpan(YGNodeRef node, int span);
+YG_EXPORT int YGNodeStyleGetGridColumnSpan(YGNodeConstRef node);
+
+YG_EXPORT void YGNodeStyleSetGridRowStart(YGNodeRef node, int line);
+YG_EXPORT int YGNodeStyleGetGridRowStart(YGNodeConstRef node);
+
+YG_EXPORT void YGNodeStyleSetGridRowEnd(YGNodeRef node, int line);
+YG_EXPORT int YGNodeStyleGetGridRowEnd(YGNodeConstRef node);
+
+YG_EXPORT void YGNodeStyleSetGridRowSpan(YGNodeRef node, int span);
+YG_EXPORT int YGNodeStyleGetGridRowSpan(YGNodeConstRef node);
+
 YG_EXTERN_C_END
@@ -472,7 +472,7 @@ void layoutAbsoluteChild(
       containingBlockHeight);
 }
 
-void layoutAbsoluteDescendants(
+bool layoutAbsoluteDescendants(
     yoga::Node* containingNode,
     yoga::Node* currentNode,
     SizingMode widthSizingMode,
@@ -484,6 +484,7 @@ void layoutAbsoluteDescendants(
     float currentNodeTopOffsetFromContainingBlock,
     float containingNodeAvailableInnerWidth,
     float containingNodeAvailableInnerHeight) {
+  bool hasLaidOutAbsoluteDescendants = false;
   for (auto child : currentNode->getChildren()) {
     if (child->style().display() == Display::None) {
       continue;
@@ -511,6 +512,7 @@ void layoutAbsoluteDescendants(
           layoutMarkerData,
           currentDepth,
           generationCount);
+      hasLaidOutAbsoluteDescendants = true;
 
       /*
        * At this point the child has its position set but only on its the
@@ -580,19 +582,28 @@ void layoutAbsoluteDescendants(
           currentNodeTopOffsetFromContainingBlock +
           child->getLayout().position(PhysicalEdge::Top);
 
-      layoutAbsoluteDescendants(
-          containingNode,
-          child,
-          widthSizingMode,
-          childDirection,
-          layoutMarkerData,
-          currentDepth + 1,
-          generationCount,
-          childLeftOffsetFromContainingBlock,
-          childTopOffsetFromContainingBlock,
-          containingNodeAvailableInnerWidth,
-          containingNodeAvailableInnerHeight);
+      if (layoutAbsoluteDescendants(
+              containingNode,
+              child,
+              widthSizingMode,
+              childDirection,
+              layoutMarkerData,
+              currentDepth + 1,
+              generationCount,
+              childLeftOffsetFromContainingBlock,
+              childTopOffsetFromContainingBlock,
+              containingNodeAvailableInnerWidth,
+              containingNodeAvailableInnerHeight)) {
+        // The layout of the static child may have come from its cache, in
+        // which case nothing below it is flagged as having a new layout. Flag
+        // the path to the absolute descendants so that readers of the layout
+        // results reach them.
+        child->setHasNewLayout(true);
+        child->setHasNewLayoutInDescendants(true);
+        hasLaidOutAbsoluteDescendants = true;
+      }
     }
   }
+  return hasLaidOutAbsoluteDescendants;
 }
 } // namespace facebook::yoga
@@ -24,7 +24,9 @@ void layoutAbsoluteChild(
     uint32_t depth,
     uint32_t generationCount);
 
-void layoutAbsoluteDescendants(
+// Lays out the absolute descendants of `currentNode` which have
+// `containingNode` as containing block. Returns whether any was laid out.
+bool layoutAbsoluteDescendants(
     yoga::Node* containingNode,
     yoga::Node* currentNode,
     SizingMode widthSizingMode,
@@ -21,6 +21,7 @@
 #include <yoga/algorithm/CalculateLayout.h>
 #include <yoga/algorithm/FlexDirection.h>
 #include <yoga/algorithm/FlexLine.h>
+#include <yoga/algorithm/GridLayout.h>
 #include <yoga/algorithm/PixelGrid.h>
 #include <yoga/algorithm/SizingMode.h>
 #include <yoga/algorithm/TrailingPosition.h>
@@ -432,11 +433,12 @@ static bool measureNodeWithFixedSize(
   return false;
 }
 
-static void zeroOutLayoutRecursively(yoga::Node* const node) {
+void zeroOutLayoutRecursively(yoga::Node* const node) {
   node->getLayout() = {};
   node->setLayoutDimension(0, Dimension::Width);
   node->setLayoutDimension(0, Dimension::Height);
   node->setHasNewLayout(true);
+  node->setHasNewLayoutInDescendants(!node->getChildren().empty());
 
   node->cloneChildrenIfNeeded();
   for (const auto child : node->getChildren()) {
@@ -444,7 +446,7 @@ static void zeroOutLayoutRecursively(yoga::Node* const node) {
   }
 }
 
-static float calculateAvailableInnerDimension(
+float calculateAvailableInnerDimension(
     const yoga::Node* const node,
     const Dimension dimension,
     const float availableDim,
@@ -561,17 +563,91 @@ static float computeFlexBasisForChildren(
   return totalOuterFlexBasis;
 }
 
+// Like boundAxis, for an item whose min and max main size and main padding and
+// border were gathered in a FlexLineItemSizes.
+static inline float boundItemMainSize(
+    const float value,
+    const float minMainSize,
+    const float maxMainSize,
+    const float paddingAndBorderMain) {
+  float boundValue = value;
+  if (maxMainSize >= 0 && value > maxMainSize) {
+    boundValue = maxMainSize;
+  } else if (minMainSize >= 0 && value < minMainSize) {
+    boundValue = minMainSize;
+  }
+  return yoga::maxOrDefined(boundValue, paddingAndBorderMain);
+}
+
+// It sizes each flex item from its flex basis and its share of the remaining
+// free space, within its min and max constraints. The size of an item doesn't
+// depend on the ones of the other items, so the loops are free of loop-carried
+// dependencies and can be vectorized.
+static void distributeRemainingFreeSpace(
+    const FlexLine& flexLine,
+    FlexLineItemSizes& items) {
+  // Copied so that writing the sizes can't alias them
+  const float remainingFreeSpace = flexLine.layout.remainingFreeSpace;
+  const float totalFlexGrowFactors = flexLine.layout.totalFlexGrowFactors;
+  const float totalFlexShrinkScaledFactors =
+      flexLine.layout.totalFlexShrinkScaledFactors;
+
+  if (yoga::isDefined(remainingFreeSpace) && remainingFreeSpace < 0) {
+    const bool hasFlexShrinkScaledFactors =
+        !(yoga::isDefined(totalFlexShrinkScaledFactors) &&
+          totalFlexShrinkScaledFactors == 0);
+    for (size_t i = 0; i < items.size(); i++) {
+      const float childFlexBasis = items.flexBasis[i];
+      const float flexShrinkScaledFactor =
+          -items.flexShrink[i] * childFlexBasis;
+      const float childSize = hasFlexShrinkScaledFactors
+          ? childFlexBasis +
+              (remainingFreeSpace / totalFlexShrinkScaledFactors) *
+                  flexShrinkScaledFactor
+          : childFlexBasis + flexShrinkScaledFactor;
+
+      // Is this child able to shrink?
+      items.mainSize[i] = flexShrinkScaledFactor != 0
+          ? boundItemMainSize(
+                childSize,
+                items.minMainSize[i],
+                items.maxMainSize[i],
+                items.paddingAndBorderMain[i])
+          : childFlexBasis;
+    }
+  } else if (yoga::isDefined(remainingFreeSpace) && remainingFreeSpace > 0) {
+    for (size_t i = 0; i < items.size(); i++) {
+      const float childFlexBasis = items.flexBasis[i];
+      const float flexGrowFactor = items.flexGrow[i];
+      const float childSize = childFlexBasis +
+          remainingFreeSpace / totalFlexGrowFactors * flexGrowFactor;
+
+      // Is this child able to grow?
+      items.mainSize[i] = !std::isnan(flexGrowFactor) && flexGrowFactor != 0
+          ? boundItemMainSize(
+                childSize,
+                items.minMainSize[i],
+                items.maxMainSize[i],
+                items.paddingAndBorderMain[i])
+          : childFlexBasis;
+    }
+  } else {
+    std::copy(
+        items.flexBasis.begin(), items.flexBasis.end(), items.mainSize.begin());
+  }
+}
+
 // It distributes the free space to the flexible items and ensures that the size
 // of the flex items abide the min and max constraints. At the end of this
 // function the child nodes would have proper size. Prior using this function
 // please ensure that distributeFreeSpaceFirstPass is called.
 static float distributeFreeSpaceSecondPass(
     FlexLine& flexLine,
+    FlexLineItemSizes& items,
     yoga::Node* const node,
     const FlexDirection mainAxis,
     const FlexDirection crossAxis,
     const Direction direction,
-    const float mainAxisownerSize,
     const float availableInnerMainDim,
     const float availableInnerCrossDim,
     const float availableInnerWidth,
@@ -582,64 +658,16 @@ static float distributeFreeSpaceSecondPass(
     LayoutData& layoutMarkerData,
     const uint32_t depth,
     const uint32_t generationCount) {
-  float childFlexBasis = 0;
-  float flexShrinkScaledFactor = 0;
-  float flexGrowFactor = 0;
   float deltaFreeSpace = 0;
   const bool isMainAxisRow = isRow(mainAxis);
   const bool isNodeFlexWrap = node->style().flexWrap() != Wrap::NoWrap;
 
-  for (auto currentLineChild : flexLine.itemsInFlow) {
-    childFlexBasis = boundAxisWithinMinAndMax(
-                         currentLineChild,
-                         mainAxis,
-                         currentLineChild->getLayout().computedFlexBasis,
-                         mainAxisownerSize)
-                         .unwrap();
-    float updatedMainSize = childFlexBasis;
-
-    if (yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
-        flexLine.layout.remainingFreeSpace < 0) {
-      flexShrinkScaledFactor =
-          -currentLineChild->resolveFlexShrink() * childFlexBasis;
-      // Is this child able to shrink?
-      if (flexShrinkScaledFactor != 0) {
-        float childSize = YGUndefined;
+  distributeRemainingFreeSpace(flexLine, items);
 
-        if (yoga::isDefined(flexLine.layout.totalFlexShrinkScaledFactors) &&
-            flexLine.layout.totalFlexShrinkScaledFactors == 0) {
-          childSize = childFlexBasis + flexShrinkScaledFactor;
-        } else {
-          childSize = childFlexBasis +
-              (flexLine.layout.remainingFreeSpace /
-               flexLine.layout.totalFlexShrinkScaledFactors) *
-                  flexShrinkScaledFactor;
-        }
-
-        updatedMainSize = boundAxis(
-            currentLineChild,
-            mainAxis,
-            childSize,
-            availableInnerMainDim,
-            availableInnerWidth);
-      }
-    } else if (
-        yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
-        flexLine.layout.remainingFreeSpace > 0) {
-      flexGrowFactor = currentLineChild->resolveFlexGrow();
-
-      // Is this child able to grow?
-      if (!std::isnan(flexGrowFactor) && flexGrowFactor != 0) {
-        updatedMainSize = boundAxis(
-            currentLineChild,
-            mainAxis,
-            childFlexBasis +
-                flexLine.layout.remainingFreeSpace /
-                    flexLine.layout.totalFlexGrowFactors * flexGrowFactor,
-            availableInnerMainDim,
-            availableInnerWidth);
-      }
-    }
+  for (size_t i = 0; i < items.size(); i++) {
+    const auto currentLineChild = flexLine.itemsInFlow[i];
+    const float childFlexBasis = items.flexBasis[i];
+    const float updatedMainSize = items.mainSize[i];
 
     deltaFreeSpace += updatedMainSize - childFlexBasis;
 
@@ -756,41 +784,32 @@ static float distributeFreeSpaceSecondPass(
 // is removed from the remaingfreespace.
 static void distributeFreeSpaceFirstPass(
     FlexLine& flexLine,
-    const FlexDirection mainAxis,
-    const float mainAxisownerSize,
-    const float availableInnerMainDim,
-    const float availableInnerWidth) {
-  float flexShrinkScaledFactor = 0;
-  float flexGrowFactor = 0;
-  float baseMainSize = 0;
-  float boundMainSize = 0;
+    const FlexLineItemSizes& items) {
   float deltaFreeSpace = 0;
-
-  for (auto currentLineChild : flexLine.itemsInFlow) {
-    float childFlexBasis = boundAxisWithinMinAndMax(
-                               currentLineChild,
-                               mainAxis,
-                               currentLineChild->getLayout().computedFlexBasis,
-                               mainAxisownerSize)
-                               .unwrap();
-
-    if (flexLine.layout.remainingFreeSpace < 0) {
-      flexShrinkScaledFactor =
-          -currentLineChild->resolveFlexShrink() * childFlexBasis;
+  const float remainingFreeSpace = flexLine.layout.remainingFreeSpace;
+
+  // Freezing an item changes the share of the items after it, so items are
+  // visited in order. The line totals are kept in locals, as writing them back
+  // on each item would otherwise be a store the loop has to wait on.
+  if (remainingFreeSpace < 0) {
+    float totalFlexShrinkScaledFactors =
+        flexLine.layout.totalFlexShrinkScaledFactors;
+    for (size_t i = 0; i < items.size(); i++) {
+      const float childFlexBasis = items.flexBasis[i];
+      const float flexShrinkScaledFactor =
+          -items.flexShrink[i] * childFlexBasis;
 
       // Is this child able to shrink?
       if (yoga::isDefined(flexShrinkScaledFactor) &&
           flexShrinkScaledFactor != 0) {
-        baseMainSize = childFlexBasis +
-            flexLine.layout.remainingFreeSpace /
-                flexLine.layout.totalFlexShrinkScaledFactors *
+        const float baseMainSize = childFlexBasis +
+            remainingFreeSpace / totalFlexShrinkScaledFactors *
                 flexShrinkScaledFactor;
-        boundMainSize = boundAxis(
-            currentLineChild,
-            mainAxis,
+        const float boundMainSize = boundItemMainSize(
             baseMainSize,
-            availableInnerMainDim,
-            availableInnerWidth);
+            items.minMainSize[i],
+            items.maxMainSize[i],
+            items.paddingAndBorderMain[i]);
         if (yoga::isDefined(baseMainSize) && yoga::isDefined(boundMainSize) &&
             baseMainSize != boundMainSize) {
           // By excluding this item's size and flex factor from remaining, this
@@ -798,27 +817,28 @@ static void distributeFreeSpaceFirstPass(
           // resulting in the item's size calculation being identical in the
           // first and second passes.
           deltaFreeSpace += boundMainSize - childFlexBasis;
-          flexLine.layout.totalFlexShrinkScaledFactors -=
-              (-currentLineChild->resolveFlexShrink() *
-               currentLineChild->getLayout().computedFlexBasis.unwrap());
+          totalFlexShrinkScaledFactors -=
+              (-items.flexShrink[i] * items.unboundedFlexBasis[i]);
         }
       }
-    } else if (
-        yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
-        flexLine.layout.remainingFreeSpace > 0) {
-      flexGrowFactor = currentLineChild->resolveFlexGrow();
+    }
+    flexLine.layout.totalFlexShrinkScaledFactors =
+        totalFlexShrinkScaledFactors;
+  } else if (yoga::isDefined(remainingFreeSpace) && remainingFreeSpace > 0) {
+    float totalFlexGrowFactors = flexLine.layout.totalFlexGrowFactors;
+    for (size_t i = 0; i < items.size(); i++) {
+      const float childFlexBasis = items.flexBasis[i];
+      const float flexGrowFactor = items.flexGrow[i];
 
       // Is this child able to grow?
       if (yoga::isDefined(flexGrowFactor) && flexGrowFactor != 0) {
-        baseMainSize = childFlexBasis +
-            flexLine.layout.remainingFreeSpace /
-                flexLine.layout.totalFlexGrowFactors * flexGrowFactor;
-        boundMainSize = boundAxis(
-            currentLineChild,
-            mainAxis,
+        const float baseMainSize = childFlexBasis +
+            remainingFreeSpace / totalFlexGrowFactors * flexGrowFactor;
+        const float boundMainSize = boundItemMainSize(
             baseMainSize,
-            availableInnerMainDim,
-            availableInnerWidth);
+            items.minMainSize[i],
+            items.maxMainSize[i],
+            items.paddingAndBorderMain[i]);
 
         if (yoga::isDefined(baseMainSize) && yoga::isDefined(boundMainSize) &&
             baseMainSize != boundMainSize) {
@@ -827,10 +847,11 @@ static void distributeFreeSpaceFirstPass(
           // resulting in the item's size calculation being identical in the
           // first and second passes.
           deltaFreeSpace += boundMainSize - childFlexBasis;
-          flexLine.layout.totalFlexGrowFactors -= flexGrowFactor;
+          totalFlexGrowFactors -= flexGrowFactor;
         }
       }
     }
+    flexLine.layout.totalFlexGrowFactors = totalFlexGrowFactors;
   }
   flexLine.layout.remainingFreeSpace -= deltaFreeSpace;
 }
@@ -875,22 +896,24 @@ static void resolveFlexibleLength(
     const uint32_t depth,
     const uint32_t generationCount) {
   const float originalFreeSpace = flexLine.layout.remainingFreeSpace;
-  // First pass: detect the flex items whose min/max constraints trigger
-  distributeFreeSpaceFirstPass(
+  FlexLineItemSizes items{
       flexLine,
       mainAxis,
       mainAxisownerSize,
       availableInnerMainDim,
-      availableInnerWidth);
+      availableInnerWidth};
+
+  // First pass: detect the flex items whose min/max constraints trigger
+  distributeFreeSpaceFirstPass(flexLine, items);
 
   // Second pass: resolve the sizes of the flexible items
   const float distributedFreeSpace = distributeFreeSpaceSecondPass(
       flexLine,
+      items,
       node,
       mainAxis,
       crossAxis,
       direction,
-      mainAxisownerSize,
       availableInnerMainDim,
       availableInnerCrossDim,
       availableInnerWidth,
@@ -1305,6 +1328,23 @@ static void calculateLayoutImpl(
   // Reset layout flags, as they could have changed.
   node->setLayoutHadOverflow(false);
 
+  if (node->style().display() == Display::Grid) {
+    calculateGridLayout(
+        node,
+        availableWidth - marginAxisRow,
+        availableHeight - marginAxisColumn,
+        direction,
+        widthSizingMode,
+        heightSizingMode,
+        ownerWidth,
+        ownerHeight,
+        performLayout,
+        layoutMarkerData,
+        depth,
+        generationCount);
+    return;
+  }
+
   // STEP 1: CALCULATE VALUES FOR REMAINDER OF ALGORITHM
   const FlexDirection mainAxis =
       resolveDirection(node->style().flexDirection(), direction);
@@ -2213,6 +2253,10 @@ bool calculateLayoutInternal(
         reason);
 
     layout->lastOwnerDirection = ownerDirection;
+    if (performLayout) {
+      // Children are laid out along with their owner
+      node->setHasNewLayoutInDescendants(!node->getChildren().empty());
+    }
 
     if (cachedResults == nullptr) {
       layoutMarkerData.maxMeasureCache = std::max(
@@ -2269,7 +2313,7 @@ bool calculateLayoutInternal(
     layoutType = cachedResults != nullptr ? LayoutType::kCachedMeasure
                                           : LayoutType::kMeasure;
   }
-  Event::publish<Event::NodeLayout>(node, {layoutType});
+  Event::publish<Event::NodeLayout>(node, {layoutType, reason});
 
   return (needToVisitNode || cachedResults == nullptr);
 }
@@ -35,4 +35,13 @@ bool calculateLayoutInternal(
     uint32_t depth,
     uint32_t generationCount);
 
+void zeroOutLayoutRecursively(yoga::Node* node);
+
+float calculateAvailableInnerDimension(
+    const yoga::Node* node,
+    Dimension dimension,
+    float availableDim,
+    float paddingAndBorder,
+    float ownerDim);
+
 } // namespace facebook::yoga
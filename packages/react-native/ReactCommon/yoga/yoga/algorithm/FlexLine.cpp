@@ -120,4 +120,53 @@ FlexLine calculateFlexLine(
       }};
 }
 
+FlexLineItemSizes::FlexLineItemSizes(
+    const FlexLine& flexLine,
+    const FlexDirection mainAxis,
+    const float mainAxisownerSize,
+    const float availableInnerMainDim,
+    const float availableInnerWidth) {
+  // Every array is a slice of a single allocation
+  constexpr size_t kArrayCount = 8;
+  const size_t itemCount = flexLine.itemsInFlow.size();
+  values_.resize(itemCount * kArrayCount);
+  auto nextArray = [&, offset = size_t{0}]() mutable {
+    auto array = std::span<float>{values_}.subspan(offset, itemCount);
+    offset += itemCount;
+    return array;
+  };
+  flexBasis = nextArray();
+  unboundedFlexBasis = nextArray();
+  flexGrow = nextArray();
+  flexShrink = nextArray();
+  minMainSize = nextArray();
+  maxMainSize = nextArray();
+  paddingAndBorderMain = nextArray();
+  mainSize = nextArray();
+
+  const Dimension mainDimension = dimension(mainAxis);
+  for (size_t i = 0; i < itemCount; i++) {
+    const auto child = flexLine.itemsInFlow[i];
+    const auto& childStyle = child->style();
+    const FloatOptional computedFlexBasis =
+        child->getLayout().computedFlexBasis;
+
+    flexBasis[i] = boundAxisWithinMinAndMax(
+                       child, mainAxis, computedFlexBasis, mainAxisownerSize)
+                       .unwrap();
+    unboundedFlexBasis[i] = computedFlexBasis.unwrap();
+    flexGrow[i] = child->resolveFlexGrow();
+    flexShrink[i] = child->resolveFlexShrink();
+    minMainSize[i] = childStyle.minDimension(mainDimension)
+                         .resolve(availableInnerMainDim)
+                         .unwrap();
+    maxMainSize[i] = childStyle.maxDimension(mainDimension)
+                         .resolve(availableInnerMainDim)
+                         .unwrap();
+    paddingAndBorderMain[i] =
+        paddingAndBorderForAxis(child, mainAxis, availableInnerWidth);
+    mainSize[i] = flexBasis[i];
+  }
+}
+
 } // namespace facebook::yoga
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <yoga/Yoga.h>
@@ -59,6 +60,49 @@ struct FlexLine {
   FlexLineRunningLayout layout{};
 };
 
+// The inputs and outputs of resolving the flexible lengths of the items of a
+// line along the main axis, gathered once per line into contiguous arrays
+// indexed like `FlexLine::itemsInFlow`. Distributing free space then runs over
+// plain floats instead of resolving the style of every item in each pass.
+struct FlexLineItemSizes {
+  FlexLineItemSizes(
+      const FlexLine& flexLine,
+      FlexDirection mainAxis,
+      float mainAxisownerSize,
+      float availableInnerMainDim,
+      float availableInnerWidth);
+
+  FlexLineItemSizes(const FlexLineItemSizes&) = delete;
+  FlexLineItemSizes& operator=(const FlexLineItemSizes&) = delete;
+
+  size_t size() const {
+    return flexBasis.size();
+  }
+
+  // Computed flex basis, within the min and max main size of the item
+  std::span<float> flexBasis;
+
+  // Computed flex basis, ignoring the min and max main size of the item
+  std::span<float> unboundedFlexBasis;
+
+  std::span<float> flexGrow;
+  std::span<float> flexShrink;
+
+  // Min and max main size, resolved against the available main size of the
+  // line. Undefined when not set.
+  std::span<float> minMainSize;
+  std::span<float> maxMainSize;
+
+  // A main size may never go below padding and border along the main axis
+  std::span<float> paddingAndBorderMain;
+
+  // Resolved main size of each item, without margins
+  std::span<float> mainSize;
+
+ private:
+  std::vector<float> values_;
+};
+
 // Calculates where a line starting at a given index should break, returning
 // information about the collective children on the liune.
 //
@@ -0,0 +1,682 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+#include <yoga/algorithm/AbsoluteLayout.h>
+#include <yoga/algorithm/Align.h>
+#include <yoga/algorithm/BoundAxis.h>
+#include <yoga/algorithm/CalculateLayout.h>
+#include <yoga/algorithm/GridLayout.h>
+#include <yoga/numeric/Comparison.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+struct GridItem {
+  yoga::Node* node;
+  size_t column;
+  size_t columnSpan;
+  size_t row;
+  size_t rowSpan;
+};
+
+enum class TrackKind : uint8_t {
+  Fixed,
+  Auto,
+  Flexible,
+};
+
+// Grid cells taken by the items placed so far. Rows are added as items are
+// placed below the existing ones.
+class GridOccupancy {
+ public:
+  explicit GridOccupancy(size_t columnCount) : columnCount_(columnCount) {}
+
+  size_t rowCount() const {
+    return cells_.size() / columnCount_;
+  }
+
+  bool isFree(size_t row, size_t column, size_t rowSpan, size_t columnSpan)
+      const {
+    if (column + columnSpan > columnCount_) {
+      return false;
+    }
+    const auto endRow = std::min(row + rowSpan, rowCount());
+    for (size_t r = row; r < endRow; r++) {
+      for (size_t c = column; c < column + columnSpan; c++) {
+        if (cells_[r * columnCount_ + c]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void occupy(size_t row, size_t column, size_t rowSpan, size_t columnSpan) {
+    if (row + rowSpan > rowCount()) {
+      cells_.resize((row + rowSpan) * columnCount_, false);
+    }
+    const auto endColumn = std::min(column + columnSpan, columnCount_);
+    for (size_t r = row; r < row + rowSpan; r++) {
+      for (size_t c = column; c < endColumn; c++) {
+        cells_[r * columnCount_ + c] = true;
+      }
+    }
+  }
+
+ private:
+  size_t columnCount_;
+  std::vector<bool> cells_;
+};
+
+// 0-based index of a grid line. Line -1 is the last line of the explicit
+// grid, i.e. its 1-based index is the number of explicit tracks + 1. Lines
+// before the first one are clamped.
+size_t resolveLine(int16_t line, size_t explicitTrackCount) {
+  if (line > 0) {
+    return static_cast<size_t>(line) - 1;
+  }
+  const auto index = static_cast<int32_t>(explicitTrackCount) + 1 + line;
+  return static_cast<size_t>(std::max(index, 0));
+}
+
+// First track and number of tracks of an item along one axis. The track is
+// only meaningful if the placement is not auto.
+std::pair<size_t, size_t> resolveTracks(
+    GridPlacement placement,
+    size_t explicitTrackCount) {
+  const size_t span = std::max<size_t>(placement.span, 1);
+  if (placement.end == 0) {
+    return {
+        placement.start == 0 ? 0
+                             : resolveLine(placement.start, explicitTrackCount),
+        span};
+  }
+  const auto endLine = resolveLine(placement.end, explicitTrackCount);
+  if (placement.start == 0) {
+    const auto startLine = endLine > span ? endLine - span : 0;
+    return {startLine, std::max<size_t>(endLine - startLine, 1)};
+  }
+  // As in CSS, lines given in reverse order are swapped, and an item
+  // starting and ending on the same line spans a single track.
+  auto startLine = resolveLine(placement.start, explicitTrackCount);
+  auto lastLine = endLine;
+  if (lastLine < startLine) {
+    std::swap(startLine, lastLine);
+  }
+  return {startLine, std::max<size_t>(lastLine - startLine, 1)};
+}
+
+/*
+ * Places the in-flow children of a grid container, following
+ * https://www.w3.org/TR/css-grid-1/#auto-placement-algo with a "sparse"
+ * row-major flow:
+ * 1. Items with a definite row and column are placed first.
+ * 2. Then items with only a definite row, in the first column they fit.
+ * 3. Then the remaining items, after the previously auto-placed item.
+ * Implicit columns are added for items starting or spanning past the
+ * explicit grid, and implicit rows for items which don't fit in it.
+ */
+std::vector<GridItem> placeGridItems(
+    const yoga::Node* node,
+    size_t explicitColumnCount,
+    size_t& columnCount,
+    size_t& rowCount) {
+  const auto explicitRowCount = node->style().gridTemplateRows().size();
+
+  std::vector<GridItem> items;
+  items.reserve(node->getChildCount());
+  columnCount = std::max<size_t>(explicitColumnCount, 1);
+  for (auto child : node->getChildren()) {
+    if (child->style().display() == Display::None ||
+        child->style().positionType() == PositionType::Absolute) {
+      continue;
+    }
+    const auto column = child->style().gridColumn();
+    const auto row = child->style().gridRow();
+    const auto [columnStart, columnSpan] =
+        resolveTracks(column, explicitColumnCount);
+    const auto [rowStart, rowSpan] = resolveTracks(row, explicitRowCount);
+    GridItem item{child, columnStart, columnSpan, rowStart, rowSpan};
+    columnCount = std::max(columnCount, item.column + item.columnSpan);
+    items.push_back(item);
+  }
+
+  GridOccupancy occupancy{columnCount};
+
+  for (auto& item : items) {
+    const auto& style = item.node->style();
+    if (!style.gridRow().isAuto() && !style.gridColumn().isAuto()) {
+      occupancy.occupy(item.row, item.column, item.rowSpan, item.columnSpan);
+    }
+  }
+
+  for (auto& item : items) {
+    const auto& style = item.node->style();
+    if (!style.gridRow().isAuto() && style.gridColumn().isAuto()) {
+      // An item which doesn't fit anywhere in its row overlaps the first
+      // column, as we don't add implicit columns for it.
+      item.column = 0;
+      for (size_t column = 0; column + item.columnSpan <= columnCount;
+           column++) {
+        if (occupancy.isFree(
+                item.row, column, item.rowSpan, item.columnSpan)) {
+          item.column = column;
+          break;
+        }
+      }
+      occupancy.occupy(item.row, item.column, item.rowSpan, item.columnSpan);
+    }
+  }
+
+  size_t cursorRow = 0;
+  size_t cursorColumn = 0;
+  for (auto& item : items) {
+    const auto& style = item.node->style();
+    if (!style.gridRow().isAuto()) {
+      continue;
+    }
+    if (!style.gridColumn().isAuto()) {
+      if (item.column < cursorColumn) {
+        cursorRow++;
+      }
+      while (!occupancy.isFree(
+          cursorRow, item.column, item.rowSpan, item.columnSpan)) {
+        cursorRow++;
+      }
+      cursorColumn = item.column;
+    } else {
+      while (!occupancy.isFree(
+          cursorRow, cursorColumn, item.rowSpan, item.columnSpan)) {
+        if (cursorColumn + item.columnSpan >= columnCount) {
+          cursorRow++;
+          cursorColumn = 0;
+        } else {
+          cursorColumn++;
+        }
+      }
+      item.column = cursorColumn;
+    }
+    item.row = cursorRow;
+    occupancy.occupy(item.row, item.column, item.rowSpan, item.columnSpan);
+    cursorColumn += item.columnSpan;
+  }
+
+  rowCount = std::max(occupancy.rowCount(), explicitRowCount);
+  return items;
+}
+
+/*
+ * Sizes the tracks of one axis of the grid, following a subset of
+ * https://www.w3.org/TR/css-grid-1/#algo-track-sizing:
+ * 1. Lengths, and percentages of a definite container size, are used as is.
+ * 2. `auto` tracks grow to fit the items in them, starting with the items
+ *    spanning a single track. Items spanning a flexible track don't
+ *    contribute to `auto` tracks.
+ * 3. Flexible tracks share the space left in the container when it is
+ *    stretched. Otherwise they are sized to fit their items, keeping the
+ *    ratio between their flex factors, without overflowing a fit-content
+ *    container.
+ *
+ * `contribution` returns the outer size of an item along the axis. It is only
+ * called for items which span an `auto` or flexible track.
+ */
+template <typename ItemStart, typename ItemSpan, typename Contribution>
+std::vector<float> sizeGridTracks(
+    const GridTrackList& explicitTracks,
+    size_t trackCount,
+    float availableInnerSize,
+    SizingMode sizingMode,
+    float gap,
+    const std::vector<GridItem>& items,
+    ItemStart itemStart,
+    ItemSpan itemSpan,
+    Contribution contribution) {
+  const bool fillAvailableSize = sizingMode == SizingMode::StretchFit &&
+      yoga::isDefined(availableInnerSize);
+
+  std::vector<float> sizes(trackCount, 0.0f);
+  std::vector<TrackKind> kinds(trackCount, TrackKind::Auto);
+  std::vector<float> flexFactors(trackCount, 0.0f);
+
+  for (size_t i = 0; i < trackCount; i++) {
+    const auto track =
+        i < explicitTracks.size() ? explicitTracks[i] : GridTrackSize{};
+    const auto fixedSize = track.resolve(availableInnerSize);
+    if (fixedSize.isDefined()) {
+      kinds[i] = TrackKind::Fixed;
+      sizes[i] = std::max(fixedSize.unwrap(), 0.0f);
+    } else if (track.isFraction()) {
+      kinds[i] = TrackKind::Flexible;
+      flexFactors[i] = std::max(track.value(), 0.0f);
+    }
+  }
+
+  const auto spannedSize = [&](size_t start, size_t span) {
+    float size = gap * static_cast<float>(span - 1);
+    for (size_t i = start; i < start + span; i++) {
+      size += kinds[i] == TrackKind::Flexible ? 0.0f : sizes[i];
+    }
+    return size;
+  };
+
+  std::vector<const GridItem*> itemsBySpan;
+  itemsBySpan.reserve(items.size());
+  for (const auto& item : items) {
+    itemsBySpan.push_back(&item);
+  }
+  std::stable_sort(
+      itemsBySpan.begin(),
+      itemsBySpan.end(),
+      [&](const GridItem* lhs, const GridItem* rhs) {
+        return itemSpan(*lhs) < itemSpan(*rhs);
+      });
+
+  // Items spanning flexible tracks, with their contribution, so that they are
+  // only measured once.
+  std::vector<std::pair<const GridItem*, float>> flexibleItems;
+  for (const auto item : itemsBySpan) {
+    const auto start = itemStart(*item);
+    const auto span = itemSpan(*item);
+    size_t autoTrackCount = 0;
+    bool spansFlexibleTrack = false;
+    for (size_t i = start; i < start + span; i++) {
+      autoTrackCount += kinds[i] == TrackKind::Auto ? 1 : 0;
+      spansFlexibleTrack =
+          spansFlexibleTrack || kinds[i] == TrackKind::Flexible;
+    }
+
+    if (spansFlexibleTrack) {
+      if (!fillAvailableSize) {
+        flexibleItems.emplace_back(item, contribution(*item));
+      }
+      continue;
+    }
+    if (autoTrackCount == 0) {
+      continue;
+    }
+
+    const auto extraSize = contribution(*item) - spannedSize(start, span);
+    if (extraSize > 0.0f) {
+      for (size_t i = start; i < start + span; i++) {
+        if (kinds[i] == TrackKind::Auto) {
+          sizes[i] += extraSize / static_cast<float>(autoTrackCount);
+        }
+      }
+    }
+  }
+
+  float flexFactorSum = 0.0f;
+  float inflexibleSize = trackCount > 0
+      ? gap * static_cast<float>(trackCount - 1)
+      : 0.0f;
+  for (size_t i = 0; i < trackCount; i++) {
+    flexFactorSum += flexFactors[i];
+    inflexibleSize += kinds[i] == TrackKind::Flexible ? 0.0f : sizes[i];
+  }
+  if (flexFactorSum == 0.0f) {
+    return sizes;
+  }
+
+  // Size of a single `fr`. Factors summing to less than one only take that
+  // fraction of the space, as in CSS.
+  const float leftoverFractionSize =
+      std::max(availableInnerSize - inflexibleSize, 0.0f) /
+      std::max(flexFactorSum, 1.0f);
+  float fractionSize = 0.0f;
+  if (fillAvailableSize) {
+    fractionSize = leftoverFractionSize;
+  } else {
+    for (const auto& [item, itemContribution] : flexibleItems) {
+      const auto start = itemStart(*item);
+      const auto span = itemSpan(*item);
+      float spannedFlexFactor = 0.0f;
+      for (size_t i = start; i < start + span; i++) {
+        spannedFlexFactor += flexFactors[i];
+      }
+      fractionSize = std::max(
+          fractionSize,
+          (itemContribution - spannedSize(start, span)) /
+              std::max(spannedFlexFactor, 1.0f));
+    }
+    if (sizingMode == SizingMode::FitContent &&
+        yoga::isDefined(availableInnerSize)) {
+      fractionSize = std::min(fractionSize, leftoverFractionSize);
+    }
+  }
+
+  for (size_t i = 0; i < trackCount; i++) {
+    if (kinds[i] == TrackKind::Flexible) {
+      sizes[i] = fractionSize * flexFactors[i];
+    }
+  }
+  return sizes;
+}
+
+// Offset of each track from the start of the content box, including gaps
+std::vector<float> trackOffsets(const std::vector<float>& sizes, float gap) {
+  std::vector<float> offsets(sizes.size(), 0.0f);
+  float offset = 0.0f;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    offsets[i] = offset;
+    offset += sizes[i] + gap;
+  }
+  return offsets;
+}
+
+float tracksSize(const std::vector<float>& sizes, float gap) {
+  if (sizes.empty()) {
+    return 0.0f;
+  }
+  float size = gap * static_cast<float>(sizes.size() - 1);
+  for (const auto trackSize : sizes) {
+    size += trackSize;
+  }
+  return size;
+}
+
+float areaSize(
+    const std::vector<float>& sizes,
+    size_t start,
+    size_t span,
+    float gap) {
+  float size = gap * static_cast<float>(span - 1);
+  for (size_t i = start; i < start + span; i++) {
+    size += sizes[i];
+  }
+  return size;
+}
+
+} // namespace
+
+void calculateGridLayout(
+    yoga::Node* const node,
+    const float availableWidth,
+    const float availableHeight,
+    const Direction direction,
+    const SizingMode widthSizingMode,
+    const SizingMode heightSizingMode,
+    const float ownerWidth,
+    const float ownerHeight,
+    const bool performLayout,
+    LayoutData& layoutMarkerData,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  const auto& style = node->style();
+
+  const float paddingAndBorderAxisRow =
+      paddingAndBorderForAxis(node, FlexDirection::Row, ownerWidth);
+  const float paddingAndBorderAxisColumn =
+      paddingAndBorderForAxis(node, FlexDirection::Column, ownerWidth);
+
+  const float availableInnerWidth = calculateAvailableInnerDimension(
+      node,
+      Dimension::Width,
+      availableWidth,
+      paddingAndBorderAxisRow,
+      ownerWidth);
+  const float availableInnerHeight = calculateAvailableInnerDimension(
+      node,
+      Dimension::Height,
+      availableHeight,
+      paddingAndBorderAxisColumn,
+      ownerHeight);
+
+  const float columnGap =
+      style.computeGapForAxis(FlexDirection::Row, availableInnerWidth);
+  const float rowGap =
+      style.computeGapForAxis(FlexDirection::Column, availableInnerHeight);
+
+  for (auto child : node->getChildren()) {
+    child->resolveDimension();
+    if (child->style().display() == Display::None) {
+      zeroOutLayoutRecursively(child);
+      child->setHasNewLayout(true);
+      child->setDirty(false);
+    }
+  }
+
+  size_t columnCount = 0;
+  size_t rowCount = 0;
+  const auto items = placeGridItems(
+      node, style.gridTemplateColumns().size(), columnCount, rowCount);
+
+  // Lays out an item within the given outer size. Lengths set on the item
+  // take precedence.
+  const auto layoutItem = [&](yoga::Node* child,
+                              float width,
+                              SizingMode widthMode,
+                              float height,
+                              SizingMode heightMode,
+                              bool performItemLayout,
+                              LayoutPassReason reason) {
+    const float marginRow = child->style().computeMarginForAxis(
+        FlexDirection::Row, availableInnerWidth);
+    const float marginColumn = child->style().computeMarginForAxis(
+        FlexDirection::Column, availableInnerWidth);
+    if (child->hasDefiniteLength(Dimension::Width, availableInnerWidth)) {
+      width = child->getResolvedDimension(Dimension::Width)
+                  .resolve(availableInnerWidth)
+                  .unwrap() +
+          marginRow;
+      widthMode = SizingMode::StretchFit;
+    }
+    if (child->hasDefiniteLength(Dimension::Height, availableInnerHeight)) {
+      height = child->getResolvedDimension(Dimension::Height)
+                   .resolve(availableInnerHeight)
+                   .unwrap() +
+          marginColumn;
+      heightMode = SizingMode::StretchFit;
+    }
+
+    const auto aspectRatio = child->style().aspectRatio();
+    if (aspectRatio.isDefined() && aspectRatio.unwrap() > 0.0f) {
+      if (widthMode == SizingMode::StretchFit &&
+          heightMode != SizingMode::StretchFit) {
+        height = (width - marginRow) / aspectRatio.unwrap() + marginColumn;
+        heightMode = SizingMode::StretchFit;
+      } else if (
+          heightMode == SizingMode::StretchFit &&
+          widthMode != SizingMode::StretchFit) {
+        width = (height - marginColumn) * aspectRatio.unwrap() + marginRow;
+        widthMode = SizingMode::StretchFit;
+      }
+    }
+
+    calculateLayoutInternal(
+        child,
+        widthMode == SizingMode::MaxContent ? YGUndefined : width,
+        heightMode == SizingMode::MaxContent ? YGUndefined : height,
+        direction,
+        widthMode,
+        heightMode,
+        availableInnerWidth,
+        availableInnerHeight,
+        performItemLayout,
+        reason,
+        layoutMarkerData,
+        depth,
+        generationCount);
+  };
+
+  // STEP 1: SIZE COLUMNS, FROM THE MAX-CONTENT WIDTH OF THEIR ITEMS
+  const auto columnSizes = sizeGridTracks(
+      style.gridTemplateColumns(),
+      columnCount,
+      widthSizingMode == SizingMode::MaxContent ? YGUndefined
+                                                : availableInnerWidth,
+      widthSizingMode,
+      columnGap,
+      items,
+      [](const GridItem& item) { return item.column; },
+      [](const GridItem& item) { return item.columnSpan; },
+      [&](const GridItem& item) {
+        layoutItem(
+            item.node,
+            YGUndefined,
+            SizingMode::MaxContent,
+            YGUndefined,
+            SizingMode::MaxContent,
+            false,
+            LayoutPassReason::kGridMeasure);
+        return item.node->getLayout().measuredDimension(Dimension::Width) +
+            item.node->style().computeMarginForAxis(
+                FlexDirection::Row, availableInnerWidth);
+      });
+
+  // STEP 2: SIZE ROWS, FROM THE HEIGHT OF THEIR ITEMS IN THEIR COLUMNS
+  const auto rowSizes = sizeGridTracks(
+      style.gridTemplateRows(),
+      rowCount,
+      heightSizingMode == SizingMode::MaxContent ? YGUndefined
+                                                 : availableInnerHeight,
+      heightSizingMode,
+      rowGap,
+      items,
+      [](const GridItem& item) { return item.row; },
+      [](const GridItem& item) { return item.rowSpan; },
+      [&](const GridItem& item) {
+        layoutItem(
+            item.node,
+            areaSize(columnSizes, item.column, item.columnSpan, columnGap),
+            SizingMode::StretchFit,
+            YGUndefined,
+            SizingMode::MaxContent,
+            false,
+            LayoutPassReason::kGridMeasure);
+        return item.node->getLayout().measuredDimension(Dimension::Height) +
+            item.node->style().computeMarginForAxis(
+                FlexDirection::Column, availableInnerWidth);
+      });
+
+  // STEP 3: COMPUTE FINAL DIMENSIONS
+  const float contentWidth = tracksSize(columnSizes, columnGap);
+  const float contentHeight = tracksSize(rowSizes, rowGap);
+
+  node->setLayoutMeasuredDimension(
+      boundAxis(
+          node,
+          FlexDirection::Row,
+          widthSizingMode == SizingMode::StretchFit
+              ? availableWidth
+              : contentWidth + paddingAndBorderAxisRow,
+          ownerWidth,
+          ownerWidth),
+      Dimension::Width);
+  node->setLayoutMeasuredDimension(
+      boundAxis(
+          node,
+          FlexDirection::Column,
+          heightSizingMode == SizingMode::StretchFit
+              ? availableHeight
+              : contentHeight + paddingAndBorderAxisColumn,
+          ownerHeight,
+          ownerWidth),
+      Dimension::Height);
+
+  const float innerWidth =
+      node->getLayout().measuredDimension(Dimension::Width) -
+      paddingAndBorderAxisRow;
+  const float innerHeight =
+      node->getLayout().measuredDimension(Dimension::Height) -
+      paddingAndBorderAxisColumn;
+  node->setLayoutHadOverflow(
+      contentWidth > innerWidth || contentHeight > innerHeight);
+
+  if (!performLayout) {
+    return;
+  }
+
+  // STEP 4: LAY OUT AND POSITION ITEMS IN THEIR GRID AREAS
+  const auto columnOffsets = trackOffsets(columnSizes, columnGap);
+  const auto rowOffsets = trackOffsets(rowSizes, rowGap);
+  const float leadingPaddingAndBorderLeft =
+      node->getLayout().border(PhysicalEdge::Left) +
+      node->getLayout().padding(PhysicalEdge::Left);
+  const float leadingPaddingAndBorderTop =
+      node->getLayout().border(PhysicalEdge::Top) +
+      node->getLayout().padding(PhysicalEdge::Top);
+
+  for (const auto& item : items) {
+    const auto child = item.node;
+    const float areaWidth =
+        areaSize(columnSizes, item.column, item.columnSpan, columnGap);
+    const float areaHeight =
+        areaSize(rowSizes, item.row, item.rowSpan, rowGap);
+
+    // Items stretch along the row axis, and are aligned along the column axis
+    // by `alignSelf`/`alignItems`.
+    const auto alignment = resolveChildAlignment(node, child);
+    const bool stretchHeight = alignment == Align::Stretch;
+    layoutItem(
+        child,
+        areaWidth,
+        SizingMode::StretchFit,
+        stretchHeight ? areaHeight : YGUndefined,
+        stretchHeight ? SizingMode::StretchFit : SizingMode::MaxContent,
+        true,
+        LayoutPassReason::kGridLayout);
+
+    const auto& childLayout = child->getLayout();
+    const float outerWidth = childLayout.measuredDimension(Dimension::Width) +
+        childLayout.margin(PhysicalEdge::Left) +
+        childLayout.margin(PhysicalEdge::Right);
+    const float outerHeight =
+        childLayout.measuredDimension(Dimension::Height) +
+        childLayout.margin(PhysicalEdge::Top) +
+        childLayout.margin(PhysicalEdge::Bottom);
+
+    float alignmentOffset = 0.0f;
+    if (alignment == Align::Center) {
+      alignmentOffset = (areaHeight - outerHeight) / 2;
+    } else if (alignment == Align::FlexEnd) {
+      alignmentOffset = areaHeight - outerHeight;
+    }
+
+    const float relativeLeft =
+        child->relativePosition(FlexDirection::Row, direction, innerWidth);
+    const float relativeTop =
+        child->relativePosition(FlexDirection::Column, direction, innerHeight);
+
+    const float left = direction == Direction::RTL
+        ? leadingPaddingAndBorderLeft + innerWidth -
+            columnOffsets[item.column] - outerWidth - relativeLeft
+        : leadingPaddingAndBorderLeft + columnOffsets[item.column] +
+            relativeLeft;
+    child->setLayoutPosition(
+        left + childLayout.margin(PhysicalEdge::Left), PhysicalEdge::Left);
+    child->setLayoutPosition(
+        leadingPaddingAndBorderTop + rowOffsets[item.row] + alignmentOffset +
+            relativeTop + childLayout.margin(PhysicalEdge::Top),
+        PhysicalEdge::Top);
+  }
+
+  // STEP 5: SIZING AND POSITIONING ABSOLUTE CHILDREN
+  if (style.positionType() != PositionType::Static ||
+      node->alwaysFormsContainingBlock() || depth == 1) {
+    layoutAbsoluteDescendants(
+        node,
+        node,
+        widthSizingMode,
+        direction,
+        layoutMarkerData,
+        depth,
+        generationCount,
+        0.0f,
+        0.0f,
+        availableInnerWidth,
+        availableInnerHeight);
+  }
+}
+
+} // namespace facebook::yoga
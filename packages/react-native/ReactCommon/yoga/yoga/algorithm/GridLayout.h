@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <yoga/algorithm/SizingMode.h>
+#include <yoga/event/event.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+/**
+ * Lays out the children of a `display: grid` container, and sets its measured
+ * dimensions. Items are placed into the explicit tracks of the container, or
+ * automatically (row by row) when they don't have a start line, and implicit
+ * rows are added as needed. `auto` tracks are sized to the items they
+ * contain, and `fr` tracks share the space left in the container.
+ *
+ * `availableWidth` and `availableHeight` exclude the margins of the container.
+ */
+void calculateGridLayout(
+    yoga::Node* node,
+    float availableWidth,
+    float availableHeight,
+    Direction direction,
+    SizingMode widthSizingMode,
+    SizingMode heightSizingMode,
+    float ownerWidth,
+    float ownerHeight,
+    bool performLayout,
+    LayoutData& layoutMarkerData,
+    uint32_t depth,
+    uint32_t generationCount);
+
+} // namespace facebook::yoga
@@ -8,6 +8,7 @@
 #include <yoga/config/Config.h>
 #include <yoga/debug/Log.h>
 #include <yoga/node/Node.h>
+#include <yoga/node/NodeArena.h>
 
 namespace facebook::yoga {
 
@@ -20,6 +21,10 @@ bool configUpdateInvalidatesLayout(
       oldConfig.useWebDefaults() != newConfig.useWebDefaults();
 }
 
+Config::Config(YGLogger logger) : logger_{logger} {}
+
+Config::~Config() = default;
+
 void Config::setUseWebDefaults(bool useWebDefaults) {
   useWebDefaults_ = useWebDefaults;
 }
@@ -108,6 +113,21 @@ YGNodeRef Config::cloneNode(
   return clone;
 }
 
+void Config::setNodeArenaEnabled(bool enabled) {
+  isNodeArenaEnabled_ = enabled;
+  if (enabled && nodeArena_ == nullptr) {
+    nodeArena_ = std::make_unique<NodeArena>();
+  }
+}
+
+bool Config::isNodeArenaEnabled() const {
+  return isNodeArenaEnabled_;
+}
+
+NodeArena* Config::getNodeArena() const {
+  return nodeArena_.get();
+}
+
 /*static*/ const Config& Config::getDefault() {
   static Config config{getDefaultLogger()};
   return config;
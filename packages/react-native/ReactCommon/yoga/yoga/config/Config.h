@@ -8,6 +8,7 @@
 #pragma once
 
 #include <bitset>
+#include <memory>
 
 #include <yoga/Yoga.h>
 #include <yoga/enums/Errata.h>
@@ -21,6 +22,7 @@ namespace facebook::yoga {
 
 class Config;
 class Node;
+class NodeArena;
 
 using ExperimentalFeatureSet = std::bitset<ordinalCount<ExperimentalFeature>()>;
 
@@ -32,7 +34,8 @@ bool configUpdateInvalidatesLayout(
 
 class YG_EXPORT Config : public ::YGConfig {
  public:
-  explicit Config(YGLogger logger) : logger_{logger} {}
+  explicit Config(YGLogger logger);
+  ~Config();
 
   void setUseWebDefaults(bool useWebDefaults);
   bool useWebDefaults() const;
@@ -64,6 +67,11 @@ class YG_EXPORT Config : public ::YGConfig {
   YGNodeRef
   cloneNode(YGNodeConstRef node, YGNodeConstRef owner, size_t childIndex) const;
 
+  // Nodes created with the config are allocated from its arena when enabled
+  void setNodeArenaEnabled(bool enabled);
+  bool isNodeArenaEnabled() const;
+  NodeArena* getNodeArena() const;
+
   static const Config& getDefault();
 
  private:
@@ -76,6 +84,8 @@ class YG_EXPORT Config : public ::YGConfig {
   Errata errata_ = Errata::None;
   float pointScaleFactor_ = 1.0f;
   void* context_ = nullptr;
+  bool isNodeArenaEnabled_ = false;
+  std::unique_ptr<NodeArena> nodeArena_;
 };
 
 inline Config* resolveRef(const YGConfigRef ref) {
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <mutex>
+
+#include <yoga/debug/LayoutProfiler.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+thread_local LayoutProfiler* activeProfiler = nullptr;
+
+} // namespace
+
+NodeLayoutProfile& NodeLayoutProfile::operator+=(
+    const NodeLayoutProfile& other) {
+  layouts += other.layouts;
+  measures += other.measures;
+  cachedLayouts += other.cachedLayouts;
+  cachedMeasures += other.cachedMeasures;
+  for (size_t i = 0; i < cacheMissesByReason.size(); i++) {
+    cacheMissesByReason[i] += other.cacheMissesByReason[i];
+  }
+  measureCallbacks += other.measureCallbacks;
+  measureCallbackDuration += other.measureCallbackDuration;
+  return *this;
+}
+
+LayoutProfiler::Scope::Scope(LayoutProfiler& profiler)
+    : previousProfiler_(activeProfiler) {
+  // Events are only subscribed to once something is profiled. Subscribers
+  // can't be removed, so the subscriber stays in place and ignores events
+  // published without an active profiler.
+  static std::once_flag subscribed;
+  std::call_once(
+      subscribed, [] { Event::subscribe(&LayoutProfiler::handleEvent); });
+  activeProfiler = &profiler;
+}
+
+LayoutProfiler::Scope::~Scope() {
+  activeProfiler = previousProfiler_;
+}
+
+void LayoutProfiler::handleEvent(
+    YGNodeConstRef node,
+    Event::Type eventType,
+    Event::Data eventData) {
+  auto profiler = activeProfiler;
+  if (profiler == nullptr) {
+    return;
+  }
+
+  switch (eventType) {
+    case Event::NodeLayout: {
+      const auto& data = eventData.get<Event::NodeLayout>();
+      auto& profile = profiler->nodeProfiles_[resolveRef(node)];
+      switch (data.layoutType) {
+        case LayoutType::kLayout:
+          profile.layouts++;
+          break;
+        case LayoutType::kMeasure:
+          profile.measures++;
+          break;
+        case LayoutType::kCachedLayout:
+          profile.cachedLayouts++;
+          return;
+        case LayoutType::kCachedMeasure:
+          profile.cachedMeasures++;
+          return;
+      }
+      profile.cacheMissesByReason[static_cast<size_t>(data.reason)]++;
+      break;
+    }
+    case Event::MeasureCallbackStart:
+      profiler->measureCallbackStarts_.push_back(
+          std::chrono::steady_clock::now());
+      break;
+    case Event::MeasureCallbackEnd: {
+      if (profiler->measureCallbackStarts_.empty()) {
+        break;
+      }
+      auto& profile = profiler->nodeProfiles_[resolveRef(node)];
+      profile.measureCallbacks++;
+      profile.measureCallbackDuration += std::chrono::steady_clock::now() -
+          profiler->measureCallbackStarts_.back();
+      profiler->measureCallbackStarts_.pop_back();
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <yoga/event/event.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+/**
+ * What laying out a single node cost over one or more layout passes.
+ */
+struct NodeLayoutProfile {
+  // Visits which computed a layout or a measurement
+  uint32_t layouts{0};
+  uint32_t measures{0};
+  // Visits answered from the layout cache of the node
+  uint32_t cachedLayouts{0};
+  uint32_t cachedMeasures{0};
+  // Visits which computed a layout or a measurement, by why the owner of the
+  // node requested it
+  std::array<uint32_t, static_cast<size_t>(LayoutPassReason::COUNT)>
+      cacheMissesByReason{};
+  uint32_t measureCallbacks{0};
+  std::chrono::nanoseconds measureCallbackDuration{0};
+
+  uint32_t visits() const {
+    return layouts + measures + cachedLayouts + cachedMeasures;
+  }
+
+  NodeLayoutProfile& operator+=(const NodeLayoutProfile& other);
+};
+
+/**
+ * Collects a `NodeLayoutProfile` for every node laid out while the profiler
+ * is active on the thread doing the layout, from the events published by
+ * Yoga. Layout passes run without an active profiler only pay for checking
+ * that there is none.
+ */
+class YG_EXPORT LayoutProfiler {
+ public:
+  /**
+   * Makes `profiler` active on the current thread for the lifetime of the
+   * scope.
+   */
+  class Scope {
+   public:
+    explicit Scope(LayoutProfiler& profiler);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    LayoutProfiler* previousProfiler_;
+  };
+
+  const std::unordered_map<const yoga::Node*, NodeLayoutProfile>&
+  getNodeProfiles() const {
+    return nodeProfiles_;
+  }
+
+  void clear() {
+    nodeProfiles_.clear();
+  }
+
+ private:
+  static void handleEvent(
+      YGNodeConstRef node,
+      Event::Type eventType,
+      Event::Data eventData);
+
+  std::unordered_map<const yoga::Node*, NodeLayoutProfile> nodeProfiles_;
+  // Start of the measure callbacks in progress, as a measure function may
+  // lay out another tree
+  std::vector<std::chrono::steady_clock::time_point> measureCallbackStarts_;
+};
+
+} // namespace facebook::yoga
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <yoga/algorithm/CalculateLayout.h>
+#include <yoga/debug/LayoutReplay.h>
+#include <yoga/debug/Log.h>
+#include <yoga/numeric/Comparison.h>
+
+namespace facebook::yoga {
+
+LayoutReplay::LayoutReplay(LayoutSnapshot snapshot)
+    : snapshot_(std::move(snapshot)),
+      config_(std::make_unique<Config>(getDefaultLogger())) {
+  config_->setPointScaleFactor(snapshot_.pointScaleFactor);
+  config_->setErrata(snapshot_.errata);
+  config_->setUseWebDefaults(snapshot_.useWebDefaults);
+  for (auto feature : ordinals<ExperimentalFeature>()) {
+    config_->setExperimentalFeatureEnabled(
+        feature, snapshot_.experimentalFeatures.test(to_underlying(feature)));
+  }
+
+  const auto nodeCount = snapshot_.nodes.size();
+  nodes_.reserve(nodeCount);
+  contexts_.reserve(nodeCount);
+  for (uint32_t i = 0; i < nodeCount; i++) {
+    const auto& record = snapshot_.nodes[i];
+    auto node = std::make_unique<yoga::Node>(config_.get());
+    node->setStyle(record.style);
+    node->setAlwaysFormsContainingBlock(record.alwaysFormsContainingBlock);
+    node->setIsReferenceBaseline(record.isReferenceBaseline);
+    if (record.hasMeasureFunc) {
+      node->setMeasureFunc(&LayoutReplay::measure);
+    }
+    if (record.hasBaselineFunc) {
+      node->setBaselineFunc(&LayoutReplay::baseline);
+    }
+    node->setNodeType(record.nodeType);
+    node->setContext(&contexts_.emplace_back(NodeContext{this, i}));
+    nodes_.push_back(std::move(node));
+  }
+
+  for (uint32_t i = 0; i < nodeCount; i++) {
+    auto node = nodes_[i].get();
+    for (auto childIndex : snapshot_.nodes[i].children) {
+      auto child = nodes_[childIndex].get();
+      node->insertChild(child, node->getChildCount());
+      child->setOwner(node);
+    }
+  }
+}
+
+LayoutReplay::~LayoutReplay() = default;
+
+void LayoutReplay::run() {
+  for (auto& node : nodes_) {
+    node->setDirty(true);
+  }
+  calculateLayout(
+      getRoot(),
+      snapshot_.ownerWidth,
+      snapshot_.ownerHeight,
+      snapshot_.ownerDirection);
+}
+
+std::vector<uint32_t> LayoutReplay::mismatchedNodes() const {
+  std::vector<uint32_t> mismatches;
+  for (uint32_t i = 0; i < nodes_.size(); i++) {
+    const auto& layout = nodes_[i]->getLayout();
+    const auto& frame = snapshot_.nodes[i].frame;
+    if (!yoga::inexactEquals(layout.position(PhysicalEdge::Left), frame.left) ||
+        !yoga::inexactEquals(layout.position(PhysicalEdge::Top), frame.top) ||
+        !yoga::inexactEquals(
+            layout.dimension(Dimension::Width), frame.width) ||
+        !yoga::inexactEquals(
+            layout.dimension(Dimension::Height), frame.height)) {
+      mismatches.push_back(i);
+    }
+  }
+  return mismatches;
+}
+
+YGSize LayoutReplay::measure(
+    YGNodeConstRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  const auto context =
+      static_cast<const NodeContext*>(resolveRef(node)->getContext());
+  const auto& measurements =
+      context->replay->snapshot_.nodes[context->index].measurements;
+
+  const LayoutSnapshot::Measurement* closest = nullptr;
+  for (const auto& measurement : measurements) {
+    if (measurement.widthMode != scopedEnum(widthMode) ||
+        measurement.heightMode != scopedEnum(heightMode)) {
+      continue;
+    }
+    if (yoga::inexactEquals(measurement.width, width) &&
+        yoga::inexactEquals(measurement.height, height)) {
+      return {measurement.measuredWidth, measurement.measuredHeight};
+    }
+    closest = closest != nullptr ? closest : &measurement;
+  }
+
+  context->replay->unrecordedCallCount_++;
+  if (closest == nullptr && !measurements.empty()) {
+    closest = &measurements.front();
+  }
+  return closest != nullptr
+      ? YGSize{closest->measuredWidth, closest->measuredHeight}
+      : YGSize{0.0f, 0.0f};
+}
+
+float LayoutReplay::baseline(YGNodeConstRef node, float width, float height) {
+  const auto context =
+      static_cast<const NodeContext*>(resolveRef(node)->getContext());
+  const auto& baselines =
+      context->replay->snapshot_.nodes[context->index].baselines;
+
+  for (const auto& baseline : baselines) {
+    if (yoga::inexactEquals(baseline.width, width) &&
+        yoga::inexactEquals(baseline.height, height)) {
+      return baseline.baseline;
+    }
+  }
+
+  context->replay->unrecordedCallCount_++;
+  return baselines.empty() ? height : baselines.front().baseline;
+}
+
+} // namespace facebook::yoga
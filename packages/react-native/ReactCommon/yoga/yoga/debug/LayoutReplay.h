@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <yoga/config/Config.h>
+#include <yoga/debug/LayoutSnapshot.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+/**
+ * Rebuilds the tree of a `LayoutSnapshot` so that its layout pass can be run
+ * again, e.g. in a benchmark loop. Measure and baseline functions return what
+ * was recorded for the same constraints.
+ */
+class LayoutReplay {
+ public:
+  explicit LayoutReplay(LayoutSnapshot snapshot);
+  LayoutReplay(const LayoutReplay&) = delete;
+  LayoutReplay& operator=(const LayoutReplay&) = delete;
+  ~LayoutReplay();
+
+  // Lays out the whole tree again, without reusing the results of previous
+  // runs
+  void run();
+
+  // Indices of the nodes laid out differently than when they were recorded
+  std::vector<uint32_t> mismatchedNodes() const;
+
+  // Number of measure and baseline calls which were never recorded, and were
+  // answered with an approximation. A non-zero count means that the replay
+  // took a different path than the recorded layout pass.
+  size_t getUnrecordedCallCount() const {
+    return unrecordedCallCount_;
+  }
+
+  const LayoutSnapshot& getSnapshot() const {
+    return snapshot_;
+  }
+
+  yoga::Node* getRoot() const {
+    return nodes_.front().get();
+  }
+
+  yoga::Node* getNode(uint32_t index) const {
+    return nodes_[index].get();
+  }
+
+ private:
+  static YGSize measure(
+      YGNodeConstRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode);
+  static float baseline(YGNodeConstRef node, float width, float height);
+
+  // Context of every node, to find its record from measure and baseline
+  // functions
+  struct NodeContext {
+    LayoutReplay* replay;
+    uint32_t index;
+  };
+
+  LayoutSnapshot snapshot_;
+  std::unique_ptr<Config> config_;
+  std::vector<std::unique_ptr<yoga::Node>> nodes_;
+  std::vector<NodeContext> contexts_;
+  size_t unrecordedCallCount_{0};
+};
+
+} // namespace facebook::yoga
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+
+#include <yoga/algorithm/CalculateLayout.h>
+#include <yoga/debug/LayoutSnapshot.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+struct Recording {
+  LayoutSnapshot snapshot;
+  // Nodes of the recorded tree, in the same order as `snapshot.nodes`
+  std::vector<const yoga::Node*> originals;
+  std::vector<std::unique_ptr<yoga::Node>> copies;
+  std::unordered_map<const yoga::Node*, size_t> indexOfCopy;
+};
+
+// Measure and baseline functions are plain function pointers, so the recording
+// in progress on the current thread is found through this.
+thread_local Recording* activeRecording = nullptr;
+
+// Makes `recording` the active one until the end of the scope, including when
+// a measure or baseline function throws.
+class ActiveRecordingScope {
+ public:
+  explicit ActiveRecordingScope(Recording& recording)
+      : previousRecording_(activeRecording) {
+    activeRecording = &recording;
+  }
+
+  ActiveRecordingScope(const ActiveRecordingScope&) = delete;
+  ActiveRecordingScope& operator=(const ActiveRecordingScope&) = delete;
+
+  ~ActiveRecordingScope() {
+    activeRecording = previousRecording_;
+  }
+
+ private:
+  Recording* previousRecording_;
+};
+
+size_t recordedIndex(YGNodeConstRef copy) {
+  return activeRecording->indexOfCopy.at(resolveRef(copy));
+}
+
+YGSize recordMeasure(
+    YGNodeConstRef copy,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  const auto index = recordedIndex(copy);
+  const auto size = activeRecording->originals[index]->measure(
+      width, scopedEnum(widthMode), height, scopedEnum(heightMode));
+  activeRecording->snapshot.nodes[index].measurements.push_back(
+      {width,
+       scopedEnum(widthMode),
+       height,
+       scopedEnum(heightMode),
+       size.width,
+       size.height});
+  return size;
+}
+
+float recordBaseline(YGNodeConstRef copy, float width, float height) {
+  const auto index = recordedIndex(copy);
+  const auto baseline =
+      activeRecording->originals[index]->baseline(width, height);
+  activeRecording->snapshot.nodes[index].baselines.push_back(
+      {width, height, baseline});
+  return baseline;
+}
+
+// Copies the subtree under `node`, without its cached layout
+yoga::Node* copySubtree(const yoga::Node* node, Recording& recording) {
+  const auto index = recording.originals.size();
+  recording.originals.push_back(node);
+  recording.snapshot.nodes.emplace_back();
+
+  auto copy = std::make_unique<yoga::Node>(node->getConfig());
+  copy->setStyle(node->style());
+  copy->setAlwaysFormsContainingBlock(node->alwaysFormsContainingBlock());
+  copy->setIsReferenceBaseline(node->isReferenceBaseline());
+  if (node->hasMeasureFunc()) {
+    copy->setMeasureFunc(recordMeasure);
+  }
+  if (node->hasBaselineFunc()) {
+    copy->setBaselineFunc(recordBaseline);
+  }
+  copy->setNodeType(node->getNodeType());
+  recording.indexOfCopy[copy.get()] = index;
+
+  auto& record = recording.snapshot.nodes[index];
+  record.style = node->style();
+  record.nodeType = node->getNodeType();
+  record.hasMeasureFunc = node->hasMeasureFunc();
+  record.hasBaselineFunc = node->hasBaselineFunc();
+  record.alwaysFormsContainingBlock = node->alwaysFormsContainingBlock();
+  record.isReferenceBaseline = node->isReferenceBaseline();
+
+  auto copyPtr = copy.get();
+  recording.copies.push_back(std::move(copy));
+  for (auto child : node->getChildren()) {
+    const auto childIndex = static_cast<uint32_t>(recording.originals.size());
+    auto childCopy = copySubtree(child, recording);
+    copyPtr->insertChild(childCopy, copyPtr->getChildCount());
+    childCopy->setOwner(copyPtr);
+    recording.snapshot.nodes[index].children.push_back(childIndex);
+  }
+  return copyPtr;
+}
+
+class Writer {
+ public:
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  void write(T value) {
+    data_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <Enumeration EnumT>
+  void write(EnumT value) {
+    write(to_underlying(value));
+  }
+
+  void write(FloatOptional value) {
+    write(value.unwrap());
+  }
+
+  void write(Style::Length length) {
+    write(length.unit());
+    write(length.value());
+  }
+
+  void write(const GridTrackList& tracks) {
+    write(static_cast<uint32_t>(tracks.size()));
+    for (const auto& track : tracks) {
+      write(track.unit());
+      write(track.value());
+    }
+  }
+
+  void write(GridPlacement placement) {
+    write(placement.start);
+    write(placement.end);
+    write(placement.span);
+  }
+
+  std::string release() {
+    return std::move(data_);
+  }
+
+ private:
+  std::string data_;
+};
+
+// Reads the data written by `Writer`. Reading past the end of the data, or an
+// out of range enum value, sets `failed()` and returns a default value.
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  bool failed() const {
+    return failed_;
+  }
+
+  bool atEnd() const {
+    return data_.empty();
+  }
+
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  T read() {
+    T value{};
+    if (data_.size() < sizeof(T)) {
+      failed_ = true;
+      return value;
+    }
+    std::memcpy(&value, data_.data(), sizeof(T));
+    data_.remove_prefix(sizeof(T));
+    return value;
+  }
+
+  template <HasOrdinality EnumT>
+  EnumT readEnum() {
+    const auto value = read<std::underlying_type_t<EnumT>>();
+    if (value >= ordinalCount<EnumT>()) {
+      failed_ = true;
+      return EnumT{};
+    }
+    return static_cast<EnumT>(value);
+  }
+
+  FloatOptional readFloatOptional() {
+    return FloatOptional{read<float>()};
+  }
+
+  Style::Length readLength() {
+    const auto unit = readEnum<Unit>();
+    const auto number = read<float>();
+    switch (unit) {
+      case Unit::Point:
+        return value::points(number);
+      case Unit::Percent:
+        return value::percent(number);
+      case Unit::Auto:
+        return value::ofAuto();
+      case Unit::Undefined:
+        return value::undefined();
+    }
+    return value::undefined();
+  }
+
+  GridTrackList readGridTracks() {
+    GridTrackList tracks;
+    const auto count = read<uint32_t>();
+    for (uint32_t i = 0; i < count && !failed_; i++) {
+      const auto unit = read<uint8_t>();
+      const auto number = read<float>();
+      switch (static_cast<GridTrackSize::Unit>(unit)) {
+        case GridTrackSize::Unit::Auto:
+          tracks.push_back(GridTrackSize::ofAuto());
+          break;
+        case GridTrackSize::Unit::Point:
+          tracks.push_back(GridTrackSize::points(number));
+          break;
+        case GridTrackSize::Unit::Percent:
+          tracks.push_back(GridTrackSize::percent(number));
+          break;
+        case GridTrackSize::Unit::Fraction:
+          tracks.push_back(GridTrackSize::fraction(number));
+          break;
+        default:
+          failed_ = true;
+          break;
+      }
+    }
+    return tracks;
+  }
+
+  GridPlacement readGridPlacement() {
+    GridPlacement placement;
+    placement.start = read<int16_t>();
+    placement.end = read<int16_t>();
+    placement.span = read<uint16_t>();
+    return placement;
+  }
+
+ private:
+  std::string_view data_;
+  bool failed_{false};
+};
+
+constexpr uint32_t kMagic = 0x534c4759; // "YGLS"
+constexpr uint16_t kVersion = 2;
+
+enum NodeFlags : uint8_t {
+  HasMeasureFunc = 1 << 0,
+  HasBaselineFunc = 1 << 1,
+  AlwaysFormsContainingBlock = 1 << 2,
+  IsReferenceBaseline = 1 << 3,
+};
+
+void writeStyle(Writer& writer, const Style& style) {
+  writer.write(style.direction());
+  writer.write(style.flexDirection());
+  writer.write(style.justifyContent());
+  writer.write(style.alignContent());
+  writer.write(style.alignItems());
+  writer.write(style.alignSelf());
+  writer.write(style.positionType());
+  writer.write(style.flexWrap());
+  writer.write(style.overflow());
+  writer.write(style.display());
+  writer.write(style.flex());
+  writer.write(style.flexGrow());
+  writer.write(style.flexShrink());
+  writer.write(style.flexBasis());
+  for (auto edge : ordinals<Edge>()) {
+    writer.write(style.margin(edge));
+    writer.write(style.position(edge));
+    writer.write(style.padding(edge));
+    writer.write(style.border(edge));
+  }
+  for (auto gutter : ordinals<Gutter>()) {
+    writer.write(style.gap(gutter));
+  }
+  for (auto dimension : ordinals<Dimension>()) {
+    writer.write(style.dimension(dimension));
+    writer.write(style.minDimension(dimension));
+    writer.write(style.maxDimension(dimension));
+  }
+  writer.write(style.aspectRatio());
+  writer.write(style.gridTemplateColumns());
+  writer.write(style.gridTemplateRows());
+  writer.write(style.gridColumn());
+  writer.write(style.gridRow());
+}
+
+Style readStyle(Reader& reader) {
+  Style style;
+  style.setDirection(reader.readEnum<Direction>());
+  style.setFlexDirection(reader.readEnum<FlexDirection>());
+  style.setJustifyContent(reader.readEnum<Justify>());
+  style.setAlignContent(reader.readEnum<Align>());
+  style.setAlignItems(reader.readEnum<Align>());
+  style.setAlignSelf(reader.readEnum<Align>());
+  style.setPositionType(reader.readEnum<PositionType>());
+  style.setFlexWrap(reader.readEnum<Wrap>());
+  style.setOverflow(reader.readEnum<Overflow>());
+  style.setDisplay(reader.readEnum<Display>());
+  style.setFlex(reader.readFloatOptional());
+  style.setFlexGrow(reader.readFloatOptional());
+  style.setFlexShrink(reader.readFloatOptional());
+  style.setFlexBasis(reader.readLength());
+  for (auto edge : ordinals<Edge>()) {
+    style.setMargin(edge, reader.readLength());
+    style.setPosition(edge, reader.readLength());
+    style.setPadding(edge, reader.readLength());
+    style.setBorder(edge, reader.readLength());
+  }
+  for (auto gutter : ordinals<Gutter>()) {
+    style.setGap(gutter, reader.readLength());
+  }
+  for (auto dimension : ordinals<Dimension>()) {
+    style.setDimension(dimension, reader.readLength());
+    style.setMinDimension(dimension, reader.readLength());
+    style.setMaxDimension(dimension, reader.readLength());
+  }
+  style.setAspectRatio(reader.readFloatOptional());
+  style.setGridTemplateColumns(reader.readGridTracks());
+  style.setGridTemplateRows(reader.readGridTracks());
+  style.setGridColumn(reader.readGridPlacement());
+  style.setGridRow(reader.readGridPlacement());
+  return style;
+}
+
+} // namespace
+
+LayoutSnapshot recordLayout(
+    const yoga::Node* root,
+    float ownerWidth,
+    float ownerHeight,
+    Direction ownerDirection) {
+  Recording recording;
+  auto rootCopy = copySubtree(root, recording);
+
+  const auto config = root->getConfig();
+  auto& snapshot = recording.snapshot;
+  snapshot.pointScaleFactor = config->getPointScaleFactor();
+  snapshot.errata = config->getErrata();
+  snapshot.experimentalFeatures = config->getEnabledExperiments();
+  snapshot.useWebDefaults = config->useWebDefaults();
+  snapshot.ownerWidth = ownerWidth;
+  snapshot.ownerHeight = ownerHeight;
+  snapshot.ownerDirection = ownerDirection;
+
+  {
+    ActiveRecordingScope activeRecordingScope{recording};
+    calculateLayout(rootCopy, ownerWidth, ownerHeight, ownerDirection);
+  }
+
+  for (size_t i = 0; i < snapshot.nodes.size(); i++) {
+    const auto& layout = recording.copies[i]->getLayout();
+    snapshot.nodes[i].frame = {
+        layout.position(PhysicalEdge::Left),
+        layout.position(PhysicalEdge::Top),
+        layout.dimension(Dimension::Width),
+        layout.dimension(Dimension::Height)};
+  }
+  return std::move(recording.snapshot);
+}
+
+std::string serializeLayoutSnapshot(const LayoutSnapshot& snapshot) {
+  Writer writer;
+  writer.write(kMagic);
+  writer.write(kVersion);
+
+  writer.write(snapshot.pointScaleFactor);
+  writer.write(snapshot.errata);
+  writer.write(static_cast<uint32_t>(snapshot.experimentalFeatures.to_ulong()));
+  writer.write(static_cast<uint8_t>(snapshot.useWebDefaults));
+  writer.write(snapshot.ownerWidth);
+  writer.write(snapshot.ownerHeight);
+  writer.write(snapshot.ownerDirection);
+
+  // Children follow their parent, so only their count is needed to rebuild
+  // the tree
+  writer.write(static_cast<uint32_t>(snapshot.nodes.size()));
+  for (const auto& node : snapshot.nodes) {
+    writer.write(node.nodeType);
+    writer.write(static_cast<uint8_t>(
+        (node.hasMeasureFunc ? HasMeasureFunc : 0) |
+        (node.hasBaselineFunc ? HasBaselineFunc : 0) |
+        (node.alwaysFormsContainingBlock ? AlwaysFormsContainingBlock : 0) |
+        (node.isReferenceBaseline ? IsReferenceBaseline : 0)));
+    writeStyle(writer, node.style);
+    writer.write(node.frame.left);
+    writer.write(node.frame.top);
+    writer.write(node.frame.width);
+    writer.write(node.frame.height);
+
+    writer.write(static_cast<uint32_t>(node.measurements.size()));
+    for (const auto& measurement : node.measurements) {
+      writer.write(measurement.width);
+      writer.write(measurement.widthMode);
+      writer.write(measurement.height);
+      writer.write(measurement.heightMode);
+      writer.write(measurement.measuredWidth);
+      writer.write(measurement.measuredHeight);
+    }
+    writer.write(static_cast<uint32_t>(node.baselines.size()));
+    for (const auto& baseline : node.baselines) {
+      writer.write(baseline.width);
+      writer.write(baseline.height);
+      writer.write(baseline.baseline);
+    }
+    writer.write(static_cast<uint32_t>(node.children.size()));
+  }
+  return writer.release();
+}
+
+std::optional<LayoutSnapshot> deserializeLayoutSnapshot(std::string_view data) {
+  Reader reader{data};
+  if (reader.read<uint32_t>() != kMagic ||
+      reader.read<uint16_t>() != kVersion) {
+    return std::nullopt;
+  }
+
+  LayoutSnapshot snapshot;
+  snapshot.pointScaleFactor = reader.read<float>();
+  snapshot.errata = static_cast<Errata>(reader.read<uint32_t>());
+  snapshot.experimentalFeatures = ExperimentalFeatureSet{
+      static_cast<unsigned long>(reader.read<uint32_t>())};
+  snapshot.useWebDefaults = reader.read<uint8_t>() != 0;
+  snapshot.ownerWidth = reader.read<float>();
+  snapshot.ownerHeight = reader.read<float>();
+  snapshot.ownerDirection = reader.readEnum<Direction>();
+
+  const auto nodeCount = reader.read<uint32_t>();
+  if (nodeCount == 0 || reader.failed()) {
+    return std::nullopt;
+  }
+
+  // Parents whose children are still being read, along with how many are left
+  std::vector<std::pair<uint32_t, uint32_t>> openParents;
+  for (uint32_t i = 0; i < nodeCount && !reader.failed(); i++) {
+    if (i > 0) {
+      if (openParents.empty()) {
+        return std::nullopt;
+      }
+      auto& [parent, remainingChildren] = openParents.back();
+      snapshot.nodes[parent].children.push_back(i);
+      if (--remainingChildren == 0) {
+        openParents.pop_back();
+      }
+    }
+
+    auto& node = snapshot.nodes.emplace_back();
+    node.nodeType = reader.readEnum<NodeType>();
+    const auto flags = reader.read<uint8_t>();
+    node.hasMeasureFunc = (flags & HasMeasureFunc) != 0;
+    node.hasBaselineFunc = (flags & HasBaselineFunc) != 0;
+    node.alwaysFormsContainingBlock = (flags & AlwaysFormsContainingBlock) != 0;
+    node.isReferenceBaseline = (flags & IsReferenceBaseline) != 0;
+    node.style = readStyle(reader);
+    node.frame.left = reader.read<float>();
+    node.frame.top = reader.read<float>();
+    node.frame.width = reader.read<float>();
+    node.frame.height = reader.read<float>();
+
+    const auto measurementCount = reader.read<uint32_t>();
+    for (uint32_t j = 0; j < measurementCount && !reader.failed(); j++) {
+      auto& measurement = node.measurements.emplace_back();
+      measurement.width = reader.read<float>();
+      measurement.widthMode = reader.readEnum<MeasureMode>();
+      measurement.height = reader.read<float>();
+      measurement.heightMode = reader.readEnum<MeasureMode>();
+      measurement.measuredWidth = reader.read<float>();
+      measurement.measuredHeight = reader.read<float>();
+    }
+    const auto baselineCount = reader.read<uint32_t>();
+    for (uint32_t j = 0; j < baselineCount && !reader.failed(); j++) {
+      auto& baseline = node.baselines.emplace_back();
+      baseline.width = reader.read<float>();
+      baseline.height = reader.read<float>();
+      baseline.baseline = reader.read<float>();
+    }
+
+    const auto childCount = reader.read<uint32_t>();
+    if (childCount > 0) {
+      openParents.emplace_back(i, childCount);
+    }
+  }
+
+  if (reader.failed() || !reader.atEnd() || !openParents.empty()) {
+    return std::nullopt;
+  }
+  return snapshot;
+}
+
+} // namespace facebook::yoga
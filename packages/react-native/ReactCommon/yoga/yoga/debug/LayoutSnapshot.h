@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+#include <yoga/config/Config.h>
+#include <yoga/enums/Direction.h>
+#include <yoga/enums/Errata.h>
+#include <yoga/enums/MeasureMode.h>
+#include <yoga/enums/NodeType.h>
+#include <yoga/node/Node.h>
+#include <yoga/style/Style.h>
+
+namespace facebook::yoga {
+
+/**
+ * Everything needed to run a layout pass again away from the app it was
+ * recorded in: the config and style of every node, the constraints of the
+ * root, and what the measure and baseline functions of the tree returned.
+ * The recorded frames allow checking that a replay lays the tree out the same.
+ */
+struct LayoutSnapshot {
+  struct Measurement {
+    float width;
+    MeasureMode widthMode;
+    float height;
+    MeasureMode heightMode;
+    float measuredWidth;
+    float measuredHeight;
+  };
+
+  struct Baseline {
+    float width;
+    float height;
+    float baseline;
+  };
+
+  // Layout of a node, relative to its parent
+  struct Frame {
+    float left;
+    float top;
+    float width;
+    float height;
+
+    bool operator==(const Frame& other) const = default;
+  };
+
+  struct NodeRecord {
+    Style style;
+    NodeType nodeType{NodeType::Default};
+    bool hasMeasureFunc{false};
+    bool hasBaselineFunc{false};
+    bool alwaysFormsContainingBlock{false};
+    bool isReferenceBaseline{false};
+    std::vector<Measurement> measurements;
+    std::vector<Baseline> baselines;
+    // Indices of the children of the node in `nodes`
+    std::vector<uint32_t> children;
+    Frame frame{};
+  };
+
+  float pointScaleFactor{1.0f};
+  Errata errata{Errata::None};
+  ExperimentalFeatureSet experimentalFeatures;
+  bool useWebDefaults{false};
+
+  float ownerWidth{YGUndefined};
+  float ownerHeight{YGUndefined};
+  Direction ownerDirection{Direction::Inherit};
+
+  // Nodes of the tree in pre-order, the first one being the root
+  std::vector<NodeRecord> nodes;
+};
+
+/**
+ * Lays out a copy of the tree under `root` with empty caches, so that every
+ * measure and baseline function it needs is called, and records it along with
+ * the results of these calls. The functions are called with the original
+ * nodes, whose layout is left untouched. The config of the root is recorded
+ * for every node.
+ */
+LayoutSnapshot recordLayout(
+    const yoga::Node* root,
+    float ownerWidth,
+    float ownerHeight,
+    Direction ownerDirection);
+
+/**
+ * Compact binary form of a snapshot, in the byte order of the host.
+ */
+std::string serializeLayoutSnapshot(const LayoutSnapshot& snapshot);
+
+/**
+ * Reads a snapshot written by `serializeLayoutSnapshot`, or returns
+ * std::nullopt if `data` isn't one.
+ */
+std::optional<LayoutSnapshot> deserializeLayoutSnapshot(std::string_view data);
+
+} // namespace facebook::yoga
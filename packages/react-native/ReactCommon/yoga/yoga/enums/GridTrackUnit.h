@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// @generated by enums.py
+// clang-format off
+#pragma once
+
+#include <cstdint>
+#include <yoga/YGEnums.h>
+#include <yoga/enums/YogaEnums.h>
+
+namespace facebook::yoga {
+
+enum class GridTrackUnit : uint8_t {
+  Auto = YGGridTrackUnitAuto,
+  Point = YGGridTrackUnitPoint,
+  Percent = YGGridTrackUnitPercent,
+  Fraction = YGGridTrackUnitFraction,
+};
+
+template <>
+constexpr int32_t ordinalCount<GridTrackUnit>() {
+  return 4;
+}
+
+constexpr GridTrackUnit scopedEnum(YGGridTrackUnit unscoped) {
+  return static_cast<GridTrackUnit>(unscoped);
+}
+
+constexpr YGGridTrackUnit unscopedEnum(GridTrackUnit scoped) {
+  return static_cast<YGGridTrackUnit>(scoped);
+}
+
+inline const char* toString(GridTrackUnit e) {
+  return YGGridTrackUnitToString(unscopedEnum(e));
+}
+
+} // namespace facebook::yoga
@@ -32,6 +32,8 @@ enum struct LayoutPassReason : int {
   kMeasureChild = 5,
   kAbsMeasureChild = 6,
   kFlexMeasure = 7,
+  kGridMeasure = 8,
+  kGridLayout = 9,
   COUNT
 };
 
@@ -125,6 +127,7 @@ struct Event::TypedData<Event::MeasureCallbackEnd> {
 template <>
 struct Event::TypedData<Event::NodeLayout> {
   LayoutType layoutType;
+  LayoutPassReason reason;
 };
 
 } // namespace facebook::yoga
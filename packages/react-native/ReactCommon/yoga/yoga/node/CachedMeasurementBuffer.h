@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+#include <yoga/node/CachedMeasurement.h>
+
+namespace facebook::yoga {
+
+// Fixed-size list of `Capacity` cached measurements. The first `InlineCount`
+// entries are stored inline, while the rest are only allocated the first time
+// one of them is written. Most nodes are measured under a handful of
+// constraints, so they never pay for the full list. Entries which were never
+// written read as a default constructed CachedMeasurement.
+template <size_t Capacity, size_t InlineCount>
+class CachedMeasurementBuffer {
+  static_assert(InlineCount > 0 && InlineCount < Capacity);
+
+ public:
+  CachedMeasurementBuffer() = default;
+  CachedMeasurementBuffer(const CachedMeasurementBuffer& other) {
+    *this = other;
+  }
+  CachedMeasurementBuffer(CachedMeasurementBuffer&& other) noexcept = default;
+
+  CachedMeasurementBuffer& operator=(const CachedMeasurementBuffer& other) {
+    if (this != &other) {
+      buffer_ = other.buffer_;
+      overflow_ = other.overflow_ != nullptr
+          ? std::make_unique<Overflow>(*other.overflow_)
+          : nullptr;
+    }
+    return *this;
+  }
+
+  CachedMeasurementBuffer& operator=(
+      CachedMeasurementBuffer&& other) noexcept = default;
+
+  const CachedMeasurement& operator[](size_t index) const {
+    if (index < InlineCount) {
+      return buffer_[index];
+    }
+    if (overflow_ == nullptr) {
+      static const CachedMeasurement emptyMeasurement{};
+      return emptyMeasurement;
+    }
+    return (*overflow_)[index - InlineCount];
+  }
+
+  // Returns a writable entry, allocating the out-of-line entries if needed
+  CachedMeasurement& operator[](size_t index) {
+    if (index < InlineCount) {
+      return buffer_[index];
+    }
+    if (overflow_ == nullptr) {
+      overflow_ = std::make_unique<Overflow>();
+    }
+    return (*overflow_)[index - InlineCount];
+  }
+
+  static constexpr size_t size() {
+    return Capacity;
+  }
+
+ private:
+  using Overflow = std::array<CachedMeasurement, Capacity - InlineCount>;
+
+  std::array<CachedMeasurement, InlineCount> buffer_{};
+  std::unique_ptr<Overflow> overflow_;
+};
+
+} // namespace facebook::yoga
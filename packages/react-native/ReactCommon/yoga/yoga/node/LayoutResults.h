@@ -15,6 +15,7 @@
 #include <yoga/enums/Edge.h>
 #include <yoga/enums/PhysicalEdge.h>
 #include <yoga/node/CachedMeasurement.h>
+#include <yoga/node/CachedMeasurementBuffer.h>
 #include <yoga/numeric/FloatOptional.h>
 
 namespace facebook::yoga {
@@ -24,6 +25,15 @@ struct LayoutResults {
   // 98% of analyzed layouts require less than 8 entries.
   static constexpr int32_t MaxCachedMeasurements = 8;
 
+#ifdef YG_COMPACT_NODES
+  // Compact nodes only keep the first couple of entries inline
+  using CachedMeasurements =
+      CachedMeasurementBuffer<MaxCachedMeasurements, 2>;
+#else
+  using CachedMeasurements =
+      std::array<CachedMeasurement, MaxCachedMeasurements>;
+#endif
+
   uint32_t computedFlexBasisGeneration = 0;
   FloatOptional computedFlexBasis = {};
 
@@ -33,9 +43,6 @@ struct LayoutResults {
   Direction lastOwnerDirection = Direction::Inherit;
 
   uint32_t nextCachedMeasurementsIndex = 0;
-  std::array<CachedMeasurement, MaxCachedMeasurements> cachedMeasurements = {};
-
-  CachedMeasurement cachedLayout{};
 
   Direction direction() const {
     return direction_;
@@ -101,8 +108,8 @@ struct LayoutResults {
     padding_[yoga::to_underlying(physicalEdge)] = dimension;
   }
 
-  bool operator==(LayoutResults layout) const;
-  bool operator!=(LayoutResults layout) const {
+  bool operator==(const LayoutResults& layout) const;
+  bool operator!=(const LayoutResults& layout) const {
     return !(*this == layout);
   }
 
@@ -116,6 +123,12 @@ struct LayoutResults {
   std::array<float, 4> margin_ = {};
   std::array<float, 4> border_ = {};
   std::array<float, 4> padding_ = {};
+
+  // The caches are only consulted when deciding whether a node needs to be
+  // laid out again, so they are kept after the results read by every pass.
+ public:
+  CachedMeasurement cachedLayout{};
+  CachedMeasurements cachedMeasurements = {};
 };
 
 } // namespace facebook::yoga
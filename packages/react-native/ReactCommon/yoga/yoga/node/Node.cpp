@@ -28,21 +28,22 @@ Node::Node(const yoga::Config* config) : config_{config} {
 
 Node::Node(Node&& node) noexcept
     : hasNewLayout_(node.hasNewLayout_),
+      hasNewLayoutInDescendants_(node.hasNewLayoutInDescendants_),
       isReferenceBaseline_(node.isReferenceBaseline_),
       isDirty_(node.isDirty_),
       alwaysFormsContainingBlock_(node.alwaysFormsContainingBlock_),
       nodeType_(node.nodeType_),
-      context_(node.context_),
-      measureFunc_(node.measureFunc_),
-      baselineFunc_(node.baselineFunc_),
-      dirtiedFunc_(node.dirtiedFunc_),
-      style_(std::move(node.style_)),
-      layout_(node.layout_),
       lineIndex_(node.lineIndex_),
+      config_(node.config_),
       owner_(node.owner_),
       children_(std::move(node.children_)),
-      config_(node.config_),
-      resolvedDimensions_(node.resolvedDimensions_) {
+      measureFunc_(node.measureFunc_),
+      resolvedDimensions_(node.resolvedDimensions_),
+      style_(std::move(node.style_)),
+      layout_(std::move(node.layout_)),
+      context_(node.context_),
+      baselineFunc_(node.baselineFunc_),
+      dirtiedFunc_(node.dirtiedFunc_) {
   for (auto c : children_) {
     c->setOwner(this);
   }
@@ -52,7 +53,7 @@ YGSize Node::measure(
     float width,
     MeasureMode widthMode,
     float height,
-    MeasureMode heightMode) {
+    MeasureMode heightMode) const {
   return measureFunc_(
       this, width, unscopedEnum(widthMode), height, unscopedEnum(heightMode));
 }
@@ -355,7 +356,9 @@ void Node::reset() {
   yoga::assertFatalWithNode(
       this, owner_ == nullptr, "Cannot reset a node still attached to a owner");
 
+  const bool isArenaAllocated = isArenaAllocated_;
   *this = Node{getConfig()};
+  isArenaAllocated_ = isArenaAllocated;
 }
 
 } // namespace facebook::yoga
@@ -22,6 +22,7 @@
 #include <yoga/enums/NodeType.h>
 #include <yoga/enums/PhysicalEdge.h>
 #include <yoga/node/LayoutResults.h>
+#include <yoga/node/SmallVector.h>
 #include <yoga/style/Style.h>
 
 // Tag struct used to form the opaque YGNodeRef for the public C API
@@ -31,6 +32,13 @@ namespace facebook::yoga {
 
 class YG_EXPORT Node : public ::YGNode {
  public:
+#ifdef YG_COMPACT_NODES
+  // Most nodes have at most a single child, which is stored inline
+  using Children = SmallVector<Node*, 1>;
+#else
+  using Children = std::vector<Node*>;
+#endif
+
   Node();
   explicit Node(const Config* config);
 
@@ -57,6 +65,15 @@ class YG_EXPORT Node : public ::YGNode {
     return hasNewLayout_;
   }
 
+  // Whether any descendant may have new layout results, i.e. whether the new
+  // layout of this node may come with new layouts below it. Set by layout
+  // passes which lay out the children of the node, and left as is when the
+  // layout of the node comes from its cache. Like `getHasNewLayout()`, must be
+  // reset by the reader of the layout results.
+  bool getHasNewLayoutInDescendants() const {
+    return hasNewLayoutInDescendants_;
+  }
+
   NodeType getNodeType() const {
     return nodeType_;
   }
@@ -69,7 +86,7 @@ class YG_EXPORT Node : public ::YGNode {
       float width,
       MeasureMode widthMode,
       float height,
-      MeasureMode heightMode);
+      MeasureMode heightMode) const;
 
   bool hasBaselineFunc() const noexcept {
     return baselineFunc_ != nullptr;
@@ -124,6 +141,11 @@ class YG_EXPORT Node : public ::YGNode {
     return isReferenceBaseline_;
   }
 
+  // Whether the node lives in a NodeArena instead of its own heap allocation
+  bool isArenaAllocated() const {
+    return isArenaAllocated_;
+  }
+
   // returns the Node that owns this Node. An owner is used to identify
   // the YogaTree that a Node belongs to. This method will return the parent
   // of the Node when a Node only belongs to one YogaTree or nullptr when
@@ -132,7 +154,7 @@ class YG_EXPORT Node : public ::YGNode {
     return owner_;
   }
 
-  const std::vector<Node*>& getChildren() const {
+  const Children& getChildren() const {
     return children_;
   }
 
@@ -174,6 +196,10 @@ class YG_EXPORT Node : public ::YGNode {
     hasNewLayout_ = hasNewLayout;
   }
 
+  void setHasNewLayoutInDescendants(bool hasNewLayoutInDescendants) {
+    hasNewLayoutInDescendants_ = hasNewLayoutInDescendants;
+  }
+
   void setNodeType(NodeType nodeType) {
     nodeType_ = nodeType;
   }
@@ -204,12 +230,16 @@ class YG_EXPORT Node : public ::YGNode {
     isReferenceBaseline_ = isReferenceBaseline;
   }
 
+  void setArenaAllocated(bool isArenaAllocated) {
+    isArenaAllocated_ = isArenaAllocated;
+  }
+
   void setOwner(Node* owner) {
     owner_ = owner;
   }
 
   void setChildren(const std::vector<Node*>& children) {
-    children_ = children;
+    children_.assign(children.begin(), children.end());
   }
 
   // TODO: rvalue override for setChildren
@@ -250,6 +280,10 @@ class YG_EXPORT Node : public ::YGNode {
 
   void cloneChildrenIfNeeded();
   void markDirtyAndPropagate();
+  float relativePosition(
+      FlexDirection axis,
+      Direction direction,
+      float axisSize) const;
   float resolveFlexGrow() const;
   float resolveFlexShrink() const;
   bool isNodeFlexible();
@@ -259,33 +293,33 @@ class YG_EXPORT Node : public ::YGNode {
   // Used to allow resetting the node
   Node& operator=(Node&&) noexcept = default;
 
-  float relativePosition(
-      FlexDirection axis,
-      Direction direction,
-      float axisSize) const;
-
   void useWebDefaults() {
     style_.setFlexDirection(FlexDirection::Row);
     style_.setAlignContent(Align::Stretch);
   }
 
+  // Fields read on every layout pass come first, so that they share cache
+  // lines, followed by the ones only touched when a node is set up, dirtied
+  // or measured.
   bool hasNewLayout_ : 1 = true;
+  bool hasNewLayoutInDescendants_ : 1 = true;
   bool isReferenceBaseline_ : 1 = false;
   bool isDirty_ : 1 = true;
   bool alwaysFormsContainingBlock_ : 1 = false;
+  bool isArenaAllocated_ : 1 = false;
   NodeType nodeType_ : bitCount<NodeType>() = NodeType::Default;
-  void* context_ = nullptr;
-  YGMeasureFunc measureFunc_ = nullptr;
-  YGBaselineFunc baselineFunc_ = nullptr;
-  YGDirtiedFunc dirtiedFunc_ = nullptr;
-  Style style_;
-  LayoutResults layout_;
   size_t lineIndex_ = 0;
-  Node* owner_ = nullptr;
-  std::vector<Node*> children_;
   const Config* config_;
+  Node* owner_ = nullptr;
+  Children children_;
+  YGMeasureFunc measureFunc_ = nullptr;
   std::array<Style::Length, 2> resolvedDimensions_{
       {value::undefined(), value::undefined()}};
+  Style style_;
+  LayoutResults layout_;
+  void* context_ = nullptr;
+  YGBaselineFunc baselineFunc_ = nullptr;
+  YGDirtiedFunc dirtiedFunc_ = nullptr;
 };
 
 inline Node* resolveRef(const YGNodeRef ref) {
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <new>
+
+#include <yoga/debug/AssertFatal.h>
+#include <yoga/node/NodeArena.h>
+
+namespace facebook::yoga {
+
+NodeArena::~NodeArena() {
+  reset();
+}
+
+Node* NodeArena::allocate(const Config* config) {
+  auto slot = takeSlot();
+  auto node = new (slot->storage) Node{config};
+  node->setArenaAllocated(true);
+  return node;
+}
+
+Node* NodeArena::allocate(const Node& node) {
+  auto slot = takeSlot();
+  auto clone = new (slot->storage) Node{node};
+  clone->setArenaAllocated(true);
+  return clone;
+}
+
+void NodeArena::deallocate(Node* node) {
+  yoga::assertFatalWithNode(
+      node,
+      node->isArenaAllocated(),
+      "Cannot return a node to an arena it was not allocated from");
+
+  auto slot = reinterpret_cast<Slot*>(node);
+  auto arena = slot->arena;
+  node->~Node();
+  slot->isAllocated = false;
+  slot->nextFree = arena->freeList_;
+  arena->freeList_ = slot;
+  arena->allocatedCount_--;
+}
+
+void NodeArena::reset() {
+  for (size_t i = 0; i < usedSlotCount_; i++) {
+    auto& slot = chunks_[i / kSlotsPerChunk][i % kSlotsPerChunk];
+    if (slot.isAllocated) {
+      std::launder(reinterpret_cast<Node*>(slot.storage))->~Node();
+      slot.isAllocated = false;
+    }
+  }
+  usedSlotCount_ = 0;
+  allocatedCount_ = 0;
+  freeList_ = nullptr;
+}
+
+NodeArena::Slot* NodeArena::takeSlot() {
+  Slot* slot = nullptr;
+  if (freeList_ != nullptr) {
+    slot = freeList_;
+    freeList_ = slot->nextFree;
+  } else {
+    if (usedSlotCount_ == chunks_.size() * kSlotsPerChunk) {
+      chunks_.push_back(std::make_unique<Slot[]>(kSlotsPerChunk));
+    }
+    slot = &chunks_[usedSlotCount_ / kSlotsPerChunk]
+                   [usedSlotCount_ % kSlotsPerChunk];
+    usedSlotCount_++;
+  }
+  slot->arena = this;
+  slot->nextFree = nullptr;
+  slot->isAllocated = true;
+  allocatedCount_++;
+  return slot;
+}
+
+} // namespace facebook::yoga
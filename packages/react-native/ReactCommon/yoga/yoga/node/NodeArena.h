@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+// Allocates nodes in chunks instead of one heap allocation per node. Freed
+// nodes return their slot to the arena for reuse, and `reset()` frees every
+// node of the arena at once while keeping its chunks for the next tree.
+// Like the nodes themselves, an arena must not be used from several threads
+// at the same time.
+class NodeArena {
+ public:
+  NodeArena() = default;
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+  ~NodeArena();
+
+  Node* allocate(const Config* config);
+  Node* allocate(const Node& node);
+
+  // Destroys a node allocated by any arena and returns its slot to it
+  static void deallocate(Node* node);
+
+  // Destroys every node still allocated from the arena
+  void reset();
+
+  size_t getAllocatedCount() const {
+    return allocatedCount_;
+  }
+
+ private:
+  struct Slot {
+    // Must stay the first member, so that a node's address is its slot's
+    alignas(Node) std::byte storage[sizeof(Node)];
+    NodeArena* arena;
+    Slot* nextFree;
+    bool isAllocated;
+  };
+
+  static constexpr size_t kSlotsPerChunk = 256;
+
+  Slot* takeSlot();
+
+  std::vector<std::unique_ptr<Slot[]>> chunks_;
+  size_t usedSlotCount_ = 0;
+  size_t allocatedCount_ = 0;
+  Slot* freeList_ = nullptr;
+};
+
+} // namespace facebook::yoga
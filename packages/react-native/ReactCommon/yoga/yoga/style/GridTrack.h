@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <yoga/enums/GridTrackUnit.h>
+#include <yoga/numeric/FloatOptional.h>
+
+namespace facebook::yoga {
+
+/**
+ * Size of a row or column track of a grid container: a length, a percentage
+ * of the grid container, `auto` (sized to its items), or a fraction (`fr`) of
+ * the space left once the other tracks are sized. Fractions have no minimum,
+ * i.e. `1fr` behaves like `minmax(0, 1fr)` in CSS.
+ */
+class GridTrackSize {
+ public:
+  using Unit = GridTrackUnit;
+
+  constexpr GridTrackSize() = default;
+
+  constexpr static GridTrackSize points(float value) {
+    return GridTrackSize{value, Unit::Point};
+  }
+
+  constexpr static GridTrackSize percent(float value) {
+    return GridTrackSize{value, Unit::Percent};
+  }
+
+  constexpr static GridTrackSize fraction(float value) {
+    return GridTrackSize{value, Unit::Fraction};
+  }
+
+  constexpr static GridTrackSize ofAuto() {
+    return GridTrackSize{};
+  }
+
+  constexpr Unit unit() const {
+    return unit_;
+  }
+
+  constexpr float value() const {
+    return value_;
+  }
+
+  constexpr bool isAuto() const {
+    return unit_ == Unit::Auto;
+  }
+
+  constexpr bool isFraction() const {
+    return unit_ == Unit::Fraction;
+  }
+
+  // Fixed size of the track, if it has one for the given container size
+  FloatOptional resolve(float referenceLength) const {
+    switch (unit_) {
+      case Unit::Point:
+        return FloatOptional{value_};
+      case Unit::Percent:
+        return FloatOptional{value_ * referenceLength * 0.01f};
+      case Unit::Auto:
+      case Unit::Fraction:
+        return FloatOptional{};
+    }
+    return FloatOptional{};
+  }
+
+  constexpr bool operator==(const GridTrackSize& rhs) const {
+    return unit_ == rhs.unit_ && value_ == rhs.value_;
+  }
+
+  constexpr bool operator!=(const GridTrackSize& rhs) const {
+    return !(*this == rhs);
+  }
+
+ private:
+  constexpr GridTrackSize(float value, Unit unit)
+      : value_(value), unit_(unit) {}
+
+  float value_{0.0f};
+  Unit unit_{Unit::Auto};
+};
+
+using GridTrackList = std::vector<GridTrackSize>;
+
+/**
+ * Explicit rows and columns of a grid container.
+ */
+struct GridTemplate {
+  GridTrackList columns;
+  GridTrackList rows;
+
+  bool operator==(const GridTemplate& rhs) const {
+    return columns == rhs.columns && rows == rhs.rows;
+  }
+};
+
+/**
+ * Lines a grid item is placed between along one axis. A start or end line of
+ * 0 is not set: an item without a start line is placed automatically, and
+ * one without an end line spans `span` tracks. Negative lines count back from
+ * the end of the explicit grid (-1 being its last line), as in CSS.
+ */
+struct GridPlacement {
+  int16_t start{0};
+  int16_t end{0};
+  uint16_t span{1};
+
+  constexpr bool isAuto() const {
+    return start == 0 && end == 0;
+  }
+
+  constexpr bool operator==(const GridPlacement& rhs) const {
+    return start == rhs.start && end == rhs.end && span == rhs.span;
+  }
+
+  constexpr bool operator!=(const GridPlacement& rhs) const {
+    return !(*this == rhs);
+  }
+};
+
+} // namespace facebook::yoga
@@ -9,6 +9,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include <yoga/Yoga.h>
@@ -28,6 +29,7 @@
 #include <yoga/enums/Unit.h>
 #include <yoga/enums/Wrap.h>
 #include <yoga/numeric/FloatOptional.h>
+#include <yoga/style/GridTrack.h>
 #include <yoga/style/StyleLength.h>
 #include <yoga/style/StyleValuePool.h>
 
@@ -202,6 +204,40 @@ class YG_EXPORT Style {
     pool_.store(aspectRatio_, value);
   }
 
+  // Track lists are rarely set, and shared between copies of a style once
+  // they are.
+  const GridTrackList& gridTemplateColumns() const {
+    return gridTemplate().columns;
+  }
+  void setGridTemplateColumns(GridTrackList tracks) {
+    auto newTemplate = gridTemplate();
+    newTemplate.columns = std::move(tracks);
+    setGridTemplate(std::move(newTemplate));
+  }
+
+  const GridTrackList& gridTemplateRows() const {
+    return gridTemplate().rows;
+  }
+  void setGridTemplateRows(GridTrackList tracks) {
+    auto newTemplate = gridTemplate();
+    newTemplate.rows = std::move(tracks);
+    setGridTemplate(std::move(newTemplate));
+  }
+
+  GridPlacement gridColumn() const {
+    return gridColumn_;
+  }
+  void setGridColumn(GridPlacement value) {
+    gridColumn_ = value;
+  }
+
+  GridPlacement gridRow() const {
+    return gridRow_;
+  }
+  void setGridRow(GridPlacement value) {
+    gridRow_ = value;
+  }
+
   bool horizontalInsetsDefined() const {
     return position_[yoga::to_underlying(Edge::Left)].isDefined() ||
         position_[yoga::to_underlying(Edge::Right)].isDefined() ||
@@ -463,7 +499,9 @@ class YG_EXPORT Style {
                minDimensions_, pool_, other.minDimensions_, other.pool_) &&
         lengthsEqual(
                maxDimensions_, pool_, other.maxDimensions_, other.pool_) &&
-        numbersEqual(aspectRatio_, pool_, other.aspectRatio_, other.pool_);
+        numbersEqual(aspectRatio_, pool_, other.aspectRatio_, other.pool_) &&
+        gridColumn_ == other.gridColumn_ && gridRow_ == other.gridRow_ &&
+        gridTemplate() == other.gridTemplate();
   }
 
   bool operator!=(const Style& other) const {
@@ -471,6 +509,17 @@ class YG_EXPORT Style {
   }
 
  private:
+  const GridTemplate& gridTemplate() const {
+    static const GridTemplate emptyTemplate{};
+    return gridTemplate_ != nullptr ? *gridTemplate_ : emptyTemplate;
+  }
+
+  void setGridTemplate(GridTemplate gridTemplate) {
+    gridTemplate_ = gridTemplate.columns.empty() && gridTemplate.rows.empty()
+        ? nullptr
+        : std::make_shared<const GridTemplate>(std::move(gridTemplate));
+  }
+
   using Dimensions = std::array<StyleValueHandle, ordinalCount<Dimension>()>;
   using Edges = std::array<StyleValueHandle, ordinalCount<Edge>()>;
   using Gutters = std::array<StyleValueHandle, ordinalCount<Gutter>()>;
@@ -669,6 +718,9 @@ class YG_EXPORT Style {
   Dimensions minDimensions_{};
   Dimensions maxDimensions_{};
   StyleValueHandle aspectRatio_{};
+  GridPlacement gridColumn_{};
+  GridPlacement gridRow_{};
+  std::shared_ptr<const GridTemplate> gridTemplate_;
 
   StyleValuePool pool_;
 };
@@ -287,6 +287,9 @@ def react_native_post_install(
   ReactNativePodsUtils.updateOSDeploymentTarget(installer)
   ReactNativePodsUtils.set_dynamic_frameworks_flags(installer)
   ReactNativePodsUtils.add_ndebug_flag_to_pods_in_release(installer)
+  # Yoga's node layout depends on YG_COMPACT_NODES, so every pod that includes
+  # its private headers has to be built with the same setting as Yoga itself.
+  ReactNativePodsUtils.add_compiler_flag_to_pods(installer, "-DYG_COMPACT_NODES") if ENV['YOGA_COMPACT_NODES'] == '1'
   ReactNativePodsUtils.add_privacy_manifest_if_needed(installer)
 
   NewArchitectureHelper.set_clang_cxx_language_standard_if_needed(installer)